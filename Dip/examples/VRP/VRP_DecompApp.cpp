@@ -182,12 +182,20 @@ void VRP_DecompApp::createModels(){
       setModelRelax(model, m_appParam.ModelNameRelax);
    }
 
+   //---
+   //--- ESPPRCC is priced by labeling (in the original space), the
+   //---   directed model is only kept for debugging
+   //---
    if(m_appParam.ModelNameRelax == "ESPPRCC"){
       DecompConstraintSet * model = new DecompConstraintSet();
       createModelESPPCC(model);   
       m_models.push_back(model);
       m_modelESPPRC = model;
-      setModelRelax(model, m_appParam.ModelNameRelax);
+
+      DecompConstraintSet * modelRelax = new DecompConstraintSet();
+      m_models.push_back(modelRelax);
+      setModelRelax(modelRelax, m_appParam.ModelNameRelax);
+      createRCSPP();
    }
    
    UtilPrintFuncEnd(m_osLog, m_classTag,
@@ -388,17 +396,37 @@ DecompSolverStatus VRP_DecompApp::solveRelaxed(const int          whichBlock,
 
 
    if(m_appParam.ModelNameRelax == "ESPPRCC"){
-      const int          blockId         = 0;
-      const DecompAlgo * decompAlgo      = getDecompAlgo();
-      //DecompAlgoModel  & decompAlgoModel 
-        // = decompAlgo->getModelRelax(blockId);
+      //---
+      //--- the cost of arc (i,j) is the reduced cost of edge {i,j}
+      //---
+      const int blockId = 0;
+      const int numArcs = m_rcspp->getNumArcs();
+      vector<DecompRCSPP::Path> routes;
 
+      for(i = 0; i < numArcs; i++)
+         m_rcspp->setArcCost(i, redCostX[m_rcsppArcEdge[i]]);
 
+      //---
+      //--- heuristic labeling first, exact if it finds nothing
+      //---
+      m_rcspp->solve(true, m_appParam.PricingMaxRoutes, convexDual, routes);
+      solverStatus = DecompSolStatFeasible;
 
+      if(routes.empty()){
+         if(m_rcspp->solve(false, m_appParam.PricingMaxRoutes, convexDual,
+                           routes))
+            solverStatus = DecompSolStatOptimal;
+      }
 
-      //solve then map back and set to exact - cannot let 
-      // built in solve it
-      exit(1);
+      if(m_appParam.PricingCheck)
+         checkRCSPP(convexDual, solverStatus == DecompSolStatOptimal,
+                    routes);
+
+      m_rcspp->appendVars(routes, m_rcsppArcEdge, m_objective,
+                          convexDual, blockId, varList);
+      UTIL_DEBUG(m_appParam.LogLevel, 3,
+		 (*m_osLog) << "ESPPRCC routes=" << routes.size() << endl;
+		 );
    }
 
 
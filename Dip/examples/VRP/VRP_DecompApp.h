@@ -18,6 +18,7 @@
 // --------------------------------------------------------------------- //
 #include "Decomp.h"
 #include "DecompApp.h"
+#include "DecompRCSPP.h"
 #include "VRP_Boost.h"
 #include "VRP_CVRPsep.h"
 #include "VRP_Instance.h"
@@ -68,6 +69,10 @@ private:
    vector<DecompConstraintSet*>   m_models;
    DecompConstraintSet          * m_modelESPPRC;
 
+   /** Labeling pricing for ESPPRCC and the edge of each of its arcs. */
+   DecompRCSPP                  * m_rcspp;
+   vector<int>                    m_rcsppArcEdge;
+
 public:
    /* @name Inherited (from virtual) methods. */
 
@@ -104,6 +109,14 @@ public:
    /* Create ESPPCC model. */
    void createModelESPPCC(DecompConstraintSet * model);
 
+   /* Create the ESPPCC labeling graph. */
+   void createRCSPP();
+
+   /* Check the ESPPCC labeling against enumeration (small instances). */
+   void checkRCSPP(const double                      convexDual,
+                   const bool                        exact,
+                   const vector<DecompRCSPP::Path> & routes) const;
+
    const int diGraphIndex(int i, int j, int numVertices){
       return i*numVertices + j;
    }
@@ -120,7 +133,9 @@ public:
       DecompApp(utilParam),
       m_classTag("VRP-APP"),
 	m_objective(NULL),
-	m_modelESPPRC(NULL)
+	m_modelESPPRC(NULL),
+	m_rcspp(NULL),
+	m_rcsppArcEdge()
    {
       //---
       //--- get application parameters
@@ -135,6 +150,7 @@ public:
    virtual ~VRP_DecompApp() {
       UtilDeleteVectorPtr(m_models);
       UTIL_DELARR(m_objective);
+      UTIL_DELPTR(m_rcspp);
    };
 };
 
@@ -35,6 +35,8 @@ public:
    string ModelNameCore;      //name of model core
    string ModelNameRelax;     //name of model relax
    string ModelNameRelaxNest; //name of nested model relax
+   int    PricingMaxRoutes;   //max routes per ESPPRCC pricing call
+   int    PricingCheck;       //check ESPPRCC pricing by enumeration
    
 public:
    void getSettings(UtilParameters & utilParam){
@@ -49,6 +51,10 @@ public:
          = utilParam.GetSetting("ModelNameRelax", "", common);
       ModelNameRelaxNest 
          = utilParam.GetSetting("ModelNameRelaxNest", "", common);
+      PricingMaxRoutes
+         = utilParam.GetSetting("PricingMaxRoutes", 50, common);
+      PricingCheck
+         = utilParam.GetSetting("PricingCheck",      0, common);
    }
 
    void dumpSettings(ostream * os = &cout){
@@ -62,6 +68,8 @@ public:
       (*os) << common << ": ModelNameCore     : " << ModelNameCore     << endl;
       (*os) << common << ": ModelNameRelax    : " << ModelNameRelax    << endl;
       (*os) << common << ": ModelNameRelaxNest: " << ModelNameRelaxNest<< endl;
+      (*os) << common << ": PricingMaxRoutes  : " << PricingMaxRoutes  << endl;
+      (*os) << common << ": PricingCheck      : " << PricingCheck      << endl;
       (*os) <<   "=====================================================\n";
    }
 
@@ -73,7 +81,9 @@ public:
       NumRoutes         (0 ),
       ModelNameCore     (""),
       ModelNameRelax    (""),
-      ModelNameRelaxNest("")      
+      ModelNameRelaxNest(""),
+      PricingMaxRoutes  (50),
+      PricingCheck      (0 )
    {}
    ~VRP_Param() {};
 };
@@ -144,3 +144,142 @@ void VRP_DecompApp::createModelESPPCC(DecompConstraintSet * model){
    UtilPrintFuncBegin(m_osLog, m_classTag,
 		      "createModelESPPCC()", m_appParam.LogLevel, 2);
 }
+
+//===========================================================================//
+void VRP_DecompApp::createRCSPP(){
+   //---
+   //--- The ESPPCC graph for labeling pricing:
+   //---  depot  = 0 (source) and n+1 (sink), C = 1...n (customers)
+   //---  arcs (0,j), (i,j), (i,n+1) for i,j in C, i != j
+   //---  resource 0 = load, the consumption of arc (i,j) is d[j]
+   //---  paths are elementary
+   //---
+   //--- Arc (i,j) is mapped to the original edge {i,j} (the sink is the
+   //---  depot again), so a route 0-i-0 uses edge {0,i} twice.
+   //---
+   UtilPrintFuncBegin(m_osLog, m_classTag,
+		      "createRCSPP()", m_appParam.LogLevel, 2);
+
+   UtilGraphLib & graphLib     = m_vrp.m_graphLib;
+   const double   capacity     = graphLib.capacity;
+   const int      numCustomers = graphLib.n_vertices - 1;
+   const int      sink         = numCustomers + 1;
+   int            i, j;
+   double         demand;
+
+   UTIL_DELPTR(m_rcspp);
+   m_rcspp = new DecompRCSPP(numCustomers + 2, 1, 0, sink);
+   m_rcsppArcEdge.clear();
+
+   for(i = 0; i <= sink; i++)
+      m_rcspp->setResourceWindow(i, 0, 0.0, capacity);
+
+   for(i = 0; i <= numCustomers; i++){
+      for(j = 1; j <= sink; j++){
+         if(i == j || (i == 0 && j == sink))
+            continue;
+         demand = j == sink ? 0.0 : graphLib.vertex_wt[j];
+         m_rcspp->addArc(i, j, &demand);
+         m_rcsppArcEdge.push_back(UtilIndexU(i, j == sink ? 0 : j));
+      }
+   }
+   m_rcspp->setElementary();
+
+   UtilPrintFuncEnd(m_osLog, m_classTag,
+		    "createRCSPP()", m_appParam.LogLevel, 2);
+}
+
+//===========================================================================//
+void VRP_DecompApp::checkRCSPP(const double                      convexDual,
+                               const bool                        exact,
+                               const vector<DecompRCSPP::Path> & routes) const{
+   //---
+   //--- Enumerate all elementary, capacity feasible routes of the labeling
+   //---  graph (depth first, so only for small instances) and compare the
+   //---  best reduced cost (path cost - convexDual) with the labeling:
+   //---   a.) every route found has negative reduced cost,
+   //---   b.) an exact search finds the best route, or none if there is
+   //---       no route with negative reduced cost.
+   //--- The convexity dual is usually positive for the VRP, so a route
+   //---  of positive cost can still price out.
+   //---
+   UtilPrintFuncBegin(m_osLog, m_classTag,
+		      "checkRCSPP()", m_appParam.LogLevel, 2);
+
+   const UtilGraphLib & graphLib     = m_vrp.m_graphLib;
+   const double         capacity     = graphLib.capacity;
+   const int            numCustomers = graphLib.n_vertices - 1;
+   const int            sink         = numCustomers + 1;
+   const int            numArcs      = m_rcspp->getNumArcs();
+   int                  a;
+   size_t               k;
+
+   vector< vector<int> > outArcs(sink + 1);
+   for(a = 0; a < numArcs; a++)
+      outArcs[m_rcspp->getTail(a)].push_back(a);
+
+   //---
+   //--- the stack holds the path: node, next out-arc to try, load, cost
+   //---
+   vector<int>    path(1, 0);
+   vector<size_t> next(1, 0);
+   vector<double> load(1, 0.0);
+   vector<double> cost(1, 0.0);
+   vector<bool>   onPath(sink + 1, false);
+   double         bestRedCost = m_infinity;
+   onPath[0] = true;
+
+   while(!path.empty()){
+      const int v = path.back();
+      if(next.back() >= outArcs[v].size()){
+         onPath[v] = false;
+         path.pop_back();
+         next.pop_back();
+         load.pop_back();
+         cost.pop_back();
+         continue;
+      }
+      a = outArcs[v][next.back()++];
+      const int    j = m_rcspp->getHead(a);
+      const double d = j == sink ? 0.0 : graphLib.vertex_wt[j];
+      const double c = cost.back() + m_rcspp->getArcCost(a);
+      if(onPath[j] || load.back() + d > capacity + DecompEpsilon)
+         continue;
+      if(j == sink){
+         bestRedCost = std::min(bestRedCost, c - convexDual);
+         continue;
+      }
+      onPath[j] = true;
+      path.push_back(j);
+      next.push_back(0);
+      load.push_back(load.back() + d);
+      cost.push_back(c);
+   }
+
+   UTIL_DEBUG(m_appParam.LogLevel, 3,
+	      (*m_osLog) << "checkRCSPP convexDual= " << convexDual
+	      << " bestRedCost= " << bestRedCost
+	      << " routes= " << routes.size() << endl;
+	      );
+
+   for(k = 0; k < routes.size(); k++){
+      double pathCost = 0.0;
+      for(size_t q = 0; q < routes[k].arcs.size(); q++)
+         pathCost += m_rcspp->getArcCost(routes[k].arcs[q]);
+      if(fabs(pathCost - routes[k].cost) > DecompEpsilon ||
+         pathCost - convexDual >= -DecompEpsilon)
+         throw UtilException("Labeling returned a route that does not "
+                             "price out.", "checkRCSPP", "VRP_DecompApp");
+   }
+
+   if(exact){
+      const double found
+         = routes.empty() ? 0.0 : routes[0].cost - convexDual;
+      if(std::min(bestRedCost, 0.0) < found - DecompEpsilon)
+         throw UtilException("Exact labeling missed a route that prices "
+                             "out.", "checkRCSPP", "VRP_DecompApp");
+   }
+
+   UtilPrintFuncEnd(m_osLog, m_classTag,
+		    "checkRCSPP()", m_appParam.LogLevel, 2);
+}
@@ -17,6 +17,8 @@
 #include "AlpsDecompNodeDesc.h"
 #include "AlpsDecompTreeNode.h"
 #include "AlpsKnowledgeBrokerSerial.h"
+#include "AlpsSubTree.h"
+#include "AlpsNodePool.h"
 
 using namespace std;
 
@@ -32,6 +34,9 @@ void AlpsDecompModel::setAlpsSettings()
    AlpsPar()->setEntry(AlpsParams::msgLevel,        m_param.msgLevel);
    AlpsPar()->setEntry(AlpsParams::nodeLimit,       m_param.nodeLimit);
    AlpsPar()->setEntry(AlpsParams::nodeLogInterval, m_param.nodeLogInterval);
+   AlpsPar()->setEntry(AlpsParams::searchStrategy,  m_param.searchStrategy);
+   AlpsPar()->setEntry(AlpsParams::searchStrategyRampUp,
+                       m_param.searchStrategy);
    double timeLimit = m_decompAlgo->getParam().TimeLimit;
    AlpsPar()->setEntry(AlpsParams::timeLimit,       timeLimit);
    UtilPrintFuncEnd(&cout, m_classTag,
@@ -116,6 +121,215 @@ bool AlpsDecompModel::fathomAllNodes()
 
 
 
+//===========================================================================//
+void AlpsDecompModel::checkpoint(AlpsTreeNode* current)
+{
+   DecompAlgo*        decompAlgo  = getDecompAlgo();
+   const DecompParam& decompParam = decompAlgo->getParam();
+   double timeNow = decompAlgo->getStats().timerOverall.getRealTime();
+
+   //---
+   //--- nothing to do if not asked for, not due yet, or if the open
+   //---   nodes of a restart have not been handed to Alps yet
+   //---
+   if (decompParam.CheckpointFile == ""                              ||
+         timeNow - m_lastCheckpoint < decompParam.CheckpointInterval ||
+         decompAlgo->getRestart()) {
+      return;
+   }
+
+   UtilPrintFuncBegin(&cout, m_classTag,
+                      "checkpoint()", m_param.msgLevel, 3);
+   DecompCheckpoint cp;
+   decompAlgo->fillCheckpoint(cp);
+   cp.timeElapsed    = m_timeBeforeRestart  + timeNow;
+   cp.nodesProcessed = m_nodesBeforeRestart + broker_->getNumNodesProcessed();
+   //---
+   //--- open nodes: the current one and the candidates in the pool(s)
+   //---
+   vector<AlpsTreeNode*> openNodes;
+   openNodes.push_back(current);
+   AlpsSubTree* subTree = broker_->getWorkingSubTree();
+
+   if (subTree) {
+      AlpsNodePool* pools[2] = {subTree->nodePool(), subTree->diveNodePool()};
+
+      for (int p = 0; p < 2; p++) {
+         if (!pools[p]) {
+            continue;
+         }
+
+         const vector<AlpsTreeNode*>& cands
+            = pools[p]->getCandidateList().getContainer();
+
+         for (size_t i = 0; i < cands.size(); i++) {
+            if (cands[i] != current) {
+               openNodes.push_back(cands[i]);
+            }
+         }
+      }
+   }
+
+   cp.bestLB = ALPS_OBJ_MAX;
+
+   for (size_t i = 0; i < openNodes.size(); i++) {
+      AlpsDecompNodeDesc* desc
+         = dynamic_cast<AlpsDecompNodeDesc*>(openNodes[i]->getDesc());
+
+      if (!desc || !desc->lowerBounds_ || !desc->upperBounds_) {
+         continue;
+      }
+
+      DecompCheckpoint::Node node;
+      node.quality     = openNodes[i]->getQuality();
+      node.branchedDir = desc->getBranchedDir();
+      node.colLB.assign(desc->lowerBounds_,
+                        desc->lowerBounds_ + desc->numberCols_);
+      node.colUB.assign(desc->upperBounds_,
+                        desc->upperBounds_ + desc->numberCols_);
+      node.branchRows  = desc->branchRows_;
+      cp.nodes.push_back(node);
+      cp.bestLB = CoinMin(cp.bestLB, node.quality);
+   }
+
+   cp.write(decompParam.CheckpointFile);
+   m_lastCheckpoint = timeNow;
+   UTIL_MSG(m_param.msgLevel, 1,
+            cout << "Checkpoint " << decompParam.CheckpointFile
+            << ": " << cp.nodes.size() << " open nodes, "
+            << cp.vars.size() << " columns, "
+            << cp.cuts.size() << " cuts, bestLB = "
+            << UtilDblToStr(cp.bestLB) << endl;
+           );
+   UtilPrintFuncEnd(&cout, m_classTag,
+                    "checkpoint()", m_param.msgLevel, 3);
+}
+
+//===========================================================================//
+bool AlpsDecompModel::startNode(const AlpsTreeNode* node)
+{
+   const bool isDive = m_lastNodeIndex >= 0 &&
+                       node->getParentIndex() == m_lastNodeIndex;
+   m_diveDepth       = isDive ? m_diveDepth + 1 : 0;
+   m_lastNodeIndex   = node->getIndex();
+   m_numNodesStarted++;
+   return isDive;
+}
+
+//===========================================================================//
+bool AlpsDecompModel::endNode(const AlpsTreeNode* node,
+                              const bool          isDive,
+                              const double        quality,
+                              const double        parentQuality,
+                              const double        sumInfeas,
+                              const double        bestBound,
+                              const int           masterIters,
+                              double&             estimate)
+{
+   DecompStats& stats = m_decompAlgo->getStats();
+   const bool   finite = quality       <  ALPS_OBJ_MAX_LESS &&
+                         quality       > -ALPS_OBJ_MAX_LESS &&
+                         parentQuality > -ALPS_OBJ_MAX_LESS;
+
+   if (isDive) {
+      stats.numDiveNodes++;
+      stats.numDiveMasterIters += masterIters;
+
+      //---
+      //--- the parent was processed just before: learn how much the
+      //---   bound grows per unit of integer infeasibility
+      //---
+      if (finite && m_lastNodeInfeas > DecompEpsilon) {
+         m_degradeSum += std::max(quality - parentQuality, 0.0)
+                         / m_lastNodeInfeas;
+         m_degradeCount++;
+      }
+   }
+
+   m_lastNodeInfeas = sumInfeas;
+   estimate         = quality;
+
+   if (m_degradeCount > 0) {
+      estimate += sumInfeas * m_degradeSum / m_degradeCount;
+   }
+
+   UTIL_MSG(m_param.msgLevel, 3,
+            std::cout << "Node " << node->getIndex()
+            << (isDive ? " (dive)" : " (jump)")
+            << " master iterations " << masterIters
+            << " estimate " << UtilDblToStr(estimate) << std::endl;
+           );
+
+   //---
+   //--- dive into a child (hybrid search) unless the dive is deep enough,
+   //---   a jump is due or the node is too far from the best bound
+   //---
+   if (m_param.searchStrategy != AlpsSearchTypeHybrid ||
+         m_diveDepth >= m_param.diveMaxDepth || !finite) {
+      return false;
+   }
+
+   if (m_param.diveJumpInterval > 0 &&
+         m_numNodesStarted % m_param.diveJumpInterval == 0) {
+      return false;
+   }
+
+   const double gap = UtilCalculateGap(bestBound, quality,
+                                       m_decompAlgo->getInfinity());
+   return gap <= m_param.diveRelGap;
+}
+
+//===========================================================================//
+void AlpsDecompModel::writeStatsFile() const
+{
+   const DecompParam& decompParam = m_decompAlgo->getParam();
+
+   if (decompParam.StatsFile == "") {
+      return;
+   }
+
+   ofstream os(decompParam.StatsFile.c_str());
+
+   if (!os) {
+      cerr << "Could not open StatsFile " << decompParam.StatsFile << endl;
+      return;
+   }
+
+   DecompStats& stats  = m_decompAlgo->getStats();
+   const double bestLB = m_alpsStatus == AlpsExitStatusOptimal ?
+                         m_bestUB : m_bestLB;
+   os.precision(12);
+   os << "{\"status\":"           << m_alpsStatus
+      << ",\"bestLB\":"           << bestLB
+      << ",\"bestUB\":"           << m_bestUB
+      << ",\"nodes\":"            << m_nodesProcessed
+      << ",\"timeTotal\":"        << stats.timerOverall.getRealTime()
+      << ",\"timeRootBound\":"    << stats.timeRootBound
+      << ",\"rootBound\":"        << stats.rootBound
+      << ",\"priceCalls\":"       << stats.numPriceCalls
+      << ",\"cutCalls\":"         << stats.numCutCalls
+      << ",\"colsGenerated\":"    << stats.numColsGenerated
+      << ",\"cutsGenerated\":"    << stats.numCutsGenerated
+      << ",\"masterIters\":"      << stats.numMasterIters
+      << ",\"maxNodeMasterIters\":" << stats.maxNodeMasterIters
+      << ",\"diveNodes\":"        << stats.numDiveNodes
+      << ",\"diveMasterIters\":"  << stats.numDiveMasterIters
+      << ",\"memNames\":"         << stats.memNames
+      << ",\"memHashes\":"        << stats.memHashes
+      << ",\"memCoreModel\":"     << stats.memCoreModel
+      << ",\"memBlockModels\":"   << stats.memBlockModels
+      << ",\"memMaster\":"        << stats.memMaster
+      << ",\"memVars\":"          << stats.memVars
+      << ",\"memVarPool\":"       << stats.memVarPool
+      << ",\"memCuts\":"          << stats.memCuts
+      << ",\"memCutPool\":"       << stats.memCutPool
+      << ",\"memScratch\":"       << stats.memScratch
+      << ",\"scratchRequests\":"  << stats.scratchRequests
+      << ",\"scratchAllocs\":"    << stats.scratchAllocs
+      << ",\"scratchBytes\":"     << stats.scratchBytes
+      << "}\n";
+}
+
 //===========================================================================//
 AlpsExitStatus AlpsDecompModel::solve()
 {
@@ -141,6 +355,16 @@ AlpsExitStatus AlpsDecompModel::solve()
    //--- copy relevant parameters to DecompParam from AlpsParam
    //---
    decompParam.NodeLimit = m_param.nodeLimit;
+
+   //---
+   //--- if restarting, account for the work already done
+   //---
+   if (decompAlgo->getRestart()) {
+      m_timeBeforeRestart  = decompAlgo->getRestart()->timeElapsed;
+      m_nodesBeforeRestart = decompAlgo->getRestart()->nodesProcessed;
+   }
+
+   m_lastCheckpoint = decompStats.timerOverall.getRealTime();
    //---
    //--- declare an AlpsKnowledgeBroker for serial application
    //---
@@ -150,6 +374,16 @@ AlpsExitStatus AlpsDecompModel::solve()
    //---
    alpsBroker.search(this);
 
+   //---
+   //--- save the generated columns for warm starting a later run
+   //---
+   if (decompParam.ColumnOutputFile != "") {
+      decompAlgo->writeColumnFile(decompParam.ColumnOutputFile);
+   }
+
+   decompAlgo->writeTrace();
+   decompAlgo->calculateMemoryStats();
+
    if (m_param.msgLevel > 0) {
       m_decompAlgo->getDecompStats().printOverallStats();
    }
@@ -173,6 +407,7 @@ AlpsExitStatus AlpsDecompModel::solve()
    }
 
    m_alpsStatus = alpsBroker.getSolStatus();
+   writeStatsFile();
    UtilPrintFuncEnd(&cout, m_classTag,
                     "solve()", m_param.msgLevel, 3);
    return alpsBroker.getSolStatus();
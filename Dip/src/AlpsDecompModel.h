@@ -95,6 +95,28 @@ private:
    int    m_nodesProcessed;
    int    m_alpsStatus;
 
+   /**
+    * Checkpointing: real time the last checkpoint was written and the
+    * work done by the run(s) we restarted from.
+    */
+   double m_lastCheckpoint;
+   double m_timeBeforeRestart;
+   int    m_nodesBeforeRestart;
+
+   /**
+    * Node selection (hybrid search): the node processed last and its
+    * integer infeasibility, the number of nodes in a row processed by
+    * diving, the nodes processed, and the bound increase per unit of
+    * infeasibility seen from a node to the child dived into (used for
+    * the estimates of the nodes).
+    */
+   int    m_lastNodeIndex;
+   double m_lastNodeInfeas;
+   int    m_diveDepth;
+   int    m_numNodesStarted;
+   double m_degradeSum;
+   int    m_degradeCount;
+
    /**
     * @}
     */
@@ -113,7 +135,16 @@ public:
       AlpsModel    (),
       m_classTag   ("ALPSM"),
       m_param      (),
-      m_decompAlgo (NULL) {
+      m_decompAlgo (NULL),
+      m_lastCheckpoint    (0.0),
+      m_timeBeforeRestart (0.0),
+      m_nodesBeforeRestart(0),
+      m_lastNodeIndex     (-1),
+      m_lastNodeInfeas    (0.0),
+      m_diveDepth         (0),
+      m_numNodesStarted   (0),
+      m_degradeSum        (0.0),
+      m_degradeCount      (0) {
    }
 
    AlpsDecompModel(UtilParameters& utilParam,
@@ -121,7 +152,16 @@ public:
       AlpsModel   (),
       m_classTag  ("ALPSM"),
       m_param     (utilParam),
-      m_decompAlgo(decompAlgo) {
+      m_decompAlgo(decompAlgo),
+      m_lastCheckpoint    (0.0),
+      m_timeBeforeRestart (0.0),
+      m_nodesBeforeRestart(0),
+      m_lastNodeIndex     (-1),
+      m_lastNodeInfeas    (0.0),
+      m_diveDepth         (0),
+      m_numNodesStarted   (0),
+      m_degradeSum        (0.0),
+      m_degradeCount      (0) {
       if (decompAlgo == NULL)
          throw UtilException("No DecompAlgo algorithm has been set.",
                              "AlpsDecompModel", "AlpsDecompModel");
@@ -171,6 +211,41 @@ public:
     */
    void setAlpsSettings();
 
+   /**
+    * Write CheckpointFile if CheckpointInterval seconds have passed since
+    * the last checkpoint. The node about to be processed is stored as
+    * open, together with the candidates in the Alps node pool.
+    */
+   void checkpoint(AlpsTreeNode* current);
+
+   /**
+    * Write a one-line JSON summary of the run (status, bounds, nodes,
+    * times, iterations, columns and cuts generated) to StatsFile, for
+    * the benchmark suite (test/benchmark.py).
+    */
+   void writeStatsFile() const;
+
+   /**
+    * Node selection: called when node starts, returns true if it is a
+    * dive (its parent was processed just before, so the master is warm).
+    */
+   bool startNode(const AlpsTreeNode* node);
+
+   /**
+    * Node selection: called when node (bound quality, integer
+    * infeasibility sumInfeas of the master solution) is done; records
+    * the master iterations it took and returns whether to dive into one
+    * of its children. estimate is the estimate of its best solution.
+    */
+   bool endNode(const AlpsTreeNode* node,
+                const bool          isDive,
+                const double        quality,
+                const double        parentQuality,
+                const double        sumInfeas,
+                const double        bestBound,
+                const int           masterIters,
+                double&             estimate);
+
    /**
     * Solve with ALPS and DECOMP.
     */
@@ -21,6 +21,7 @@
 #include "AlpsNodeDesc.h"
 #include "AlpsDecompModel.h"
 #include "UtilMacrosAlps.h"
+#include "DecompBranchRow.h"
 
 //===========================================================================//
 class CoinWarmStartBasis;
@@ -79,6 +80,8 @@ public:
    int branchedDir_;
    /** Branched set of indices/values to create it. */
    std::vector< std::pair<int, double> > branched_;
+   /** Branching rows (on top of the bounds) along the path to it. */
+   std::vector<DecompBranchRow> branchRows_;
 
    //THINK: different derivations for different algos? need?
    /** Warm start. */
@@ -77,6 +77,35 @@ public:
     */
    int nodeLogInterval;
 
+   /**
+    * Node selection (Alps search strategy):
+    *  - 0: best bound (Default)
+    *  - 1: breadth first
+    *  - 2: depth first
+    *  - 3: best estimate
+    *  - 4: hybrid, best bound with dives into a child of the node just
+    *       processed, which starts from the master that node left (see
+    *       diveMaxDepth, diveRelGap, diveJumpInterval)
+    */
+   int searchStrategy;
+
+   /**
+    * Hybrid search: most nodes processed in a row by diving. Default: 8
+    */
+   int diveMaxDepth;
+
+   /**
+    * Hybrid search: dive only while the bound of the node is within this
+    * relative gap of the best bound. Default: 0.05
+    */
+   double diveRelGap;
+
+   /**
+    * Hybrid search: end the dive every n nodes, so the search jumps to
+    * the best node of the pool (0 = never). Default: 50
+    */
+   int diveJumpInterval;
+
 
    //-----------------------------------------------------------------------//
    /**
@@ -93,6 +122,10 @@ public:
       msgLevel        = param.GetSetting("msgLevel",        2,            sec);
       nodeLimit       = param.GetSetting("nodeLimit",       ALPS_INT_MAX, sec);
       nodeLogInterval = param.GetSetting("nodeLogInterval", 10,           sec);
+      searchStrategy  = param.GetSetting("searchStrategy",  0,            sec);
+      diveMaxDepth    = param.GetSetting("diveMaxDepth",    8,            sec);
+      diveRelGap      = param.GetSetting("diveRelGap",      0.05,         sec);
+      diveJumpInterval = param.GetSetting("diveJumpInterval", 50,         sec);
 
       if (msgLevel > 2) {
          dumpSettings();
@@ -109,6 +142,10 @@ public:
       (*os) << sec << ": msgLevel        = " << msgLevel        << std::endl;
       (*os) << sec << ": nodeLimit       = " << nodeLimit       << std::endl;
       (*os) << sec << ": nodeLogInterval = " << nodeLogInterval << std::endl;
+      (*os) << sec << ": searchStrategy  = " << searchStrategy  << std::endl;
+      (*os) << sec << ": diveMaxDepth    = " << diveMaxDepth    << std::endl;
+      (*os) << sec << ": diveRelGap      = " << diveRelGap      << std::endl;
+      (*os) << sec << ": diveJumpInterval = " << diveJumpInterval << std::endl;
    }
    /**
     * @}
@@ -124,14 +124,25 @@ int AlpsDecompTreeNode::process(bool isRoot,
    int            status       = AlpsReturnStatusOk;
    bool           doFathom     = false;
    DecompStatus   decompStatus = STAT_FEASIBLE;
-   double         relTolerance = 0.0001; //0.01% means optimal (make param)
    double         gap;
+   bool           processed    = false;
+   //---
+   //--- write a checkpoint, if one is due
+   //---
+   if (!isRoot) {
+      model->checkpoint(this);
+   }
+
+   //---
+   //--- node selection: is this node a dive (a child of the last one)?
+   //---
+   const bool isDive = model->startNode(this);
+
    //---
    //--- check if this can be fathomed based on parent by objective cutoff
    //---
    double currentUB       = getKnowledgeBroker()->getIncumbentValue();
    double parentObjValue  = getQuality();
-   double primalTolerance = 1.0e-6;
    double globalLB        = -decompAlgo->getInfinity();
    double globalUB        =  decompAlgo->getInfinity();
    double thisQuality;
@@ -143,8 +154,10 @@ int AlpsDecompTreeNode::process(bool isRoot,
    const int             n_cols    = modelCore->getNumCols();
    //TODO: cutoffIncrement (currentUB-cutoffIncrement)
 
-   /** \todo get primalTolerance from parameter */
-   if ((parentObjValue - primalTolerance) > currentUB) {
+   //---
+   //--- the parent bound (rounded, with the NodeFathom tolerances)
+   //---
+   if (!isRoot && decompAlgo->isNodeBoundPruned(parentObjValue, currentUB)) {
       doFathom = true;
       UTIL_DEBUG(param.msgLevel, 3,
                  cout << "Fathom since parentObjValue="
@@ -196,6 +209,7 @@ int AlpsDecompTreeNode::process(bool isRoot,
               );
       decompAlgo->setMasterBounds(lbs, ubs);
       decompAlgo->setSubProbBounds(lbs, ubs);
+      decompAlgo->setBranchRows(desc->branchRows_);
    } else {
       //---
       //--- check to see if we got lucky in generating init vars
@@ -255,7 +269,7 @@ int AlpsDecompTreeNode::process(bool isRoot,
       //TODO: cutoffIncrement (currentUB-cutoffIncrement)
       gap = UtilCalculateGap(globalLB, globalUB, decompAlgo->getInfinity());
 
-      if (gap <= relTolerance) {
+      if (decompAlgo->isNodeBoundPruned(globalLB, globalUB, true)) {
          doFathom = true;
          UTIL_MSG(param.msgLevel, 3,
                   cout << "Fathom Node " << getIndex() << " since globalLB= "
@@ -271,6 +285,7 @@ int AlpsDecompTreeNode::process(bool isRoot,
    //--- solve the bounding problem (DecompAlgo)
    //---
    decompStatus = decompAlgo->processNode(this, globalLB, globalUB);
+   processed    = true;
 
    //---
    //--- during processNode, did we find any IP feasible points?
@@ -295,7 +310,11 @@ int AlpsDecompTreeNode::process(bool isRoot,
       //---   if the new bound is > current currentUB, fathom
       //---   else                                , branch
       //---
-      thisQuality = decompAlgo->getObjBestBoundLB();           //LB (min)
+      //---
+      //--- the bound is rounded up if the objective is integral
+      //---
+      thisQuality = decompAlgo->roundNodeBound(
+                       decompAlgo->getObjBestBoundLB());        //LB (min)
       currentUB      = getKnowledgeBroker()->getIncumbentValue(); //UB (min)
 
       if (thisQuality > quality_) {
@@ -305,8 +324,7 @@ int AlpsDecompTreeNode::process(bool isRoot,
       //watch tolerance here... if quality is close enough, fathom it
       gap = UtilCalculateGap(thisQuality, currentUB, decompAlgo->getInfinity());
 
-      //if(gap <= relTolerance){
-      if (quality_ >= currentUB) {
+      if (decompAlgo->isNodeBoundPruned(quality_, currentUB)) {
          doFathom = true;
          UTIL_DEBUG(param.msgLevel, 3,
                     cout << "Fathom since thisQuality= "
@@ -317,6 +335,27 @@ int AlpsDecompTreeNode::process(bool isRoot,
                    );
       }
 
+      //---
+      //--- reduced-cost fixing: tighten this node's bounds (inherited by
+      //---   its children), the subproblems and the master columns
+      //---
+      if (!doFathom && decompAlgo->getParam().RedCostFixing) {
+         const int nFixed =
+            decompAlgo->reducedCostFixing(desc->lowerBounds_,
+                                          desc->upperBounds_, currentUB);
+
+         if (nFixed > 0) {
+            decompAlgo->setSubProbBounds(lbs, ubs);
+            decompAlgo->setMasterBounds(lbs, ubs);
+         }
+
+         UTIL_MSG(param.msgLevel, 3,
+                  cout << "Node " << getIndex()
+                  << " reduced-cost fixing tightened " << nFixed
+                  << " columns" << endl;
+                 );
+      }
+
       UTIL_MSG(param.msgLevel, 3,
                cout << "Node " << getIndex()
                << " quality " << UtilDblToStr(quality_)
@@ -363,6 +402,13 @@ TERM_PROCESS:
       setStatus(AlpsNodeStatusPregnant);
    } else if (doFathom) { // || param.nodeLimit == 0){
       setStatus(AlpsNodeStatusFathomed);
+   } else if (isRoot && decompAlgo->getRestart() &&
+              !decompAlgo->getRestart()->nodes.empty()) {
+      //---
+      //--- on restart, the children of the root are the open nodes
+      //---   of the checkpoint (see branch())
+      //---
+      setStatus(AlpsNodeStatusPregnant);
    } else {
       status = chooseBranchingObject(model);
       if (getStatus() == AlpsNodeStatusPregnant){
@@ -370,6 +416,52 @@ TERM_PROCESS:
       }
    }
 
+   //---
+   //--- the restart is over once the root is processed, unless the root
+   //---   still has to branch into the open nodes of the checkpoint
+   //---   (then branch() clears it); otherwise no checkpoint is written
+   //---
+   if (isRoot && decompAlgo->getRestart() &&
+         (getStatus() != AlpsNodeStatusPregnant ||
+          decompAlgo->getRestart()->nodes.empty())) {
+      decompAlgo->clearRestart();
+   }
+
+   //---
+   //--- node selection: the estimate of this node (from the integer
+   //---   infeasibility of the master solution) and whether to dive
+   //---   into one of its children next
+   //---
+   {
+      const double* xhat      = decompAlgo->getXhat();
+      const int     nInts     = modelCore->getNumInts();
+      double        sumInfeas = 0.0;
+      double        estimate  = quality_;
+
+      if (processed && xhat && nInts > 0 &&
+            getStatus() == AlpsNodeStatusPregnant) {
+         const int* integerVars = modelCore->getIntegerVars();
+
+         for (int i = 0; i < nInts; i++) {
+            const double x = xhat[integerVars[i]];
+            const double f = x - floor(x);
+            sumInfeas += std::min(f, 1.0 - f);
+         }
+      }
+
+      bestNode = getKnowledgeBroker()->getBestNode();
+      const double bestBound = bestNode ?
+                               std::min(bestNode->getQuality(), quality_) :
+                               quality_;
+      const int    masterIters = processed ?
+                                 decompAlgo->getNodeStats().masterIters : 0;
+      const bool   dive = model->endNode(this, isDive, quality_,
+                                         parentObjValue, sumInfeas,
+                                         bestBound, masterIters, estimate);
+      setSolEstimate(estimate);
+      setDiving(dive && getStatus() == AlpsNodeStatusPregnant);
+   }
+
    UtilPrintFuncEnd(&cout, m_classTag,
                     "process()", param.msgLevel, 3);
    return status;
@@ -384,10 +476,18 @@ int AlpsDecompTreeNode::chooseBranchingObject(AlpsModel* model)
    AlpsDecompParam& param = m->getParam();
    UtilPrintFuncBegin(&cout, m_classTag, "chooseBranchingObject()",
                       param.msgLevel, 3);
-   bool gotBranch = m->getDecompAlgo()->chooseBranchSet(downBranchLB_,
-                    downBranchUB_,
-                    upBranchLB_,
-                    upBranchUB_);
+   //---
+   //--- branching on rows (sums, Ryan-Foster pairs) comes first, if on
+   //---
+   bool gotBranch = m->getDecompAlgo()->chooseBranchRows(downBranchRows_,
+                    upBranchRows_);
+
+   if (!gotBranch) {
+      gotBranch = m->getDecompAlgo()->chooseBranchSet(downBranchLB_,
+                  downBranchUB_,
+                  upBranchLB_,
+                  upBranchUB_);
+   }
 
    if (!gotBranch) {
       setStatus(AlpsNodeStatusEvaluated);
@@ -443,16 +543,51 @@ AlpsDecompTreeNode::branch()
    const int numCols = desc->numberCols_;
    CoinAssert(oldLbs && oldUbs && numCols);
 
+   //---
+   //--- on restart, the root branches into the open nodes of the checkpoint
+   //---
+   DecompCheckpoint* restart = decompAlgo->getRestart();
+
+   if (restart && !restart->nodes.empty()) {
+      for (unsigned i = 0; i < restart->nodes.size(); i++) {
+         DecompCheckpoint::Node& node = restart->nodes[i];
+
+         if (static_cast<int>(node.colLB.size()) != numCols) {
+            continue;
+         }
+
+         child = new AlpsDecompNodeDesc(m, &node.colLB[0], &node.colUB[0]);
+         child->setBranchedDir(node.branchedDir);
+         child->branchRows_ = node.branchRows;
+         newNodes.push_back(CoinMakeTriple(static_cast<AlpsNodeDesc*>(child),
+                                           AlpsNodeStatusCandidate,
+                                           node.quality));
+      }
+
+      UTIL_MSG(param.msgLevel, 1,
+               cout << "Restart: " << newNodes.size()
+               << " open nodes restored from checkpoint." << endl;
+              );
+      decompAlgo->clearRestart();
+      setStatus(AlpsNodeStatusBranched);
+      UtilPrintFuncEnd(&cout, m_classTag, "branch()", param.msgLevel, 3);
+      return newNodes;
+   }
+
    //---
    //--- check to make sure the branching variables have been determined
    //---
-   if ((downBranchLB_.size() + downBranchUB_.size() == 0) ||
-         (upBranchLB_.size()   + upBranchUB_.size()   == 0)) {
+   if ((downBranchLB_.size() + downBranchUB_.size()
+         + downBranchRows_.size() == 0) ||
+         (upBranchLB_.size()   + upBranchUB_.size()
+          + upBranchRows_.size()   == 0)) {
       std::cout << "AlpsDecompError: "
                 << "downBranch_.size() = "
                 << downBranchLB_.size() + downBranchUB_.size()
+                + downBranchRows_.size()
                 << "; upBranch_.size() = "
                 << upBranchLB_.size() + upBranchUB_.size()
+                + upBranchRows_.size()
                 << "; index_ = " << index_ << std::endl;
       throw CoinError("empty branch variable set(s)",
                       "branch", "AlpsDecompTreeNode");
@@ -500,9 +635,13 @@ AlpsDecompTreeNode::branch()
       newUbs[downBranchUB_[i].first] = downBranchUB_[i].second;
    }
 
-   assert(downBranchLB_.size() + downBranchUB_.size() > 0);
+   assert(downBranchLB_.size() + downBranchUB_.size()
+          + downBranchRows_.size() > 0);
    child = new AlpsDecompNodeDesc(m, newLbs, newUbs);
    child->setBranchedDir(-1);//enum?
+   child->branchRows_ = desc->branchRows_;
+   child->branchRows_.insert(child->branchRows_.end(),
+                             downBranchRows_.begin(), downBranchRows_.end());
 
    if (decompParam.BranchStrongIter) {
       double globalUB             = getKnowledgeBroker()->getIncumbentValue();
@@ -519,6 +658,7 @@ AlpsDecompTreeNode::branch()
       decompAlgo->setStrongBranchIter(true);
       decompAlgo->setMasterBounds(newLbs, newUbs);
       decompAlgo->setSubProbBounds(newLbs, newUbs);
+      decompAlgo->setBranchRows(child->branchRows_);
       decompAlgo->processNode(this, objVal, globalUB);
       decompAlgo->setStrongBranchIter(false);
       decompParam.TotalCutItersLimit   = limitTotalCutIters;
@@ -564,9 +704,13 @@ AlpsDecompTreeNode::branch()
       newUbs[upBranchUB_[i].first] = upBranchUB_[i].second;
    }
 
-   assert(upBranchLB_.size() + upBranchUB_.size() > 0);
+   assert(upBranchLB_.size() + upBranchUB_.size()
+          + upBranchRows_.size() > 0);
    child = new AlpsDecompNodeDesc(m, newLbs, newUbs);
    child->setBranchedDir(1);//enum?
+   child->branchRows_ = desc->branchRows_;
+   child->branchRows_.insert(child->branchRows_.end(),
+                             upBranchRows_.begin(), upBranchRows_.end());
 
    if (decompParam.BranchStrongIter) {
       double globalUB             = getKnowledgeBroker()->getIncumbentValue();
@@ -583,6 +727,7 @@ AlpsDecompTreeNode::branch()
       decompAlgo->setStrongBranchIter(true);
       decompAlgo->setMasterBounds(newLbs, newUbs);
       decompAlgo->setSubProbBounds(newLbs, newUbs);
+      decompAlgo->setBranchRows(child->branchRows_);
       decompAlgo->processNode(this, objVal, globalUB);
       decompAlgo->setStrongBranchIter(false);
       decompParam.TotalCutItersLimit   = limitTotalCutIters;
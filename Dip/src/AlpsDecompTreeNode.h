@@ -18,6 +18,7 @@
 //===========================================================================//
 #include "Alps.h"
 #include "AlpsTreeNode.h"
+#include "DecompBranchRow.h"
 
 //===========================================================================//
 class AlpsNodeDesc;
@@ -33,6 +34,9 @@ private:
    std::vector< std::pair<int, double> > downBranchUB_;
    std::vector< std::pair<int, double> > upBranchLB_;
    std::vector< std::pair<int, double> > upBranchUB_;
+   /** Rows added to the children when branching on rows. */
+   std::vector<DecompBranchRow>          downBranchRows_;
+   std::vector<DecompBranchRow>          upBranchRows_;
 
 public:
    /** Default constructor. */
@@ -31,6 +31,10 @@
 
 //===========================================================================//
 #include "OsiClpSolverInterface.hpp"
+#ifdef DIP_HAS_CLP
+#include "ClpInterior.hpp"
+#include "ClpCholeskyBase.hpp"
+#endif
 #include "CglGomory.hpp"
 #include "CglProbing.hpp"
 #include "CglKnapsackCover.hpp"
@@ -166,7 +170,7 @@ void DecompAlgo::checkBlocksColumns()
 
       if (sit == activeColsUnion.end()) {
          (*m_osLog) << "Column " << setw(5) << i << " -> "
-                    << setw(25) << modelCore.getModel()->colNames[i]
+                    << setw(25) << modelCore.getModel()->getColName(i)
                     << " is missing from union of blocks." << endl;
          allColsCovered = false;
       }
@@ -196,6 +200,19 @@ void DecompAlgo::initSetup()
    //---   these just store pointers to the models provided by user
    //---   and will store pointers to the approriate OSI objects
    //---
+   //---
+   //--- start the event trace (a ring buffer for each thread that can
+   //---   record: pricing, cut generation)
+   //---
+   if (m_param.TraceFile != "") {
+      int nThreads = std::max(m_param.NumConcurrentThreadsSubProb,
+                              m_param.CutCglThreads);
+#ifdef _OPENMP
+      nThreads = std::max(nThreads, omp_get_max_threads());
+#endif
+      m_trace.init(nThreads, m_param.TraceBufferSize);
+   }
+
    getModelsFromApp();
    m_numConvexCon = static_cast<int>(m_modelRelax.size());
    DecompConstraintSet* modelCore = m_modelCore.getModel();
@@ -226,6 +243,29 @@ void DecompAlgo::initSetup()
       checkBlocksColumns();
    }
 
+   //---
+   //--- the objective is integral if the costs of the integer columns are
+   //---   integral and the continuous columns have no cost
+   //---
+   m_objIntegral = false;
+
+   if (modelCore && m_app->m_objective) {
+      const int    nCols     = modelCore->getNumCols();
+      const char*  intMark   = modelCore->getNumInts() ?
+                               modelCore->getIntegerMark() : NULL;
+      const double* objCoeff = m_app->m_objective;
+      m_objIntegral = true;
+
+      for (int j = 0; j < nCols && m_objIntegral; j++) {
+         const bool isInt = intMark && intMark[j] == 'I';
+
+         if (isInt ? !UtilIsIntegral(objCoeff[j], DecompEpsilon)
+               : !UtilIsZero(objCoeff[j])) {
+            m_objIntegral = false;
+         }
+      }
+   }
+
    //---
    //--- if we have a core, allocate a pool of memory for re-use
    //---
@@ -234,6 +274,24 @@ void DecompAlgo::initSetup()
                                modelCore->getNumRows());
    }
 
+   //---
+   //--- and a scratch arena for each of the other threads that can price
+   //---   or separate in parallel (thread 0 uses m_memPool)
+   //---
+   {
+      int nThreads = std::max(m_param.NumConcurrentThreadsSubProb,
+                              m_param.CutCglThreads);
+#ifdef _OPENMP
+      nThreads = std::max(nThreads, omp_get_max_threads());
+#endif
+      UTIL_DELARR(m_memPoolThreads);
+      m_numMemPoolThreads = std::max(nThreads - 1, 0);
+
+      if (m_numMemPoolThreads > 0) {
+         m_memPoolThreads = new DecompMemPool[m_numMemPoolThreads];
+      }
+   }
+
    //---
    //--- By default the relaxation can be solved using a generic IP solver.
    //---
@@ -256,6 +314,13 @@ void DecompAlgo::initSetup()
       }
    }
 
+   //---
+   //--- blocks with a recognized structure are priced by an oracle
+   //---
+   if (m_param.PricingOracles) {
+      createPricingOracles();
+   }
+
    //assert(m_numConvexCon >= 1);
    UTIL_DEBUG(m_param.LogDebugLevel, 1,
               (*m_osLog) << "Number of Convexity Constraints: "
@@ -292,8 +357,22 @@ void DecompAlgo::initSetup()
    //--- RC: do nothing - DecompAlgo base?? WHY - need an shat to get going
    //---  C: do nothing - DecompAlgo base
    //---
+   //---
+   //--- on restart, the columns of the checkpoint replace the init vars
+   //---
    DecompVarList initVars;
-   m_nodeStats.varsThisCall += generateInitVars(initVars);
+
+   if (!m_param.Restart || m_param.CheckpointFile == "" ||
+         !loadCheckpoint(initVars)) {
+      m_nodeStats.varsThisCall += generateInitVars(initVars);
+   }
+
+   //---
+   //--- add the columns saved by an earlier run (ColumnOutputFile)
+   //---
+   if (m_param.InitColumnFile != "") {
+      m_nodeStats.varsThisCall += loadColumnFile(initVars);
+   }
 
    //---
    //--- create the master OSI interface
@@ -319,6 +398,9 @@ void DecompAlgo::initSetup()
                          m_param.CutCglKnapC,
                          m_param.CutCglMir,
                          m_param.CutCglGomory);
+   m_cgl->setNumThreads (m_param.CutCglThreads);
+   m_cgl->setTimeBudget (m_param.CutCglTimeBudget);
+   m_cgl->setSchedule   (m_param.CutCglSchedule != 0);
    //---
    //--- create master problem
    //---
@@ -405,6 +487,26 @@ void DecompAlgo::initSetup()
                     "initSetup()", m_param.LogDebugLevel, 2);
 }
 
+//===========================================================================//
+DecompMemPool& DecompAlgo::getScratch()
+{
+   int thread = 0;
+#ifdef _OPENMP
+   thread = omp_get_thread_num();
+#endif
+
+   if (thread == 0) {
+      return m_memPool;
+   }
+
+   if (thread > m_numMemPoolThreads) {
+      throw UtilException("No scratch arena for this thread",
+                          "getScratch", "DecompAlgo");
+   }
+
+   return m_memPoolThreads[thread - 1];
+}
+
 //===========================================================================//
 void DecompAlgo::createOsiSubProblem(DecompSubModel& subModel)
 {
@@ -456,17 +558,18 @@ void DecompAlgo::createOsiSubProblem(DecompSubModel& subModel)
 
    //---
    //--- set column and row names (if they exist)
+   //---   in low-memory mode the names are not copied to the solver
    //---
    string           objName  = "objective";
    vector<string>& colNames = model->colNames;
    vector<string>& rowNames = model->rowNames;
    subprobSI->setIntParam(OsiNameDiscipline, 1);//1=Lazy, 2=Full
 
-   if (colNames.size()) {
+   if (colNames.size() && !m_param.LowMemory) {
       subprobSI->setColNames(colNames, 0, nCols, 0);
    }
 
-   if (rowNames.size()) {
+   if (rowNames.size() && !m_param.LowMemory) {
       subprobSI->setRowNames(rowNames, 0, nRows, 0);
    }
 
@@ -476,7 +579,7 @@ void DecompAlgo::createOsiSubProblem(DecompSubModel& subModel)
 
    for (i = 0; i < nCols; i++) {
    (*m_osLog) << "User column name (" << i << ") = "
-      << colNames[i] << endl;
+      << model->getColName(i) << endl;
    }
    for (i = 0; i < nCols; i++) {
    (*m_osLog) << "OSI  column name (" << i << ") = "
@@ -491,6 +594,41 @@ void DecompAlgo::createOsiSubProblem(DecompSubModel& subModel)
                     "createOsiSubProblem()", m_param.LogDebugLevel, 2);
 }
 
+//===========================================================================//
+void DecompAlgo::createPricingOracles()
+{
+   UtilPrintFuncBegin(m_osLog, m_classTag,
+                      "createPricingOracles()", m_param.LogDebugLevel, 2);
+   DecompConstraintSet* modelCore = m_modelCore.getModel();
+
+   if (!modelCore || !modelCore->getIntegerMark()) {
+      return;
+   }
+
+   UtilDeleteMapPtr(m_pricingOracles);
+   map<int, DecompSubModel>::iterator mit;
+
+   for (mit = m_modelRelax.begin(); mit != m_modelRelax.end(); mit++) {
+      DecompPricingOracle* oracle
+         = DecompPricingOracle::create(mit->second.getModel(),
+                                       modelCore->getIntegerMark(),
+                                       m_infinity);
+
+      if (!oracle) {
+         continue;
+      }
+
+      m_pricingOracles.insert(make_pair(mit->first, oracle));
+      UTIL_MSG(m_param.LogLevel, 2,
+               (*m_osLog) << "Block " << mit->first << " is priced by the "
+               << oracle->getName() << " oracle." << endl;
+              );
+   }
+
+   UtilPrintFuncEnd(m_osLog, m_classTag,
+                    "createPricingOracles()", m_param.LogDebugLevel, 2);
+}
+
 //===========================================================================//
 void DecompAlgo::getModelsFromApp()
 {
@@ -587,8 +725,6 @@ void DecompAlgo::loadSIFromModel(OsiSolverInterface* si,
          continue;
       }
 
-      const vector<string>& rowNames = relax->getRowNames();
-
       nRowsR                          = relax->getNumRows();
 
       if (m_param.LogDumpModel >= 2) {
@@ -602,7 +738,7 @@ void DecompAlgo::loadSIFromModel(OsiSolverInterface* si,
          //os << endl;
          for (r = 0; r < nRowsR; r++) {
             os << (*mit).second.getBlockId()
-               << " " << rowNames[r] << endl;
+               << " " << relax->getRowName(r) << endl;
          }
       }
 
@@ -695,11 +831,11 @@ void DecompAlgo::loadSIFromModel(OsiSolverInterface* si,
    vector<string>& colNames  = core->colNames;
    vector<string>& rowNamesC = core->rowNames;
 
-   if (colNames.size()) {
+   if (colNames.size() && !m_param.LowMemory) {
       si->setColNames(colNames,  0, nCols, 0);
    }
 
-   if (rowNamesC.size()) {
+   if (rowNamesC.size() && !m_param.LowMemory) {
       si->setRowNames(rowNamesC, 0, nRowsC, 0);
    }
 
@@ -716,7 +852,7 @@ void DecompAlgo::loadSIFromModel(OsiSolverInterface* si,
       vector<string>& rowNamesR = relax->rowNames;
       nRowsR = relax->getNumRows();
 
-      if (rowNamesR.size()) {
+      if (rowNamesR.size() && !m_param.LowMemory) {
          si->setRowNames(rowNamesR, 0, nRowsR, rowIndex);
       }
 
@@ -798,8 +934,6 @@ void DecompAlgo::createMasterProblem(DecompVarList& initVars)
    int nRowsCore = modelCore->getNumRows();
    int nIntVars  = modelCore->getNumInts();
    int nInitVars = static_cast<int>(initVars.size());
-   double* dblArrNCoreCols = new double[nColsCore];
-   assert(dblArrNCoreCols);
    //---
    //--- TODO:
    //--- MO vars do not need an explicit row in master even if
@@ -810,8 +944,15 @@ void DecompAlgo::createMasterProblem(DecompVarList& initVars)
    //--- set the row counts
    //---
    m_nRowsOrig   = nRowsCore;
+   //---
+   //--- with BranchEnforceLazy, the branching rows are only made for
+   //---   the columns branched on (see setMasterBranchRows)
+   //---
+   m_branchLazy  = m_param.BranchEnforceInMaster && m_param.BranchEnforceLazy;
+   m_branchRowsLazy.clear();
+   m_branchRowsGeneric.clear();
 
-   if (m_param.BranchEnforceInMaster) {
+   if (m_param.BranchEnforceInMaster && !m_branchLazy) {
       m_nRowsBranch = 2 * nIntVars;
    } else {
       m_nRowsBranch = 0;
@@ -834,7 +975,7 @@ void DecompAlgo::createMasterProblem(DecompVarList& initVars)
    //---   We want to add these directly to the core so as to facilitate
    //---   operations to expand rows. Basically, we treat these just like cuts.
    //---
-   if (m_param.BranchEnforceInMaster) {
+   if (m_param.BranchEnforceInMaster && !m_branchLazy) {
       coreMatrixAppendColBounds();
    }
 
@@ -861,10 +1002,9 @@ void DecompAlgo::createMasterProblem(DecompVarList& initVars)
    double*            colLB    = new double[nColsMax];
    double*            colUB    = new double[nColsMax];
    double*            objCoeff = new double[nColsMax];
-   double*            denseCol = new double[nRows];
    CoinPackedMatrix* masterM  = new CoinPackedMatrix(true, 0, 0);
    vector<string>     colNames;
-   assert(colLB && colUB && objCoeff && denseCol && masterM);
+   assert(colLB && colUB && objCoeff && masterM);
    //---
    //--- set the number of rows, we will add columns
    //---
@@ -909,100 +1049,15 @@ void DecompAlgo::createMasterProblem(DecompVarList& initVars)
                           objCoeff,
                           colNames,
                           startRow, endRow, DecompRow_Convex);
-   int colIndex     = 0;
-   int blockIndex   = 0;
-   DecompVarList::iterator li;
-
-   //TODO:
-   //  this should be calling a function to add var to lp so don't dup code
-   //TODO:
-   //  check for duplicates in initVars
-   for (li = initVars.begin(); li != initVars.end(); li++) {
-      //---
-      //--- appending these variables (lambda) to end of matrix
-      //---   after the artificials
-      //---
-      colIndex         = masterM->getNumCols();
-      m_colIndexUnique = colIndex;
-      //---
-      //--- store the col index for this var in the master LP
-      //---   NOTE: if we remove columns, this will be wrong
-      //---
-      (*li)->setColMasterIndex(colIndex);
-      //---
-      //--- we expect the user to define the block id in the var object
-      //---
-      blockIndex = (*li)->getBlockId();
-      //---
-      //--- give the column a name
-      //---
-      string colName;
-
-      if ((*li)->getVarType() == DecompVar_Point) {
-         //         std::cout << "The generated variable type is "
-         //           << DecompVar_Point << std::endl;
-         colName = "lam(c_" + UtilIntToStr(m_colIndexUnique)
-                   + ",b_" + UtilIntToStr(blockIndex) + ")";
-      } else if ((*li)->getVarType() == DecompVar_Ray) {
-         //         std::cout << "The generated variable type is "
-         //           << DecompVar_Ray << std::endl;
-         colName = "theta(c_" + UtilIntToStr(m_colIndexUnique)
-                   + ",b_" + UtilIntToStr(blockIndex) + ")";
-      }
-
-      colNames.push_back(colName);
-      UTIL_DEBUG(m_param.LogDebugLevel, 5,
-                 (*li)->print(m_infinity, m_osLog, m_app);
-                );
-      //---
-      //--- get dense column = A''s, append convexity constraint on end
-      //---   this memory is re-used, so be sure to clear out
-      //---
-      //STOP: see addVarsToPool - here init, so no cuts to deal with
-      // but we don't use dense array here - make a difference?
-      //modelCore->M->times((*li)->m_s, denseCol);
-      (*li)->fillDenseArr(modelCore->getNumCols(),
-                          dblArrNCoreCols);
-      modelCore->M->times(dblArrNCoreCols, denseCol);
-      UtilFillN(denseCol + nRowsCore, m_numConvexCon, 0.0);
-      assert(blockIndex >= 0);
-      assert(blockIndex < m_numConvexCon);
-      denseCol[nRowsCore + blockIndex] = 1.0;
-
-      if ((*li)->getVarType() == DecompVar_Ray) {
-         denseCol[nRowsCore + blockIndex] = 0.0;
-      }
-
-      //---
-      //--- create a sparse column from the dense column
-      //---
-      // THINK: do i need a DecompCol?
-      // THINK: does this allocate memory for coinpackedvec twice?
-      CoinPackedVector* sparseCol
-      = UtilPackedVectorFromDense(nRowsCore + m_numConvexCon,
-                                  denseCol, m_param.TolZero);
-      UTIL_DEBUG(m_param.LogDebugLevel, 5,
-                 (*m_osLog) << "\nSparse Col: \n";
-                 UtilPrintPackedVector(*sparseCol, m_osLog);
-                );
-      //TODO: check for duplicates (against m_vars)
-      //      or force initVars to be sent in with no dups?
-      //---
-      //--- append the sparse column to the matrix
-      //---
-      masterM->appendCol(*sparseCol);
-      colLB[colIndex]    = 0.0;
-      colUB[colIndex]    = m_infinity;
-      objCoeff[colIndex] = 0.0;       //PHASE I
-      //---
-      //--- set master column type
-      //---
-      m_masterColType.push_back(DecompCol_Structural);
-      //---
-      //--- clean-up
-      //---
-      UTIL_DELPTR(sparseCol);
-   } //END: for(li = initVars.begin(); li != initVars.end(); li++)
+   //---
+   //--- append the initial variables (lambda) after the artificials
+   //---
+   masterMatrixAddVarCols(masterM,
+                          initVars,
+                          colLB,
+                          colUB,
+                          objCoeff,
+                          colNames);
 
    //---
    //--- insert the initial set of variables into the master variable list
@@ -1065,9 +1120,10 @@ void DecompAlgo::createMasterProblem(DecompVarList& initVars)
                            &masterRowLB[0],
                            &masterRowUB[0]);
    //---
-   //--- load column and row names to OSI
+   //--- load column and row names to OSI (none in low-memory mode)
    //---
-   int nRowNames = static_cast<int>(modelCore->rowNames.size());
+   int nRowNames = m_param.LowMemory ? 0 :
+                   static_cast<int>(modelCore->rowNames.size());
    int nColNames = static_cast<int>(colNames.size());
 
    if (nRowNames || nColNames) {
@@ -1119,16 +1175,180 @@ void DecompAlgo::createMasterProblem(DecompVarList& initVars)
    //--- free local memory
    //---
    UTIL_DELPTR(masterM);
-   UTIL_DELARR(denseCol);
    UTIL_DELARR(colLB);
    UTIL_DELARR(colUB);
    UTIL_DELARR(objCoeff);
    UTIL_DELARR(zeroSol);
-   UTIL_DELARR(dblArrNCoreCols);
    UtilPrintFuncEnd(m_osLog, m_classTag,
                     "createMasterProblem()", m_param.LogDebugLevel, 2);
 }
 
+//===========================================================================//
+void DecompAlgo::masterMatrixAddVarCols(CoinPackedMatrix* masterM,
+                                        DecompVarList&     vars,
+                                        double*            colLB,
+                                        double*            colUB,
+                                        double*            objCoeff,
+                                        vector<string>&    colNames)
+{
+   int nVars = static_cast<int>(vars.size());
+
+   if (nVars <= 0) {
+      return;
+   }
+
+   DecompConstraintSet* modelCore = m_modelCore.getModel();
+   assert(modelCore);
+   const int nRowsCore = modelCore->getNumRows();
+   //---
+   //--- A''s is computed from the columns of A'' touched by s, so we
+   //---   need a col-ordered copy of the core matrix
+   //---
+   CoinPackedMatrix matrixCoreTmp(*modelCore->getMatrix());
+
+   if (!matrixCoreTmp.isColOrdered()) {
+      matrixCoreTmp.reverseOrdering();
+   }
+
+   const CoinBigIndex* coreBeg = matrixCoreTmp.getVectorStarts();
+   const int*          coreLen = matrixCoreTmp.getVectorLengths();
+   const int*          coreInd = matrixCoreTmp.getIndices();
+   const double*       coreEls = matrixCoreTmp.getElements();
+   const int           nColsTmp = matrixCoreTmp.getNumCols();
+   vector<DecompVar*>  varVec(vars.begin(), vars.end());
+   vector< vector<int> >    colInd(nVars);
+   vector< vector<double> > colEls(nVars);
+   //---
+   //--- the columns are independent, compute them in parallel
+   //---   (each thread has its own sparse accumulator)
+   //---
+#ifdef _OPENMP
+   #pragma omp parallel
+#endif
+   {
+      vector<double> work(nRowsCore, 0.0);
+      vector<char>   mark(nRowsCore, 0);
+      vector<int>    touched;
+#ifdef _OPENMP
+      #pragma omp for schedule(dynamic, 64)
+#endif
+
+      for (int v = 0; v < nVars; v++) {
+         const CoinPackedVector& s    = varVec[v]->m_s;
+         const int*              sInd = s.getIndices();
+         const double*           sEls = s.getElements();
+         touched.clear();
+
+         for (int k = 0; k < s.getNumElements(); k++) {
+            const int j = sInd[k];
+
+            if (j < 0 || j >= nColsTmp) {
+               continue;
+            }
+
+            for (CoinBigIndex p = coreBeg[j]; p < coreBeg[j] + coreLen[j]; p++) {
+               const int r = coreInd[p];
+
+               if (!mark[r]) {
+                  mark[r] = 1;
+                  touched.push_back(r);
+               }
+
+               work[r] += coreEls[p] * sEls[k];
+            }
+         }
+
+         sort(touched.begin(), touched.end());
+         vector<int>&    ind = colInd[v];
+         vector<double>& els = colEls[v];
+         ind.reserve(touched.size() + 1);
+         els.reserve(touched.size() + 1);
+
+         for (size_t k = 0; k < touched.size(); k++) {
+            const int r = touched[k];
+
+            if (fabs(work[r]) > m_param.TolZero) {
+               ind.push_back(r);
+               els.push_back(work[r]);
+            }
+
+            work[r] = 0.0;
+            mark[r] = 0;
+         }
+
+         //---
+         //--- convexity constraint (points only)
+         //---
+         if (varVec[v]->getVarType() == DecompVar_Point) {
+            ind.push_back(nRowsCore + varVec[v]->getBlockId());
+            els.push_back(1.0);
+         }
+      }
+   }
+
+   //---
+   //--- append all the columns at once
+   //---
+   vector<CoinBigIndex> colBeg(nVars + 1, 0);
+
+   for (int v = 0; v < nVars; v++) {
+      colBeg[v + 1] = colBeg[v] + static_cast<CoinBigIndex>(colInd[v].size());
+   }
+
+   vector<int>    ind;
+   vector<double> els;
+   ind.reserve(colBeg[nVars]);
+   els.reserve(colBeg[nVars]);
+
+   for (int v = 0; v < nVars; v++) {
+      ind.insert(ind.end(), colInd[v].begin(), colInd[v].end());
+      els.insert(els.end(), colEls[v].begin(), colEls[v].end());
+   }
+
+   const int colIndex0 = masterM->getNumCols();
+   masterM->appendCols(nVars, &colBeg[0],
+                       ind.empty() ? NULL : &ind[0],
+                       els.empty() ? NULL : &els[0]);
+
+   //---
+   //--- set lb, ub, obj (phase I), names and master index
+   //---
+   for (int v = 0; v < nVars; v++) {
+      const int colIndex   = colIndex0 + v;
+      const int blockIndex = varVec[v]->getBlockId();
+      assert(blockIndex >= 0);
+      assert(blockIndex < m_numConvexCon);
+      m_colIndexUnique = colIndex;
+      //---
+      //--- store the col index for this var in the master LP
+      //---   NOTE: if we remove columns, this will be wrong
+      //---
+      varVec[v]->setColMasterIndex(colIndex);
+
+      if (!m_param.LowMemory) {
+         string colName;
+
+         if (varVec[v]->getVarType() == DecompVar_Point) {
+            colName = "lam(c_" + UtilIntToStr(m_colIndexUnique)
+                      + ",b_" + UtilIntToStr(blockIndex) + ")";
+         } else if (varVec[v]->getVarType() == DecompVar_Ray) {
+            colName = "theta(c_" + UtilIntToStr(m_colIndexUnique)
+                      + ",b_" + UtilIntToStr(blockIndex) + ")";
+         }
+
+         colNames.push_back(colName);
+      }
+
+      UTIL_DEBUG(m_param.LogDebugLevel, 5,
+                 varVec[v]->print(m_infinity, m_osLog, m_app);
+                );
+      colLB[colIndex]    = 0.0;
+      colUB[colIndex]    = m_infinity;
+      objCoeff[colIndex] = 0.0;       //PHASE I
+      m_masterColType.push_back(DecompCol_Structural);
+   }
+}
+
 //===========================================================================//
 
 void DecompAlgo::masterMatrixAddMOCols(CoinPackedMatrix* masterM,
@@ -1148,7 +1368,6 @@ void DecompAlgo::masterMatrixAddMOCols(CoinPackedMatrix* masterM,
    assert(!modelCore->isSparse());
    const double*          colLBCore    = modelCore->getColLB();
    const double*          colUBCore    = modelCore->getColUB();
-   const vector<string>& colNamesCore = modelCore->getColNames();
    //---
    //--- add the submatrix for core rows cross master-only columns
    //---     to the master formulation (this will be a col-ordered matrix)
@@ -1208,7 +1427,10 @@ void DecompAlgo::masterMatrixAddMOCols(CoinPackedMatrix* masterM,
       colLB[k]    = colLBCore[j];
       colUB[k]    = colUBCore[j];
       objCoeff[k] = 0;
-      colNames.push_back(colNamesCore[j]);
+      if (!m_param.LowMemory) {
+         colNames.push_back(modelCore->getColName(j));
+      }
+
       m_masterColType.push_back(DecompCol_MasterOnly);
       //m_masterColType.push_back(DecompCol_Structural_NoDelete);
       m_masterOnlyColsMap.insert(make_pair(j, k));
@@ -1277,7 +1499,8 @@ void DecompAlgo::masterMatrixAddArtCols(CoinPackedMatrix* masterM,
    vector<char>&    rowSense  = modelCore->rowSense;
    vector<string>& rowNames  = modelCore->rowNames;
    int              nCoreRows = modelCore->getNumRows();
-   bool             hasNames  = rowNames.empty() ? false : true;
+   bool             hasNames  = rowNames.empty() || m_param.LowMemory ?
+                                false : true;
    int              r, colIndex;
    string           colName, strIndex, colNameL, colNameG;
    DecompColType    colTypeL, colTypeG;
@@ -1413,14 +1636,16 @@ void DecompAlgo::coreMatrixAppendColBounds()
    int       i, j;
    char      sense;
    double    rhs;
-   bool      doNames = true; //TODO: make an option
    DecompConstraintSet* modelCore   = m_modelCore.getModel();
    const int             nIntVars    = modelCore->getNumInts();
    const double*         colLBCore   = modelCore->getColLB();
    const double*         colUBCore   = modelCore->getColUB();
    const int*            integerVars = modelCore->getIntegerVars();
-   vector<string>&       colNames    = modelCore->getColNamesMutable();
    vector<string>&       rowNames    = modelCore->getRowNamesMutable();
+   //---
+   //--- the core row names, if any, are kept in line with the rows
+   //---
+   const bool            doNames     = !rowNames.empty();
    //TODO: use mem pool? or just create block (identity) if doing PC?
    const int   numRows   = 2 * nIntVars;
    int*        rowStarts = new int[numRows + 1];
@@ -1467,7 +1692,7 @@ void DecompAlgo::coreMatrixAppendColBounds()
          rhs   = colUBCore[j];
 
          if (doNames) {
-            string rowName = "ub(" + colNames[j] + ")";
+            string rowName = "ub(" + modelCore->getColName(j) + ")";
             rowNames.push_back(rowName);
          }
       } else {
@@ -1479,7 +1704,7 @@ void DecompAlgo::coreMatrixAppendColBounds()
          rhs   = colLBCore[j];
 
          if (doNames) {
-            string rowName = "lb(" + colNames[j] + ")";
+            string rowName = "lb(" + modelCore->getColName(j) + ")";
             rowNames.push_back(rowName);
          }
       }
@@ -1502,49 +1727,650 @@ void DecompAlgo::coreMatrixAppendColBounds()
 }
 
 //===========================================================================//
-void DecompAlgo::breakOutPartial(const double*   xHat,
-                                 DecompVarList& newVars,
-                                 const double    intTol)
+void DecompAlgo::setMasterBranchRows(const double* lbs,
+                                     const double* ubs)
 {
-   if (m_numConvexCon <= 1) {
-      return;
-   }
-
-   UtilPrintFuncBegin(m_osLog, m_classTag,
-                      "breakOutPartial()", m_param.LogDebugLevel, 1);
-   //TODO: what if modelRelax is not defined?
-   //TODO: if lambda=1, don't bother, it means the partial
-   //  is already there
-   DecompConstraintSet* modelCore  = m_modelCore.getModel();
-   const char*           integerMark = modelCore->getIntegerMark();
    //---
-   //--- for each block, check to see if active integer columns
-   //---  are integral - if so, use these as candidate columns
+   //--- The rows x <= u and x >= l of a column are made the first time
+   //---   its bounds at a node are tighter than in the core. At later
+   //---   nodes they get that node's bounds, or are deleted if the
+   //---   column is not branched on there, so the master only has the
+   //---   rows of the columns branched on along the current path.
+   //---   Master-only columns have no rows, their bounds are set on the
+   //---   master column directly.
    //---
-   const double* objCoeff = getOrigObjective();
-   map<int, DecompSubModel>::iterator mit;
-   vector<int>::const_iterator         vit;
+   int                   c, coreColIndex, r;
+   DecompConstraintSet* modelCore   = m_modelCore.getModel();
+   const int             nIntVars    = modelCore->getNumInts();
+   const int*            integerVars = modelCore->getIntegerVars();
+   const double*         colLBCore   = modelCore->getColLB();
+   const double*         colUBCore   = modelCore->getColUB();
+   map<int, int>::iterator mit;
+   vector<int>              index;
+   vector<double>           bounds;
+   vector<int>              newCols;
+   vector<CoinPackedVector> newRows;
+   vector<string>           newNames;
+   vector<double>           newLB, newUB;
+   vector<int>              delRows;
+
+   for (mit = m_branchRowsLazy.begin(); mit != m_branchRowsLazy.end();) {
+      coreColIndex = mit->first;
+
+      if (lbs[coreColIndex] > colLBCore[coreColIndex] + DecompEpsilon ||
+            ubs[coreColIndex] < colUBCore[coreColIndex] - DecompEpsilon) {
+         mit++;
+         continue;
+      }
 
-   for (mit = m_modelRelax.begin(); mit != m_modelRelax.end(); mit++) {
-      DecompSubModel&      subModel      = (*mit).second;
-      DecompConstraintSet* model         = subModel.getModel();
-      int                   b            = subModel.getBlockId();
-      const vector<int>&    activeCols   = model->getActiveColumns();
-      bool blockFeasible = true;
+      delRows.push_back(mit->second);
+      delRows.push_back(mit->second + 1);
+      m_branchRowsLazy.erase(mit++);
+   }
 
-      for (vit = activeCols.begin(); vit != activeCols.end(); vit++) {
-         if (integerMark[*vit] != 'I') {
-            continue;
-         }
+   if (!delRows.empty()) {
+      masterDeleteBranchRows(delRows);
+   }
 
-         if (!(UtilIsIntegral(xHat[*vit], intTol))) {
-            blockFeasible = false;
-            break;
-         }
+   for (c = 0; c < nIntVars; c++) {
+      coreColIndex = integerVars[c];
+      mit = m_masterOnlyColsMap.find(coreColIndex);
+
+      if (mit != m_masterOnlyColsMap.end()) {
+         m_masterSI->setColBounds(mit->second,
+                                  lbs[coreColIndex], ubs[coreColIndex]);
+         continue;
       }
 
-      if (blockFeasible) {
-         vector<int>    ind;
+      if (m_branchRowsLazy.find(coreColIndex) == m_branchRowsLazy.end() &&
+            (lbs[coreColIndex] > colLBCore[coreColIndex] + DecompEpsilon ||
+             ubs[coreColIndex] < colUBCore[coreColIndex] - DecompEpsilon)) {
+         CoinPackedVector row;
+         row.insert(coreColIndex, 1.0);
+         newCols.push_back(coreColIndex);
+         newRows.push_back(row);
+         newNames.push_back(modelCore->getColName(coreColIndex));
+         newLB.push_back(colLBCore[coreColIndex]);
+         newUB.push_back(colUBCore[coreColIndex]);
+      }
+   }
+
+   if (!newRows.empty()) {
+      r = masterAppendBranchRows(newRows, newNames, newLB, newUB);
+
+      for (c = 0; c < static_cast<int>(newCols.size()); c++) {
+         m_branchRowsLazy.insert(make_pair(newCols[c], r + 2 * c));
+      }
+   }
+
+   for (mit = m_branchRowsLazy.begin(); mit != m_branchRowsLazy.end(); mit++) {
+      //x <= u, x >= l
+      coreColIndex = mit->first;
+      r            = mit->second;
+      assert(m_masterRowType[r]     == DecompRow_Branch);
+      assert(m_masterRowType[r + 1] == DecompRow_Branch);
+      index.push_back(r);
+      bounds.push_back(-m_infinity);
+      bounds.push_back(ubs[coreColIndex]);
+      index.push_back(r + 1);
+      bounds.push_back(lbs[coreColIndex]);
+      bounds.push_back(m_infinity);
+   }
+
+   if (!index.empty()) {
+      m_masterSI->setRowSetBounds(&index[0],
+                                  &index[0] + index.size(), &bounds[0]);
+   }
+
+   UTIL_MSG(m_param.LogDebugLevel, 3,
+            (*m_osLog) << "Branching rows in master: "
+            << 2 * m_branchRowsLazy.size()
+            << " (" << 2 * newCols.size() << " new, "
+            << delRows.size() << " deleted)\n";
+           );
+}
+
+//===========================================================================//
+void DecompAlgo::masterDeleteBranchRows(vector<int>& delRows)
+{
+   //---
+   //--- The branching rows (made on demand) are after the convexity rows
+   //---   in the master; row r is row r - m_numConvexCon of the core.
+   //---   Deleting them (and their artificial columns) renumbers the
+   //---   master rows and columns after them, so every index kept into
+   //---   the master is mapped to its new value.
+   //---
+   DecompConstraintSet* modelCore = m_modelCore.getModel();
+   const int            nRowsOld  = m_masterSI->getNumRows();
+   const int            nColsOld  = m_masterSI->getNumCols();
+   vector<int>          newRow(nRowsOld, 0);
+   vector<int>          newCol(nColsOld, 0);
+   vector<int>          delCols, coreRows;
+   int                  r, c, k;
+   sort(delRows.begin(), delRows.end());
+
+   for (k = 0; k < static_cast<int>(delRows.size()); k++) {
+      r = delRows[k];
+      assert(m_masterRowType[r] == DecompRow_Branch);
+      assert(r >= modelCore->nBaseRows + m_numConvexCon);
+      newRow[r] = -1;
+      coreRows.push_back(r - m_numConvexCon);
+   }
+
+   //---
+   //--- the artificial column of a branching row has just that row
+   //---
+   const CoinPackedMatrix* colM = m_masterSI->getMatrixByCol();
+
+   for (c = 0; c < nColsOld; c++) {
+      if (m_masterColType[c] != DecompCol_ArtForBranchL &&
+            m_masterColType[c] != DecompCol_ArtForBranchG) {
+         continue;
+      }
+
+      const CoinShallowPackedVector col = colM->getVector(c);
+
+      if (col.getNumElements() == 1 && newRow[col.getIndices()[0]] < 0) {
+         delCols.push_back(c);
+         newCol[c] = -1;
+      }
+   }
+
+   for (r = 0, k = 0; r < nRowsOld; r++) {
+      if (newRow[r] >= 0) {
+         newRow[r] = k++;
+      }
+   }
+
+   for (c = 0, k = 0; c < nColsOld; c++) {
+      if (newCol[c] >= 0) {
+         newCol[c] = k++;
+      }
+   }
+
+   if (!delCols.empty()) {
+      m_masterSI->deleteCols(static_cast<int>(delCols.size()), &delCols[0]);
+   }
+
+   m_masterSI->deleteRows(static_cast<int>(delRows.size()), &delRows[0]);
+   //---
+   //--- master columns
+   //---
+   DecompVarList::iterator li;
+
+   for (li = m_vars.begin(); li != m_vars.end(); li++) {
+      (*li)->setColMasterIndex(newCol[(*li)->getColMasterIndex()]);
+   }
+
+   for (c = 0, k = 0; c < nColsOld; c++) {
+      if (newCol[c] >= 0) {
+         m_masterColType[k++] = m_masterColType[c];
+      }
+   }
+
+   m_masterColType.resize(k);
+   vector<int> artCols;
+
+   for (k = 0; k < static_cast<int>(m_masterArtCols.size()); k++) {
+      c = m_masterArtCols[k];
+
+      if (c < nColsOld && newCol[c] >= 0) {
+         artCols.push_back(newCol[c]);
+      }
+   }
+
+   m_masterArtCols.swap(artCols);
+   map<int, int>           artToRow;
+   map<int, int>::iterator mit;
+
+   for (mit  = m_artColIndToRowInd.begin();
+         mit != m_artColIndToRowInd.end(); mit++) {
+      if (mit->first  < nColsOld && newCol[mit->first]  >= 0 &&
+            mit->second < nRowsOld && newRow[mit->second] >= 0) {
+         artToRow.insert(make_pair(newCol[mit->first], newRow[mit->second]));
+      }
+   }
+
+   m_artColIndToRowInd.swap(artToRow);
+
+   for (mit  = m_masterOnlyColsMap.begin();
+         mit != m_masterOnlyColsMap.end(); mit++) {
+      mit->second = newCol[mit->second];
+   }
+
+   //---
+   //--- master rows
+   //---
+   for (r = 0, k = 0; r < nRowsOld; r++) {
+      if (newRow[r] >= 0) {
+         m_masterRowType[k++] = m_masterRowType[r];
+      }
+   }
+
+   m_masterRowType.resize(k);
+
+   for (mit = m_branchRowsLazy.begin(); mit != m_branchRowsLazy.end(); mit++) {
+      mit->second = newRow[mit->second];
+   }
+
+   map<string, int>::iterator git;
+
+   for (git  = m_branchRowsGeneric.begin();
+         git != m_branchRowsGeneric.end(); git++) {
+      git->second = newRow[git->second];
+   }
+
+   //---
+   //--- core rows
+   //---
+   const int       nCoreRowsOld = modelCore->getNumRows();
+   vector<char>    isDel(nCoreRowsOld, 0);
+   vector<string>& coreRowNames = modelCore->getRowNamesMutable();
+   modelCore->M->deleteRows(static_cast<int>(coreRows.size()), &coreRows[0]);
+
+   for (k = 0; k < static_cast<int>(coreRows.size()); k++) {
+      isDel[coreRows[k]] = 1;
+   }
+
+   for (r = 0, k = 0; r < nCoreRowsOld; r++) {
+      if (isDel[r]) {
+         continue;
+      }
+
+      modelCore->rowLB[k]    = modelCore->rowLB[r];
+      modelCore->rowUB[k]    = modelCore->rowUB[r];
+      modelCore->rowSense[k] = modelCore->rowSense[r];
+      modelCore->rowRhs[k]   = modelCore->rowRhs[r];
+      modelCore->rowHash[k]  = modelCore->rowHash[r];
+
+      if (!coreRowNames.empty()) {
+         coreRowNames[k] = coreRowNames[r];
+      }
+
+      k++;
+   }
+
+   modelCore->rowLB.resize(k);
+   modelCore->rowUB.resize(k);
+   modelCore->rowSense.resize(k);
+   modelCore->rowRhs.resize(k);
+   modelCore->rowHash.resize(k);
+
+   if (!coreRowNames.empty()) {
+      coreRowNames.resize(k);
+   }
+
+   assert(m_masterSI->getNumRows() == static_cast<int>(m_masterRowType.size()));
+   assert(m_masterSI->getNumCols() == static_cast<int>(m_masterColType.size()));
+   assert(modelCore->getNumRows()  == m_masterSI->getNumRows() - m_numConvexCon);
+   //---
+   //--- the columns in the var pool and the cuts in the cut pool are
+   //---   expanded against the rows
+   //---
+   m_varpool.setColsAreValid(false);
+   m_cutpool.setRowsAreValid(false);
+}
+
+//===========================================================================//
+int DecompAlgo::masterAppendBranchRows(const vector<CoinPackedVector>& rows,
+                                       const vector<string>&           names,
+                                       const vector<double>&           rowLB,
+                                       const vector<double>&           rowUB)
+{
+   DecompConstraintSet* modelCore    = m_modelCore.getModel();
+   vector<string>&       coreRowNames = modelCore->getRowNamesMutable();
+   const int             nRows        = static_cast<int>(rows.size());
+   const int             nNewRows     = 2 * nRows;
+   const int             rowIndex0    = m_masterSI->getNumRows();
+   const int             colIndex0    = m_masterSI->getNumCols();
+   vector<string>        rowNames, colNames;
+   int                   i, k, r, colIndex;
+   //---
+   //--- names for the master (not in low-memory mode) and for the core,
+   //---   if its rows have names
+   //---
+   const bool            doNamesMaster = !m_param.LowMemory;
+   const bool            doNames       = doNamesMaster || !coreRowNames.empty();
+   //---
+   //--- the rows in terms of lambda: the coefficient of var s in the
+   //---   rows of a x is a s
+   //---
+   map<int, vector< pair<int, double> > > colToRows;
+   map<int, vector< pair<int, double> > >::iterator mit;
+   vector<CoinPackedVector> rowReform(nNewRows);
+   DecompVarList::iterator  li;
+
+   for (i = 0; i < nRows; i++) {
+      const int*    ind = rows[i].getIndices();
+      const double* els = rows[i].getElements();
+
+      for (k = 0; k < rows[i].getNumElements(); k++) {
+         colToRows[ind[k]].push_back(make_pair(i, els[k]));
+      }
+   }
+
+   for (li = m_vars.begin(); li != m_vars.end(); li++) {
+      const CoinPackedVector& s    = (*li)->m_s;
+      const int*              sInd = s.getIndices();
+      const double*           sEls = s.getElements();
+      vector<double>          act(nRows, 0.0);
+      vector<char>            seen(nRows, 0);
+      vector<int>             touched;
+
+      for (k = 0; k < s.getNumElements(); k++) {
+         mit = colToRows.find(sInd[k]);
+
+         if (mit == colToRows.end()) {
+            continue;
+         }
+
+         for (size_t t = 0; t < mit->second.size(); t++) {
+            i = mit->second[t].first;
+
+            if (!seen[i]) {
+               seen[i] = 1;
+               touched.push_back(i);
+            }
+
+            act[i] += mit->second[t].second * sEls[k];
+         }
+      }
+
+      for (size_t t = 0; t < touched.size(); t++) {
+         i = touched[t];
+
+         if (act[i] != 0.0) {
+            rowReform[2 * i    ].insert((*li)->getColMasterIndex(), act[i]);
+            rowReform[2 * i + 1].insert((*li)->getColMasterIndex(), act[i]);
+         }
+      }
+   }
+
+   //---
+   //--- add the new (lambda) rows to master
+   //--- add the new (x)      rows to core
+   //--- add the master row types, names, bounds and hashes
+   //---
+   const CoinPackedVectorBase** rowReformBlock =
+      new const CoinPackedVectorBase*[nNewRows];
+   const CoinPackedVectorBase** rowBlock       =
+      new const CoinPackedVectorBase*[nNewRows];
+   double* rlb = new double[nNewRows];
+   double* rub = new double[nNewRows];
+   assert(rowReformBlock && rowBlock && rlb && rub);
+
+   for (i = 0; i < nRows; i++) {
+      r = 2 * i;
+      //a x <= u
+      rlb[r] = -m_infinity;
+      rub[r] = rowUB[i];
+      //a x >= l
+      rlb[r + 1] = rowLB[i];
+      rub[r + 1] = m_infinity;
+      rowReformBlock[r]     = &rowReform[r];
+      rowReformBlock[r + 1] = &rowReform[r + 1];
+      rowBlock[r]           = &rows[i];
+      rowBlock[r + 1]       = &rows[i];
+   }
+
+   m_masterSI->addRows(nNewRows, rowReformBlock, rlb, rub);
+   modelCore->M->appendRows(nNewRows, rowBlock);
+
+   for (i = 0; i < nRows; i++) {
+      const int     len = rows[i].getNumElements();
+      const int*    ind = rows[i].getIndices();
+      const double* els = rows[i].getElements();
+      modelCore->rowLB.push_back(-m_infinity);
+      modelCore->rowUB.push_back(rowUB[i]);
+      modelCore->rowSense.push_back('L');
+      modelCore->rowRhs.push_back(rowUB[i]);
+      modelCore->rowHash.push_back(UtilCreateStringHash(len, ind, els, 'L',
+                                   rowUB[i], m_infinity));
+      modelCore->rowLB.push_back(rowLB[i]);
+      modelCore->rowUB.push_back(m_infinity);
+      modelCore->rowSense.push_back('G');
+      modelCore->rowRhs.push_back(rowLB[i]);
+      modelCore->rowHash.push_back(UtilCreateStringHash(len, ind, els, 'G',
+                                   rowLB[i], m_infinity));
+      m_masterRowType.push_back(DecompRow_Branch);
+      m_masterRowType.push_back(DecompRow_Branch);
+
+      if (doNames) {
+         rowNames.push_back("ub(" + names[i] + ")");
+         rowNames.push_back("lb(" + names[i] + ")");
+      }
+   }
+
+   if (!coreRowNames.empty()) {
+      coreRowNames.insert(coreRowNames.end(), rowNames.begin(), rowNames.end());
+   }
+
+   //---
+   //--- one artificial column per row, set up for the current phase
+   //---
+   const bool phaseI = m_phase == PHASE_PRICE1;
+   colIndex = colIndex0;
+
+   for (r = 0; r < nNewRows; r++) {
+      CoinPackedVector artCol;
+      const bool       isL = (r % 2) == 0;
+      artCol.insert(rowIndex0 + r, isL ? -1.0 : 1.0);
+      m_masterSI->addCol(artCol, 0.0,
+                         phaseI ? m_infinity : 0.0,
+                         phaseI ? 1.0        : 0.0);
+      m_masterColType.push_back(isL ? DecompCol_ArtForBranchL :
+                                DecompCol_ArtForBranchG);
+      m_masterArtCols.push_back(colIndex);
+      m_artColIndToRowInd.insert(make_pair(colIndex, rowIndex0 + r));
+
+      if (doNamesMaster) {
+         colNames.push_back((isL ? "sBL(c_" : "sBG(c_")
+                            + UtilIntToStr(colIndex) + "_" + rowNames[r] + ")");
+      }
+
+      colIndex++;
+   }
+
+   if (doNamesMaster) {
+      m_masterSI->setRowNames(rowNames, 0, nNewRows, rowIndex0);
+      m_masterSI->setColNames(colNames, 0, nNewRows, colIndex0);
+   }
+   //---
+   //--- the columns in the var pool need the new rows
+   //---
+   m_varpool.setColsAreValid(false);
+   UTIL_DELARR(rowReformBlock);
+   UTIL_DELARR(rowBlock);
+   UTIL_DELARR(rlb);
+   UTIL_DELARR(rub);
+   return rowIndex0;
+}
+
+//===========================================================================//
+void DecompAlgo::setBranchRows(const vector<DecompBranchRow>& rows)
+{
+   UtilPrintFuncBegin(m_osLog, m_classTag,
+                      "setBranchRows()", m_param.LogDebugLevel, 2);
+   m_branchRows = rows;
+   //---
+   //--- master rows: the bounds of rows with the same name are merged
+   //---   (a sum can be bounded from both sides along a path), rows of
+   //---   other nodes are deleted; rows not in the master yet are
+   //---   appended with free bounds
+   //---
+   size_t                           i;
+   int                              r;
+   map<string, pair<double, double> > active;
+   map<string, pair<double, double> >::iterator ait;
+   map<string, int>::iterator       mit;
+   vector<CoinPackedVector>         newRows;
+   vector<string>                   newNames;
+
+   for (i = 0; i < rows.size(); i++) {
+      const DecompBranchRow& row = rows[i];
+
+      if (row.type != DecompBranchRow_Master) {
+         continue;
+      }
+
+      ait = active.find(row.name);
+
+      if (ait == active.end()) {
+         active.insert(make_pair(row.name, make_pair(row.lb, row.ub)));
+      } else {
+         ait->second.first  = std::max(ait->second.first,  row.lb);
+         ait->second.second = std::min(ait->second.second, row.ub);
+      }
+
+      if (m_branchRowsGeneric.find(row.name) == m_branchRowsGeneric.end() &&
+            std::find(newNames.begin(), newNames.end(), row.name) ==
+            newNames.end()) {
+         CoinPackedVector v(static_cast<int>(row.ind.size()),
+                            &row.ind[0], &row.els[0]);
+         newRows.push_back(v);
+         newNames.push_back(row.name);
+      }
+   }
+
+   vector<int> delRows;
+
+   for (mit = m_branchRowsGeneric.begin(); mit != m_branchRowsGeneric.end();) {
+      if (active.find(mit->first) != active.end()) {
+         mit++;
+         continue;
+      }
+
+      delRows.push_back(mit->second);
+      delRows.push_back(mit->second + 1);
+      m_branchRowsGeneric.erase(mit++);
+   }
+
+   if (!delRows.empty()) {
+      masterDeleteBranchRows(delRows);
+   }
+
+   if (!newRows.empty()) {
+      vector<double> freeLB(newRows.size(), -m_infinity);
+      vector<double> freeUB(newRows.size(),  m_infinity);
+      r = masterAppendBranchRows(newRows, newNames, freeLB, freeUB);
+
+      for (i = 0; i < newNames.size(); i++) {
+         m_branchRowsGeneric.insert(make_pair(newNames[i],
+                                              r + 2 * static_cast<int>(i)));
+      }
+   }
+
+   vector<int>    index;
+   vector<double> bounds;
+
+   for (mit  = m_branchRowsGeneric.begin();
+         mit != m_branchRowsGeneric.end(); mit++) {
+      ait = active.find(mit->first);
+      r   = mit->second;
+      index.push_back(r);
+      bounds.push_back(-m_infinity);
+      bounds.push_back(ait != active.end() ? ait->second.second : m_infinity);
+      index.push_back(r + 1);
+      bounds.push_back(ait != active.end() ? ait->second.first : -m_infinity);
+      bounds.push_back(m_infinity);
+   }
+
+   if (!index.empty()) {
+      m_masterSI->setRowSetBounds(&index[0],
+                                  &index[0] + index.size(), &bounds[0]);
+   }
+
+   //---
+   //--- column rows: fix to 0 the master columns that violate them
+   //---   (setMasterBounds has already unfixed the ones that satisfy
+   //---   the node's bounds)
+   //---
+   DecompConstraintSet*    modelCore = m_modelCore.getModel();
+   const int               nCols     = modelCore->getNumCols();
+   DecompVarList::iterator li;
+   vector<double>          denseS(nCols, 0.0);
+   int                     nFixed    = 0;
+
+   for (i = 0; i < rows.size(); i++) {
+      if (rows[i].type == DecompBranchRow_Column) {
+         break;
+      }
+   }
+
+   if (i < rows.size()) {
+      for (li = m_vars.begin(); li != m_vars.end(); li++) {
+         (*li)->fillDenseArr(nCols, &denseS[0]);
+
+         for (i = 0; i < rows.size(); i++) {
+            const DecompBranchRow& row = rows[i];
+
+            if (row.type != DecompBranchRow_Column ||
+                  (row.blockId >= 0 && row.blockId != (*li)->getBlockId())) {
+               continue;
+            }
+
+            if (!row.isSatisfied(&denseS[0], DecompEpsilon)) {
+               m_masterSI->setColBounds((*li)->getColMasterIndex(), 0.0, 0.0);
+               nFixed++;
+               break;
+            }
+         }
+      }
+   }
+
+   UTIL_MSG(m_param.LogDebugLevel, 3,
+            (*m_osLog) << "Generic branching rows: " << rows.size()
+            << ", master rows: " << 2 * m_branchRowsGeneric.size()
+            << ", columns fixed: " << nFixed << "\n";
+           );
+   UtilPrintFuncEnd(m_osLog, m_classTag,
+                    "setBranchRows()", m_param.LogDebugLevel, 2);
+}
+
+//===========================================================================//
+void DecompAlgo::breakOutPartial(const double*   xHat,
+                                 DecompVarList& newVars,
+                                 const double    intTol)
+{
+   if (m_numConvexCon <= 1) {
+      return;
+   }
+
+   UtilPrintFuncBegin(m_osLog, m_classTag,
+                      "breakOutPartial()", m_param.LogDebugLevel, 1);
+   //TODO: what if modelRelax is not defined?
+   //TODO: if lambda=1, don't bother, it means the partial
+   //  is already there
+   DecompConstraintSet* modelCore  = m_modelCore.getModel();
+   const char*           integerMark = modelCore->getIntegerMark();
+   //---
+   //--- for each block, check to see if active integer columns
+   //---  are integral - if so, use these as candidate columns
+   //---
+   const double* objCoeff = getOrigObjective();
+   map<int, DecompSubModel>::iterator mit;
+   vector<int>::const_iterator         vit;
+
+   for (mit = m_modelRelax.begin(); mit != m_modelRelax.end(); mit++) {
+      DecompSubModel&      subModel      = (*mit).second;
+      DecompConstraintSet* model         = subModel.getModel();
+      int                   b            = subModel.getBlockId();
+      const vector<int>&    activeCols   = model->getActiveColumns();
+      bool blockFeasible = true;
+
+      for (vit = activeCols.begin(); vit != activeCols.end(); vit++) {
+         if (integerMark[*vit] != 'I') {
+            continue;
+         }
+
+         if (!(UtilIsIntegral(xHat[*vit], intTol))) {
+            blockFeasible = false;
+            break;
+         }
+      }
+
+      if (blockFeasible) {
+         vector<int>    ind;
          vector<double> els;
          double origCost = 0.0;
 
@@ -1574,13 +2400,14 @@ DecompStatus DecompAlgo::processNode(const AlpsDecompTreeNode* node,
                                      const double globalLB,
                                      const double globalUB)
 {
-   if (node == NULL) {
-      throw UtilException("NULL node being processed.", "processNode",
-                          "DecompAlgo");
-   }
-
+   //---
+   //--- a NULL node is a stand-alone solve outside of the tree (the
+   //---   decompose-and-cut separator, InitVarsWithCutDC), processed
+   //---   like the root
+   //---
    m_curNode = node;
-   int nodeIndex = node->getIndex();
+   int nodeIndex = node ? node->getIndex() : 0;
+   DecompTraceScope traceNode(m_trace, DecompTrace_Node, nodeIndex);
    double                mostNegRC = 0.0;
    DecompConstraintSet* modelCore = m_modelCore.getModel();
    m_stabEpsilon = 0.0;
@@ -1667,14 +2494,25 @@ DecompStatus DecompAlgo::processNode(const AlpsDecompTreeNode* node,
    //---     (node > 0) <-- <same as last node>
    //---
    m_firstPhase2Call = false;
+   m_farkasPricing   = false;
    phaseInit(m_phaseLast);
    m_phase           = m_phaseLast;
 
    //---
-   //--- it is possible that phaseInit can find
-   //---  the node infeasible
+   //--- with Farkas pricing, start in phase II (artificials fixed to 0);
+   //---   if the master is infeasible, phaseUpdate prices on the ray
    //---
-   if (m_phase == PHASE_DONE) {
+   if (m_phase == PHASE_PRICE1 && useFarkasPricing()) {
+      masterPhaseItoII();
+      m_phase           = PHASE_PRICE2;
+      m_firstPhase2Call = true;
+   }
+
+   //---
+   //--- it is possible that phaseInit can find
+   //---  the node infeasible
+   //---
+   if (m_phase == PHASE_DONE) {
       m_status = STAT_INFEASIBLE;
    } else {
       //TODO: put sb candidate id in name of file
@@ -1850,19 +2688,17 @@ DecompStatus DecompAlgo::processNode(const AlpsDecompTreeNode* node,
       //--- TOOD: seems confusing to store bounds from different objectives
       //---       in the same structure - maybe should use m_nodeStats1/2
       //---
-      //--- TKR (8/20/19): removed tolerance used on comparison below to be 
-      //---                consistent with seemingly duplicative check in
-      //---                AlpsDecompTreeNode::process(). TODO: determine
-      //---                whether we need a tolerance here and whether the
-      //---                the duplicate checks can/should be eliminated.
+      //--- the tolerances (and rounding of the bound) are the same as
+      //---   those of AlpsDecompTreeNode::process, see isNodeBoundPruned
+      //---
       if (m_phase != PHASE_PRICE1 &&
-            (m_nodeStats.objBest.first >=
-             (m_nodeStats.objBest.second))) {
+            isNodeBoundPruned(m_nodeStats.objBest.first,
+                              m_nodeStats.objBest.second)) {
          UTIL_MSG(m_param.LogLevel, 2,
                   (*m_osLog)
                   << "Node " << nodeIndex << " process stopping on bound."
                   << " This LB= "
-                  << UtilDblToStr(m_nodeStats.objBest.first)
+                  << UtilDblToStr(roundNodeBound(m_nodeStats.objBest.first))
                   << " Global UB= "
                   << UtilDblToStr(m_nodeStats.objBest.second) << "." << endl;);
          m_stopCriteria = DecompStopBound;
@@ -1897,7 +2733,10 @@ DecompStatus DecompAlgo::processNode(const AlpsDecompTreeNode* node,
             //---
             //--- THINK....
             //---
-            if (m_status == STAT_FEASIBLE) {
+            if (m_status == STAT_FEASIBLE || m_farkasPricing) {
+               //---
+               //--- with Farkas pricing, the dual solution is the ray
+               //---
                m_varpool.setReducedCosts(getMasterDualSolution(), m_status);
             } else {
                //if doing RC, never called??
@@ -1940,6 +2779,26 @@ DecompStatus DecompAlgo::processNode(const AlpsDecompTreeNode* node,
             addVarsFromPool();
          }
 
+         //---
+         //--- if the bound of this (full) pricing round already prunes
+         //---   the node, stop now rather than after another master solve
+         //---
+         if (m_phase == PHASE_PRICE2 &&
+               isNodeBoundPruned(m_nodeStats.objBest.first,
+                                 m_nodeStats.objBest.second)) {
+            UTIL_MSG(m_param.LogLevel, 2,
+                     (*m_osLog)
+                     << "Node " << nodeIndex
+                     << " process stopping on bound after pricing."
+                     << " This LB= "
+                     << UtilDblToStr(roundNodeBound(m_nodeStats.objBest.first))
+                     << " Global UB= "
+                     << UtilDblToStr(m_nodeStats.objBest.second) << "."
+                     << endl;);
+            m_stopCriteria = DecompStopBound;
+            m_phase        = PHASE_DONE;
+         }
+
          //printf("m_isColGenExact  = %d\n", m_isColGenExact);
          //printf("m_rrIterSinceAll = %d\n", m_rrIterSinceAll);
          //printf("m_status         = %d\n", m_status);
@@ -2332,10 +3191,25 @@ DecompStatus DecompAlgo::processNode(const AlpsDecompTreeNode* node,
               << UtilDblToStr(m_relGap, 6) << "\n";
              );
    m_stats.thisDecomp.push_back(m_stats.timerDecomp.getRealTime());
+   m_stats.numPriceCalls += m_nodeStats.priceCallsTotal;
+   m_stats.numCutCalls   += m_nodeStats.cutCallsTotal;
+   m_stats.numMasterIters += m_nodeStats.masterIters;
+   m_stats.maxNodeMasterIters = std::max(m_stats.maxNodeMasterIters,
+                                         m_nodeStats.masterIters);
+
+   if (nodeIndex == 0 && !m_isStrongBranch && m_stats.timeRootBound < 0.0) {
+      m_stats.timeRootBound = m_stats.timerOverall.getRealTime();
+      m_stats.rootBound     = m_nodeStats.objBest.first;
+   }
+
    //if i am root and doing price and cut, solve this IP to get ub...
    //  e.g., cutting stock works well -> better to do at AlpsDecompTreeNode
    UTIL_MSG(m_param.LogDebugLevel, 3,
             m_stats.printOverallStats(m_osLog);
+
+            if (m_param.CutCGL && m_cgl) {
+               m_cgl->printStats(m_osLog);
+            }
            );
 
    if (m_param.LogObjHistory) {
@@ -2401,7 +3275,8 @@ void DecompAlgo::setMasterBounds(const double* lbs,
       DecompConstraintSet* modelCore = m_modelCore.getModel();
       const int             nCols     = modelCore->getNumCols();
       const double*         colUB     = m_masterSI->getColUpper();
-      double*               denseS    = new double[nCols];
+      double*               denseS    =
+         getScratch().getDblArr(DecompScratch_DenseS, nCols);
       map<int, DecompSubModel>::iterator mit;
 
       for (li = m_vars.begin(); li != m_vars.end(); li++) {
@@ -2440,8 +3315,6 @@ void DecompAlgo::setMasterBounds(const double* lbs,
             }
          }
       }
-
-      UTIL_DELARR(denseS);
    } else if (m_branchingImplementation == DecompBranchInMaster) {
       int                   c, coreColIndex;
       DecompConstraintSet* modelCore = m_modelCore.getModel();
@@ -2461,14 +3334,16 @@ void DecompAlgo::setMasterBounds(const double* lbs,
                                         lbs[coreColIndex], ubs[coreColIndex]);
             }
          }
+      } else if (m_branchLazy) {
+         setMasterBranchRows(lbs, ubs);
       } else {
          const int             beg       = modelCore->nBaseRowsOrig;
-         //TODO: can reuse this memory
+         DecompMemPool&        scratch   = getScratch();
          int      nRows   = 2 * nIntVars;
-         int*     index   = new int[nRows];
-         char*    sense   = new char[nRows];
-         double* rhs     = new double[nRows];
-         double* range   = new double[nRows];
+         int*     index   = scratch.getIntArr (DecompScratch_RowIndex, nRows);
+         char*    sense   = scratch.getCharArr(DecompScratch_RowSense, nRows);
+         double* rhs     = scratch.getDblArr (DecompScratch_RowRhs,   nRows);
+         double* range   = scratch.getDblArr (DecompScratch_RowRange, nRows);
 
          //lbs,ubs is indexed on core column index
          // but c is being looped over integers here...
@@ -2512,10 +3387,6 @@ void DecompAlgo::setMasterBounds(const double* lbs,
          }
 
          m_masterSI->setRowSetTypes(index, index + (2 * nIntVars), sense, rhs, range);
-         UTIL_DELARR(index);
-         UTIL_DELARR(sense);
-         UTIL_DELARR(rhs);
-         UTIL_DELARR(range);
       }
    }
 
@@ -2527,6 +3398,178 @@ void DecompAlgo::setMasterBounds(const double* lbs,
                     "setMasterBounds()", m_param.LogDebugLevel, 2);
 }
 
+//===========================================================================//
+int DecompAlgo::reducedCostFixing(double*      lbs,
+                                  double*      ubs,
+                                  const double cutoff)
+{
+   //---
+   //--- For the master duals u (convexity rows removed) and any x of
+   //---   this node, by weak duality
+   //---      c x >= u b'' + sum{b} min{(c - uA'')x : x in P_b}
+   //---   where u b'' uses the row bound that matches the sign of each
+   //---   dual. With the LP relaxation of each P_b this gives the bound
+   //---   LB_LP (a Lagrangian bound, weaker than the one of updateObjBound
+   //---   but valid even if the subproblems are solved heuristically),
+   //---   and the LP reduced costs r of the blocks: if x_j is at its
+   //---   lower bound l_j in the LP solution of its block, r_j > 0,
+   //---      c x >= LB_LP + r_j (x_j - l_j),
+   //---   so x_j <= l_j + floor((cutoff - LB_LP) / r_j) for any x better
+   //---   than the cutoff (and the same for upper bounds, r_j < 0).
+   //---
+   //--- NOTE: this needs the block models solved by the built-in MILP
+   //---   solver (the LP is solved with the block's OSI).
+   //---
+   const DecompPhase phase = m_phase == PHASE_DONE ? m_phaseLast : m_phase;
+
+   if (m_algo != PRICE_AND_CUT || phase == PHASE_PRICE1 ||
+         cutoff >= m_infinity || !m_masterSI->isProvenOptimal() ||
+         m_param.MasterConvexityLessThan ||
+         m_param.DecompIPSolver == "SYMPHONY" ||
+         m_numConvexCon != static_cast<int>(m_modelRelax.size())) {
+      return 0;
+   }
+
+   UtilPrintFuncBegin(m_osLog, m_classTag,
+                      "reducedCostFixing()", m_param.LogDebugLevel, 2);
+   int                   r, k, j;
+   int                   nFixed        = 0;
+   DecompConstraintSet* modelCore     = m_modelCore.getModel();
+   const int             nCoreCols     = modelCore->getNumCols();
+   const int             nMasterRows   = m_masterSI->getNumRows();
+   const double*         u             = getMasterDualSolution();
+   const double*         rowLB         = m_masterSI->getRowLower();
+   const double*         rowUB         = m_masterSI->getRowUpper();
+   const double*         colLBM        = m_masterSI->getColLower();
+   const double*         colUBM        = m_masterSI->getColUpper();
+   vector<double>        uAdjusted(nMasterRows - m_numConvexCon);
+   vector<double>        redCostX(nCoreCols);
+   map<int, DecompSubModel>::iterator mit;
+   map<int, int>::iterator            moit;
+   double                lbLP          = 0.0;
+   bool                  isValid       = true;
+   //---
+   //--- u b'' (and every convexity row must be sum{s} lam[s] = 1)
+   //---
+   for (r = 0; r < nMasterRows && isValid; r++) {
+      if (m_masterRowType[r] == DecompRow_Convex) {
+         isValid = UtilIsZero(rowLB[r] - 1.0) && UtilIsZero(rowUB[r] - 1.0);
+      } else if (u[r] > DecompEpsilon) {
+         isValid  = rowLB[r] > -m_infinity;
+         lbLP    += u[r] * rowLB[r];
+      } else if (u[r] < -DecompEpsilon) {
+         isValid  = rowUB[r] <  m_infinity;
+         lbLP    += u[r] * rowUB[r];
+      }
+   }
+
+   if (isValid) {
+      generateVarsAdjustDuals(u, &uAdjusted[0]);
+      generateVarsCalcRedCost(&uAdjusted[0], &redCostX[0]);
+   }
+
+   //---
+   //--- master-only columns: min (c - uA'')_j x_j over their bounds
+   //---
+   for (moit  = m_masterOnlyColsMap.begin();
+         moit != m_masterOnlyColsMap.end() && isValid; moit++) {
+      j = moit->first;
+      k = moit->second;
+
+      if (redCostX[j] > DecompEpsilon) {
+         isValid  = colLBM[k] > -m_infinity;
+         lbLP    += redCostX[j] * colLBM[k];
+      } else if (redCostX[j] < -DecompEpsilon) {
+         isValid  = colUBM[k] <  m_infinity;
+         lbLP    += redCostX[j] * colUBM[k];
+      }
+   }
+
+   //---
+   //--- the LP of each block
+   //---
+   for (mit = m_modelRelax.begin(); mit != m_modelRelax.end() && isValid;
+         mit++) {
+      DecompSubModel&      subModel  = (*mit).second;
+      OsiSolverInterface* subprobSI = subModel.getOsi();
+
+      if (!subprobSI) {
+         isValid = false;
+         break;
+      }
+
+      subModel.setOsiObjCoeff(&redCostX[0]);
+      subprobSI->initialSolve();
+      isValid = subprobSI->isProvenOptimal();
+
+      if (isValid) {
+         lbLP += subprobSI->getObjValue();
+      }
+   }
+
+   if (!isValid || lbLP > cutoff) {
+      UTIL_DEBUG(m_param.LogDebugLevel, 3,
+                 (*m_osLog) << "Reduced-cost fixing skipped, valid = "
+                 << isValid << " LB_LP = " << UtilDblToStr(lbLP) << "\n";
+                );
+      UtilPrintFuncEnd(m_osLog, m_classTag,
+                       "reducedCostFixing()", m_param.LogDebugLevel, 2);
+      return 0;
+   }
+
+   //---
+   //--- tighten the bounds of the integer columns of each block
+   //---
+   const double gap = cutoff - lbLP;
+
+   for (mit = m_modelRelax.begin(); mit != m_modelRelax.end(); mit++) {
+      DecompConstraintSet*  model     = (*mit).second.getModel();
+      OsiSolverInterface*  subprobSI = (*mit).second.getOsi();
+      const double*         rc        = subprobSI->getReducedCost();
+      const double*         x         = subprobSI->getColSolution();
+      const double*         lbSub     = subprobSI->getColLower();
+      const double*         ubSub     = subprobSI->getColUpper();
+      const vector<int>&    active    = model->getActiveColumns();
+      const vector<int>&    origToSp  = model->getOrigToSparseIndex();
+      vector<int>::const_iterator vit;
+
+      for (vit = active.begin(); vit != active.end(); vit++) {
+         j = *vit;
+         k = model->isSparse() ? origToSp[j] : j;
+
+         if (k < 0 || modelCore->integerMark[j] != 'I') {
+            continue;
+         }
+
+         if (rc[k] > DecompEpsilon && x[k] <= lbSub[k] + DecompEpsilon) {
+            const double ub = lbSub[k] + floor(gap / rc[k] + DecompEpsilon);
+
+            if (ub < ubs[j] - 0.5) {
+               ubs[j] = max(ub, lbs[j]);
+               nFixed++;
+            }
+         } else if (rc[k] < -DecompEpsilon &&
+                    x[k] >= ubSub[k] - DecompEpsilon) {
+            const double lb = ubSub[k] - floor(gap / -rc[k] + DecompEpsilon);
+
+            if (lb > lbs[j] + 0.5) {
+               lbs[j] = min(lb, ubs[j]);
+               nFixed++;
+            }
+         }
+      }
+   }
+
+   UTIL_MSG(m_param.LogLevel, 3,
+            (*m_osLog) << "Reduced-cost fixing: LB_LP = "
+            << UtilDblToStr(lbLP) << " cutoff = " << UtilDblToStr(cutoff)
+            << " columns tightened = " << nFixed << "\n";
+           );
+   UtilPrintFuncEnd(m_osLog, m_classTag,
+                    "reducedCostFixing()", m_param.LogDebugLevel, 2);
+   return nFixed;
+}
+
 //===========================================================================//
 DecompStatus DecompAlgo::solutionUpdate(const DecompPhase phase,
                                         bool              resolve,
@@ -2537,6 +3580,8 @@ DecompStatus DecompAlgo::solutionUpdate(const DecompPhase phase,
    UtilPrintFuncBegin(m_osLog, m_classTag,
                       "solutionUpdate()", m_param.LogDebugLevel, 2);
    m_stats.timerOther1.reset();
+   DecompTraceScope traceMaster(m_trace, DecompTrace_MasterSolve,
+                                getNodeIndex());
    int i;
    DecompStatus status = STAT_UNKNOWN;
 
@@ -2594,6 +3639,14 @@ DecompStatus DecompAlgo::solutionUpdate(const DecompPhase phase,
 #endif
    }
 
+   //---
+   //--- interior point master (pricing phases only, the cut phase needs
+   //---   a basis to warm start)
+   //---
+   const bool doBarrier = m_param.DoInteriorPoint ||
+                          m_param.SolveMasterUpdateAlgo == DecompBarrier;
+   m_masterObjGap = 0.0;
+
    switch (phase) {
    case PHASE_PRICE1:
    case PHASE_PRICE2:
@@ -2605,11 +3658,10 @@ DecompStatus DecompAlgo::solutionUpdate(const DecompPhase phase,
          m_masterSI->setHintParam(OsiDoDualInResolve, false, OsiHintDo);
       }
 
-      //TODO: interior
       //if(m_algo == DECOMP)//THINK!
       // m_masterSI->setHintParam(OsiDoPresolveInResolve, false, OsiHintDo);
 
-      if (m_param.DecompLPSolver == "CPLEX" && m_param.DoInteriorPoint){
+      if (m_param.DecompLPSolver == "CPLEX" && doBarrier){
 #ifdef DIP_HAS_CPX
 	 //int cpxStat=0, cpxMethod=0;
 	 OsiCpxSolverInterface* masterCpxSI
@@ -2624,6 +3676,8 @@ DecompStatus DecompAlgo::solutionUpdate(const DecompPhase phase,
 	 //if(cpxStat)
 	 // printf("cpxMethod=%d, cpxStat = %d\n", cpxMethod, cpxStat);
 #endif
+      } else if (m_param.DecompLPSolver == "Clp" && doBarrier) {
+         solveMasterBarrierClp();
       }else{
 	 if (resolve) {
 	    //	m_masterSI->writeMps("temp");
@@ -2647,6 +3701,7 @@ DecompStatus DecompAlgo::solutionUpdate(const DecompPhase phase,
       assert(0);
    }
 
+   m_nodeStats.masterIters += m_masterSI->getIterationCount();
    UTIL_MSG(m_param.LogDebugLevel, 3,
             (*m_osLog) << "Solution update n_cols:"
             << setw(10) << m_masterSI->getNumCols() << " n_rows: "
@@ -2788,6 +3843,82 @@ DecompStatus DecompAlgo::solutionUpdate(const DecompPhase phase,
    return status;
 }
 
+//===========================================================================//
+void DecompAlgo::solveMasterBarrierClp()
+{
+#ifdef DIP_HAS_CLP
+   OsiClpSolverInterface* osiClp
+      = dynamic_cast<OsiClpSolverInterface*>(m_masterSI);
+
+   if (!osiClp) {
+      throw UtilException("The master solver is not Clp",
+                          "solveMasterBarrierClp", "DecompAlgo");
+   }
+
+   ClpSimplex* clp = osiClp->getModelPtr();
+
+   if (m_param.MasterBarrierCrossover) {
+      clp->barrier(true);
+
+      if (clp->status() != 0) {
+         m_masterSI->resolve();
+      }
+
+      return;
+   }
+
+   //---
+   //--- barrier without crossover, the solution stays interior
+   //---
+   ClpInterior barrier;
+   barrier.borrowModel(*clp);
+   barrier.setCholesky(new ClpCholeskyBase());
+
+   if (m_param.MasterBarrierMaxIter > 0) {
+      barrier.setMaximumBarrierIterations(m_param.MasterBarrierMaxIter);
+   }
+
+   barrier.primalDual();
+   const int    status   = barrier.status();
+   const int    nIter    = barrier.numberIterations();
+   const double gap      = barrier.complementarityGap();
+   const double primErr  = barrier.largestPrimalError();
+   const double dualErr  = barrier.largestDualError();
+   barrier.returnModel(*clp);
+
+   //---
+   //--- stopped at the iteration limit: use the point if it is primal and
+   //---   dual feasible (its centrality is not checked); the bound is then
+   //---   taken from the dual objective (primal - gap) so it stays valid
+   //---
+   if (status == 3 &&
+         primErr <= DecompEpsilon && dualErr <= DecompEpsilon) {
+      clp->setProblemStatus(0);
+      m_masterObjGap = std::max(gap, 0.0);
+   }
+
+   UTIL_MSG(m_param.LogDebugLevel, 3,
+            (*m_osLog) << "Barrier master status: " << status
+            << " iter: "    << nIter
+            << " gap: "     << UtilDblToStr(gap)
+            << " primErr: " << UtilDblToStr(primErr)
+            << " dualErr: " << UtilDblToStr(dualErr) << endl;
+           );
+
+   //---
+   //--- not solved (infeasible point at the limit, numerical trouble):
+   //---   let simplex finish from where the barrier stopped
+   //---
+   if (clp->status() != 0) {
+      m_masterObjGap = 0.0;
+      m_masterSI->resolve();
+   }
+#else
+   throw UtilException("Clp barrier master requires Clp",
+                       "solveMasterBarrierClp", "DecompAlgo");
+#endif
+}
+
 //===========================================================================//
 //NOTE: not ok for CPX... do self?
 vector<double*> DecompAlgo::getDualRays(int maxNumRays)
@@ -2831,11 +3962,12 @@ vector<double*> DecompAlgo::getDualRaysCpx(int maxNumRays)
 		 }
 		 );
       m_masterSI->enableSimplexInterface(false);
-      double* tabRhs   = new double[m];
-      int*     basics   = new int[m];
-      double* yb       = new double[m];
-      double* bInvRow  = new double[m];
-      double* bInvARow = new double[n];
+      DecompMemPool& scratch  = getScratch();
+      double* tabRhs   = scratch.getDblArr(DecompScratch_TabRhs, m);
+      int*     basics   = scratch.getIntArr(DecompScratch_Basics, m);
+      double* yb       = scratch.getDblArr(DecompScratch_Yb, m);
+      double* bInvRow  = scratch.getDblArr(DecompScratch_BInvRow, m);
+      double* bInvARow = scratch.getDblArr(DecompScratch_BInvARow, n);
       //STOP ============================================
       //tabRhs and yb do NOT match up.... is this an issue?
       //have to hand adjust or use tabRhs since proof is based on B-1
@@ -2999,11 +4131,6 @@ vector<double*> DecompAlgo::getDualRaysCpx(int maxNumRays)
 	 }
       }
       
-      UTIL_DELARR(tabRhs);
-      UTIL_DELARR(basics);
-      UTIL_DELARR(yb);
-      UTIL_DELARR(bInvRow);
-      UTIL_DELARR(bInvARow);
       m_masterSI->disableSimplexInterface();
       printf("rays.size = %d\n", static_cast<int>(rays.size()));
       
@@ -3136,12 +4263,14 @@ vector<double*> DecompAlgo::getDualRaysOsi(int maxNumRays)
       //with simplex interface, this is slightly different...
       const double* primSolution = m_masterSI->getColSolution();
       const double* rowAct       = m_masterSI->getRowActivity(); //==slacks?
-      double* tabRhs   = new double[m]; //osi_clp does not give this?
+      DecompMemPool& scratch  = getScratch();
+      //osi_clp does not give this?
+      double* tabRhs   = scratch.getDblArr(DecompScratch_TabRhs, m);
       //B-1b just equals x, but what if art column then is slack var
-      int*     basics   = new int[m];
-      double* yb       = new double[m];
-      double* bInvRow  = new double[m];
-      double* bInvARow = new double[n];
+      int*     basics   = scratch.getIntArr(DecompScratch_Basics, m);
+      double* yb       = scratch.getDblArr(DecompScratch_Yb, m);
+      double* bInvRow  = scratch.getDblArr(DecompScratch_BInvRow, m);
+      double* bInvARow = scratch.getDblArr(DecompScratch_BInvARow, n);
       m_masterSI->getBasics(basics);
       
       for (r = 0; r < m; r++) {
@@ -3272,10 +4401,6 @@ vector<double*> DecompAlgo::getDualRaysOsi(int maxNumRays)
 		    );
       }
       
-      UTIL_DELARR(basics);
-      UTIL_DELARR(yb);
-      UTIL_DELARR(bInvRow);
-      UTIL_DELARR(bInvARow);
       m_masterSI->disableSimplexInterface();
       /*
 	if(rays.size() <= 0){
@@ -3318,7 +4443,6 @@ vector<double*> DecompAlgo::getDualRaysOsi(int maxNumRays)
       }
       
       assert(rays.size() > 0);
-      UTIL_DELARR(tabRhs);
       UtilPrintFuncEnd(m_osLog, m_classTag,
 		       "getDualRays()", m_param.LogDebugLevel, 2);
       return rays;
@@ -3395,6 +4519,106 @@ vector<double*> DecompAlgo::getDualRaysOsi(int maxNumRays)
    }
 }
 
+//===========================================================================//
+bool DecompAlgo::getFarkasRay(vector<double>& ray)
+{
+   UtilPrintFuncBegin(m_osLog, m_classTag,
+                      "getFarkasRay()", m_param.LogDebugLevel, 2);
+   const int m = m_masterSI->getNumRows();
+   const int n = m_masterSI->getNumCols();
+   vector<double*> rays;
+
+   try {
+      rays = m_masterSI->getDualRays(1, false);
+   } catch (CoinError&) {
+      rays.clear();
+   }
+
+   if (rays.empty() || !rays[0]) {
+      for (size_t k = 0; k < rays.size(); k++) {
+         UTIL_DELARR(rays[k]);
+      }
+
+      UTIL_MSG(m_param.LogDebugLevel, 3,
+               (*m_osLog) << "No Farkas ray from the LP solver." << endl;);
+      UtilPrintFuncEnd(m_osLog, m_classTag,
+                       "getFarkasRay()", m_param.LogDebugLevel, 2);
+      return false;
+   }
+
+   ray.assign(rays[0], rays[0] + m);
+
+   for (size_t k = 0; k < rays.size(); k++) {
+      UTIL_DELARR(rays[k]);
+   }
+
+   //---
+   //--- The solvers do not agree on the sign of the ray, so check which
+   //--- orientation is a proof. For rowLB <= Ax <= rowUB, l <= x <= u:
+   //---   y.Ax >= sum{y_i > 0} y_i rowLB_i + sum{y_i < 0} y_i rowUB_i
+   //---   y.Ax <= sum{(yA)_j > 0} (yA)_j u_j + sum{(yA)_j < 0} (yA)_j l_j
+   //--- and y proves infeasibility if the first bound exceeds the second.
+   //--- This only needs one sparse y^T A, no tableau rows.
+   //---
+   const CoinPackedMatrix* rowMatrix = m_masterSI->getMatrixByRow();
+   const double*           rowLB     = m_masterSI->getRowLower();
+   const double*           rowUB     = m_masterSI->getRowUpper();
+   const double*           colLB     = m_masterSI->getColLower();
+   const double*           colUB     = m_masterSI->getColUpper();
+   vector<double>          yA(n, 0.0);
+   rowMatrix->transposeTimes(&ray[0], &yA[0]);
+   double gap[2] = {0.0, 0.0}; //orientation +y, -y
+   int    i, j, o;
+
+   for (o = 0; o < 2; o++) {
+      const double sign  = o == 0 ? 1.0 : -1.0;
+      double       lower = 0.0;
+      double       upper = 0.0;
+
+      for (i = 0; i < m && lower > -m_infinity; i++) {
+         const double y = sign * ray[i];
+
+         if (y > m_param.TolZero) {
+            lower = rowLB[i] <= -m_infinity ? -m_infinity : lower + y * rowLB[i];
+         } else if (y < -m_param.TolZero) {
+            lower = rowUB[i] >=  m_infinity ? -m_infinity : lower + y * rowUB[i];
+         }
+      }
+
+      for (j = 0; j < n && upper < m_infinity; j++) {
+         const double d = sign * yA[j];
+
+         if (d > m_param.TolZero) {
+            upper = colUB[j] >=  m_infinity ? m_infinity : upper + d * colUB[j];
+         } else if (d < -m_param.TolZero) {
+            upper = colLB[j] <= -m_infinity ? m_infinity : upper + d * colLB[j];
+         }
+      }
+
+      gap[o] = (lower <= -m_infinity || upper >= m_infinity) ?
+               -m_infinity : lower - upper;
+   }
+
+   bool isProof = true;
+
+   if (gap[1] > gap[0]) {
+      transform(ray.begin(), ray.end(), ray.begin(), negate<double>());
+      gap[0] = gap[1];
+   }
+
+   if (gap[0] <= DecompEpsilon) {
+      isProof = false;
+   }
+
+   UTIL_MSG(m_param.LogDebugLevel, 3,
+            (*m_osLog) << "Farkas ray: proof gap = "
+            << UtilDblToStr(gap[0]) << (isProof ? "" : " (not a proof)")
+            << endl;);
+   UtilPrintFuncEnd(m_osLog, m_classTag,
+                    "getFarkasRay()", m_param.LogDebugLevel, 2);
+   return isProof;
+}
+
 //===========================================================================//
 int DecompAlgo::generateInitVars(DecompVarList& initVars)
 {
@@ -3452,7 +4676,8 @@ int DecompAlgo::generateInitVars(DecompVarList& initVars)
       //---   all cost > 0, so will get NULL column, later on reduced costs
       //---   will give negative values, so this is not a problem
       //---
-      double* costeps = new double[nCoreCols];
+      double* costeps =
+         getScratch().getDblArr(DecompScratch_CostEps, nCoreCols);
       assert(objCoeff);
       aveC = UtilAve(objCoeff, nCoreCols);
       attempts = 0;
@@ -3542,7 +4767,6 @@ int DecompAlgo::generateInitVars(DecompVarList& initVars)
       //---
       //--- TODO: put them in the var pool??
       //---
-      UTIL_DELARR(costeps);//TODO: use mem-pool
    }
 
    //---
@@ -3590,120 +4814,641 @@ int DecompAlgo::generateInitVars(DecompVarList& initVars)
          m_xhatIPBest->print();
       }
 
-      printf("======= END   Gen Init Vars - call CPM process root node\n");
+      printf("======= END   Gen Init Vars - call CPM process root node\n");
+   }
+
+   if (m_param.InitVarsWithIP) {
+      printf("======= BEGIN Gen Init Vars - call Direct IP solver\n");
+      DecompAlgoC          direct(m_app, *m_utilParam);
+      DecompSolverResult* result = NULL;
+      double oldSetting = m_param.TimeLimit;
+      m_param.TimeLimit = m_param.InitVarsWithIPTimeLimit;
+      result = direct.solveDirect();
+      m_param.TimeLimit = oldSetting;
+
+      if (result->m_nSolutions) {
+         //---
+         //--- if an incumbent was found, create a var(s) from it
+         //---
+         //TODO: safe to assume 0th is the best
+         const double* solution = result->getSolution(0);
+         const DecompVarType varType = result->m_isUnbounded ? DecompVar_Ray : DecompVar_Point;
+
+         if (m_numConvexCon == 1) {
+            DecompVar* directVar = new DecompVar(nCoreCols,
+                                                 solution,
+                                                 0.0, result->m_objUB, varType);
+            initVars.push_back(directVar);
+         } else {
+            map<int, DecompSubModel>::iterator mid;
+
+            for (mid = m_modelRelax.begin(); mid != m_modelRelax.end(); mid++) {
+               int               blockId       = (*mid).first;
+               DecompSubModel& modelRelax    = (*mid).second;
+               vector<int>&      activeColumns
+               = modelRelax.getModel()->activeColumns;
+               vector<int>       ind;
+               vector<double>    els;
+               double            origCost = 0.0;
+               vector<int>::iterator it;
+
+               for (it  = activeColumns.begin();
+                     it != activeColumns.end(); it++) {
+                  if (!UtilIsZero(solution[*it])) {
+                     ind.push_back(*it);
+                     els.push_back(solution[*it]);
+                     origCost += objCoeff[*it] * solution[*it];
+                  }
+               }
+
+               DecompVar* directVar
+               = new DecompVar(ind, els, 0.0, origCost, varType);
+               directVar->setBlockId(blockId);
+               initVars.push_back(directVar);
+            }
+         }
+
+         //---
+         //--- update the upper bound
+         //---
+         double bestBoundUB = m_nodeStats.objBest.second;
+
+         if (result->m_objUB < bestBoundUB) {
+            DecompSolution* directSol = new DecompSolution(nCoreCols,
+                  solution,
+                  result->m_objUB);
+            m_xhatIPFeas.push_back(directSol);
+            m_xhatIPBest = directSol;
+            setObjBoundIP(result->m_objUB);
+         }
+      }
+
+      printf("======= END   Gen Init Vars - call Direct IP solver\n");
+   }
+
+   //---
+   //--- check init vars for incumbent
+   //---
+   if (m_numConvexCon == 1) {
+      DecompVarList::iterator vli;
+
+      for (vli = initVars.begin(); vli != initVars.end(); vli++) {
+         //---
+         //--- unlikey to happen - but we should check ALL columns
+         //---  to see if they are IP feasible
+         //---
+         (*vli)->fillDenseArr(modelCore->getNumCols(),
+                              m_memPool.dblArrNCoreCols);
+
+         if (isIPFeasible(m_memPool.dblArrNCoreCols)) {
+            if (m_app->APPisUserFeasible(m_memPool.dblArrNCoreCols,
+                                         modelCore->getNumCols(),
+                                         m_param.TolZero)) {
+               DecompSolution* decompSol
+               = new DecompSolution(modelCore->getNumCols(),
+                                    m_memPool.dblArrNCoreCols,
+                                    (*vli)->getOriginalCost());
+               m_xhatIPBest = decompSol;
+               m_xhatIPFeas.push_back(decompSol);
+               //printf("var is ip feas with obj = %g\n",
+               //     (*vli)->getOriginalCost());
+               setObjBoundIP((*vli)->getOriginalCost());
+            }
+         }
+      }
+   }
+
+   //---
+   //--- this will update the global UB before we start processing
+   //---   if we were lucky enough to find an incumbent in init vars
+   //---
+   //setCutoffUB(getCutoffUB());
+   m_function = DecompFuncGeneric;
+   UtilPrintFuncEnd(m_osLog, m_classTag,
+                    "generateInitVars()", m_param.LogDebugLevel, 2);
+   nInitVars = static_cast<int>(initVars.size());
+   return nInitVars;
+}
+
+//===========================================================================//
+string DecompAlgo::checkpointStamp() const
+{
+   const DecompConstraintSet* modelCore = m_modelCore.getModel();
+   return m_app->m_param.Instance
+          + ":" + UtilIntToStr(modelCore->getNumCols())
+          + ":" + UtilIntToStr(modelCore->getNumRows())
+          + ":" + UtilIntToStr(static_cast<int>(m_modelRelax.size()));
+}
+
+//===========================================================================//
+bool DecompAlgo::loadCheckpoint(DecompVarList& initVars)
+{
+   UtilPrintFuncBegin(m_osLog, m_classTag,
+                      "loadCheckpoint()", m_param.LogDebugLevel, 2);
+   DecompCheckpoint* cp = new DecompCheckpoint();
+   CoinAssertHint(cp, "Error: Out of Memory");
+   string errMsg;
+
+   if (!cp->read(m_param.CheckpointFile, errMsg)) {
+      (*m_osLog) << "Restart: checkpoint not used: " << errMsg << endl;
+      UTIL_DELPTR(cp);
+      return false;
+   }
+
+   if (cp->stamp != checkpointStamp()) {
+      (*m_osLog) << "Restart: checkpoint " << m_param.CheckpointFile
+                 << " was written for another model." << endl;
+      UTIL_DELPTR(cp);
+      return false;
+   }
+
+   const int nCols = m_modelCore.getModel()->getNumCols();
+   size_t    i;
+
+   //---
+   //--- columns
+   //---
+   for (i = 0; i < cp->vars.size(); i++) {
+      const DecompCheckpoint::Var& v = cp->vars[i];
+
+      if (m_modelRelax.find(v.blockId) == m_modelRelax.end()) {
+         continue;
+      }
+
+      DecompVar* var = new DecompVar(v.ind, v.els, -m_infinity, v.origCost,
+                                     static_cast<DecompVarType>(v.varType));
+      CoinAssertHint(var, "Error: Out of Memory");
+      var->setBlockId(v.blockId);
+      initVars.push_back(var);
+   }
+
+   //---
+   //--- cuts
+   //---
+   for (i = 0; i < cp->cuts.size(); i++) {
+      const DecompCheckpoint::Cut& c = cp->cuts[i];
+      OsiRowCut rowCut;
+      rowCut.setRow(static_cast<int>(c.ind.size()),
+                    c.ind.empty() ? NULL : &c.ind[0],
+                    c.els.empty() ? NULL : &c.els[0]);
+      rowCut.setLb(c.lb);
+      rowCut.setUb(c.ub);
+      DecompCutOsi* decompCut = new DecompCutOsi(rowCut);
+      CoinAssertHint(decompCut, "Error: Out of Memory");
+      m_restartCuts.push_back(decompCut);
+   }
+
+   //---
+   //--- incumbent
+   //---
+   if (static_cast<int>(cp->incumbent.size()) == nCols) {
+      DecompSolution* decompSol = new DecompSolution(nCols,
+            &cp->incumbent[0], cp->incumbentValue);
+      CoinAssertHint(decompSol, "Error: Out of Memory");
+      m_xhatIPFeas.push_back(decompSol);
+      m_xhatIPBest = decompSol;
+      setObjBoundIP(decompSol->getQuality());
+   }
+
+   UTIL_MSG(m_param.LogLevel, 1,
+            (*m_osLog)
+            << "Restart from " << m_param.CheckpointFile
+            << " (" << cp->nodesProcessed << " nodes, "
+            << UtilDblToStr(cp->timeElapsed, 1) << " s): "
+            << initVars.size()   << " columns, "
+            << cp->cuts.size()   << " cuts, "
+            << cp->nodes.size()  << " open nodes, incumbent = "
+            << UtilDblToStr(cp->incumbentValue) << endl;
+           );
+   //---
+   //--- the open nodes are picked up by the root (see AlpsDecompTreeNode)
+   //---
+   cp->vars.clear();
+   cp->cuts.clear();
+   cp->incumbent.clear();
+   m_restart = cp;
+   UtilPrintFuncEnd(m_osLog, m_classTag,
+                    "loadCheckpoint()", m_param.LogDebugLevel, 2);
+   return true;
+}
+
+//===========================================================================//
+void DecompAlgo::fillCheckpoint(DecompCheckpoint& cp) const
+{
+   UtilPrintFuncBegin(m_osLog, m_classTag,
+                      "fillCheckpoint()", m_param.LogDebugLevel, 2);
+   DecompCutList::const_iterator  cli;
+   DecompCutPool::const_iterator  cpi;
+   cp.stamp = checkpointStamp();
+   //---
+   //--- columns: active in master and waiting in the pool
+   //---
+   vector<const DecompVar*> vars;
+   collectVars(vars);
+   cp.vars.resize(vars.size());
+
+   for (size_t i = 0; i < vars.size(); i++) {
+      const CoinPackedVector&  s = vars[i]->m_s;
+      DecompCheckpoint::Var& v = cp.vars[i];
+      v.blockId  = vars[i]->getBlockId();
+      v.varType  = vars[i]->getVarType();
+      v.origCost = vars[i]->getOriginalCost();
+      v.ind.assign(s.getIndices(),  s.getIndices()  + s.getNumElements());
+      v.els.assign(s.getElements(), s.getElements() + s.getNumElements());
+   }
+
+   //---
+   //--- cuts: active in master and waiting in the pool
+   //---
+   CoinPackedVector row;
+   cp.cuts.clear();
+
+   for (cli = m_cuts.begin(); cli != m_cuts.end(); cli++) {
+      DecompCheckpoint::Cut c;
+      row.clear();
+      (*cli)->expandCutToRow(&row);
+      c.lb = (*cli)->getLowerBound();
+      c.ub = (*cli)->getUpperBound();
+      c.ind.assign(row.getIndices(),  row.getIndices()  + row.getNumElements());
+      c.els.assign(row.getElements(), row.getElements() + row.getNumElements());
+      cp.cuts.push_back(c);
+   }
+
+   for (cpi = m_cutpool.begin(); cpi != m_cutpool.end(); cpi++) {
+      const CoinPackedVector* poolRow = (*cpi).getRowPtr();
+      DecompCheckpoint::Cut   c;
+      c.lb = (*cpi).getLowerBound();
+      c.ub = (*cpi).getUpperBound();
+      c.ind.assign(poolRow->getIndices(),
+                   poolRow->getIndices() + poolRow->getNumElements());
+      c.els.assign(poolRow->getElements(),
+                   poolRow->getElements() + poolRow->getNumElements());
+      cp.cuts.push_back(c);
+   }
+
+   //---
+   //--- incumbent
+   //---
+   cp.incumbent.clear();
+   cp.incumbentValue = m_infinity;
+
+   if (m_xhatIPBest) {
+      cp.incumbentValue = m_xhatIPBest->getQuality();
+      cp.incumbent.assign(m_xhatIPBest->getValues(),
+                          m_xhatIPBest->getValues() + m_xhatIPBest->getSize());
+   }
+
+   UtilPrintFuncEnd(m_osLog, m_classTag,
+                    "fillCheckpoint()", m_param.LogDebugLevel, 2);
+}
+
+//===========================================================================//
+void DecompAlgo::collectVars(vector<const DecompVar*>& vars) const
+{
+   DecompVarList::const_iterator vli;
+   DecompVarPool::const_iterator vpi;
+   vars.clear();
+   vars.reserve(m_vars.size() + m_varpool.size());
+
+   for (vli = m_vars.begin(); vli != m_vars.end(); vli++) {
+      vars.push_back(*vli);
+   }
+
+   for (vpi = m_varpool.begin(); vpi != m_varpool.end(); vpi++) {
+      vars.push_back((*vpi).getVarPtr());
+   }
+}
+
+//===========================================================================//
+void DecompAlgo::writeColumnFile(const string& fileName) const
+{
+   UtilPrintFuncBegin(m_osLog, m_classTag,
+                      "writeColumnFile()", m_param.LogDebugLevel, 2);
+   const DecompConstraintSet* modelCore = m_modelCore.getModel();
+   DecompColumnFile         cf;
+   vector<const DecompVar*> vars;
+   cf.numCols  = modelCore->getNumCols();
+   cf.colNames = modelCore->getColNames();
+   collectVars(vars);
+
+   for (size_t i = 0; i < vars.size(); i++) {
+      const CoinPackedVector& s = vars[i]->m_s;
+      cf.append(vars[i]->getBlockId(), vars[i]->getVarType(),
+                s.getNumElements(), s.getIndices(), s.getElements());
+   }
+
+   cf.write(fileName);
+   UTIL_MSG(m_param.LogLevel, 2,
+            (*m_osLog) << "Wrote " << cf.getNumVars()
+            << " columns to " << fileName << endl;
+           );
+   UtilPrintFuncEnd(m_osLog, m_classTag,
+                    "writeColumnFile()", m_param.LogDebugLevel, 2);
+}
+
+//===========================================================================//
+void DecompAlgo::writeTrace() const
+{
+   if (!m_trace.isEnabled()) {
+      return;
+   }
+
+   if (!m_trace.write(m_param.TraceFile, m_param.TraceFormat == 1)) {
+      (*m_osLog) << "Warning: could not write trace file "
+                 << m_param.TraceFile << endl;
+   } else {
+      UTIL_MSG(m_param.LogLevel, 2,
+               (*m_osLog) << "Trace written to " << m_param.TraceFile
+               << endl;
+              );
+   }
+}
+
+//===========================================================================//
+static double packedVectorBytes(const CoinPackedVector* v)
+{
+   if (!v) {
+      return 0.0;
+   }
+
+   return static_cast<double>(sizeof(CoinPackedVector) +
+                              v->getNumElements() *
+                              (sizeof(int) + sizeof(double)));
+}
+
+//===========================================================================//
+static double solverBytes(OsiSolverInterface* si,
+                          double&             namesBytes)
+{
+   if (!si) {
+      return 0.0;
+   }
+
+   //---
+   //--- the matrix (by column and by row), bounds, objective, solution
+   //---
+   const double nRows = si->getNumRows();
+   const double nCols = si->getNumCols();
+   const double nEls  = si->getNumElements();
+   namesBytes += UtilStringBytes(si->getRowNames())
+                 + UtilStringBytes(si->getColNames());
+   return 2.0 * nEls * (sizeof(int) + sizeof(double))
+          + (nRows + nCols) * (sizeof(CoinBigIndex) + sizeof(int))
+          + (nRows + nCols) * 4.0 * sizeof(double);
+}
+
+//===========================================================================//
+void DecompAlgo::calculateMemoryStats()
+{
+   double names, hashes, model;
+   DecompConstraintSet* modelCore = m_modelCore.getModel();
+   m_stats.memNames       = 0.0;
+   m_stats.memHashes      = 0.0;
+   m_stats.memCoreModel   = 0.0;
+   m_stats.memBlockModels = 0.0;
+   m_stats.memMaster      = 0.0;
+   m_stats.memVars        = 0.0;
+   m_stats.memVarPool     = 0.0;
+   m_stats.memCuts        = 0.0;
+   m_stats.memCutPool     = 0.0;
+   m_stats.memScratch     = 0.0;
+
+   if (modelCore) {
+      modelCore->getMemoryUsage(names, hashes, model);
+      m_stats.memNames     += names;
+      m_stats.memHashes    += hashes;
+      m_stats.memCoreModel += model;
+   }
+
+   m_stats.memCoreModel += solverBytes(m_cutgenSI, m_stats.memNames);
+   m_stats.memCoreModel += solverBytes(m_auxSI,    m_stats.memNames);
+   map<int, DecompSubModel>::const_iterator mit;
+
+   for (mit = m_modelRelax.begin(); mit != m_modelRelax.end(); mit++) {
+      const DecompConstraintSet* relax = (*mit).second.getModel();
+
+      if (relax) {
+         relax->getMemoryUsage(names, hashes, model);
+         m_stats.memNames       += names;
+         m_stats.memHashes      += hashes;
+         m_stats.memBlockModels += model;
+      }
+
+      m_stats.memBlockModels += solverBytes((*mit).second.getOsi(),
+                                            m_stats.memNames);
+   }
+
+   m_stats.memMaster = solverBytes(m_masterSI, m_stats.memNames)
+                       + UtilVectorBytes(m_masterRowType)
+                       + UtilVectorBytes(m_masterColType)
+                       + UtilVectorBytes(m_masterArtCols);
+   DecompVarList::const_iterator li;
+
+   for (li = m_vars.begin(); li != m_vars.end(); li++) {
+      m_stats.memVars   += sizeof(DecompVar) + packedVectorBytes(&(*li)->m_s);
+      m_stats.memHashes += UtilStringBytes((*li)->getStrHash());
+   }
+
+   DecompVarPool::const_iterator vi;
+
+   for (vi = m_varpool.begin(); vi != m_varpool.end(); vi++) {
+      const DecompVar* var = (*vi).getVarPtr();
+      m_stats.memVarPool += packedVectorBytes((*vi).getColPtr());
+
+      if (var) {
+         m_stats.memVarPool += sizeof(DecompVar) + packedVectorBytes(&var->m_s);
+         m_stats.memHashes  += UtilStringBytes(var->getStrHash());
+      }
+   }
+
+   DecompCutList::const_iterator ci;
+
+   for (ci = m_cuts.begin(); ci != m_cuts.end(); ci++) {
+      m_stats.memCuts   += sizeof(DecompCut);
+      m_stats.memHashes += UtilStringBytes((*ci)->getStrHash());
+   }
+
+   DecompCutPool::const_iterator ri;
+
+   for (ri = m_cutpool.begin(); ri != m_cutpool.end(); ri++) {
+      const DecompCut* cut = (*ri).getCutPtr();
+      m_stats.memCutPool += packedVectorBytes((*ri).getRowPtr())
+                            + packedVectorBytes((*ri).getRowReformPtr());
+
+      if (cut) {
+         m_stats.memCutPool += sizeof(DecompCut);
+         m_stats.memHashes  += UtilStringBytes(cut->getStrHash());
+      }
+   }
+
+   //---
+   //--- the scratch arenas of all threads
+   //---
+   m_stats.scratchRequests = 0;
+   m_stats.scratchAllocs   = 0;
+   m_stats.scratchBytes    = 0.0;
+
+   for (int t = 0; t <= m_numMemPoolThreads; t++) {
+      const DecompMemPool& pool = t ? m_memPoolThreads[t - 1] : m_memPool;
+      m_stats.memScratch      += pool.getBytesHeld();
+      m_stats.scratchRequests += pool.getNumRequests();
+      m_stats.scratchAllocs   += pool.getNumAllocs();
+      m_stats.scratchBytes    += pool.getBytesAllocated();
+   }
+
+   m_stats.memCalculated = true;
+}
+
+//===========================================================================//
+int DecompAlgo::loadColumnFile(DecompVarList& initVars)
+{
+   UtilPrintFuncBegin(m_osLog, m_classTag,
+                      "loadColumnFile()", m_param.LogDebugLevel, 2);
+   DecompColumnFile cf;
+   string           errMsg;
+
+   if (!cf.read(m_param.InitColumnFile, errMsg)) {
+      (*m_osLog) << "InitColumnFile not used: " << errMsg << endl;
+      UtilPrintFuncEnd(m_osLog, m_classTag,
+                       "loadColumnFile()", m_param.LogDebugLevel, 2);
+      return 0;
+   }
+
+   const DecompConstraintSet* modelCore = m_modelCore.getModel();
+   const int                  nCols     = modelCore->getNumCols();
+   const vector<string>&      colNames  = modelCore->getColNames();
+   const double*              colLB     = modelCore->getColLB();
+   const double*              colUB     = modelCore->getColUB();
+   const double*              objCoeff  = m_app->m_objective;
+   //---
+   //--- map the stored column indices to ours: identical if the columns
+   //---   are the same, otherwise by name (-1 if the column is gone)
+   //---
+   vector<int> colMap(cf.numCols, -1);
+
+   if (cf.colNames == colNames ||
+         (cf.colNames.empty() && cf.numCols == nCols)) {
+      for (int j = 0; j < cf.numCols && j < nCols; j++) {
+         colMap[j] = j;
+      }
+   } else {
+      map<string, int> nameToIndex;
+
+      for (int j = 0; j < static_cast<int>(colNames.size()); j++) {
+         nameToIndex.insert(make_pair(colNames[j], j));
+      }
+
+      for (int j = 0; j < static_cast<int>(cf.colNames.size()) &&
+            j < cf.numCols; j++) {
+         map<string, int>::const_iterator it = nameToIndex.find(cf.colNames[j]);
+
+         if (it != nameToIndex.end()) {
+            colMap[j] = it->second;
+         }
+      }
    }
 
-   if (m_param.InitVarsWithIP) {
-      printf("======= BEGIN Gen Init Vars - call Direct IP solver\n");
-      DecompAlgoC          direct(m_app, *m_utilParam);
-      DecompSolverResult* result = NULL;
-      double oldSetting = m_param.TimeLimit;
-      m_param.TimeLimit = m_param.InitVarsWithIPTimeLimit;
-      result = direct.solveDirect();
-      m_param.TimeLimit = oldSetting;
+   //---
+   //--- block of each column (-1 if in none)
+   //---
+   vector<int> colBlock(nCols, -1);
+   map<int, DecompSubModel>::iterator mit;
 
-      if (result->m_nSolutions) {
-         //---
-         //--- if an incumbent was found, create a var(s) from it
-         //---
-         //TODO: safe to assume 0th is the best
-         const double* solution = result->getSolution(0);
-         const DecompVarType varType = result->m_isUnbounded ? DecompVar_Ray : DecompVar_Point;
+   for (mit = m_modelRelax.begin(); mit != m_modelRelax.end(); mit++) {
+      const vector<int>& activeCols
+         = (*mit).second.getModel()->getActiveColumns();
 
-         if (m_numConvexCon == 1) {
-            DecompVar* directVar = new DecompVar(nCoreCols,
-                                                 solution,
-                                                 0.0, result->m_objUB, varType);
-            initVars.push_back(directVar);
-         } else {
-            map<int, DecompSubModel>::iterator mid;
+      for (size_t k = 0; k < activeCols.size(); k++) {
+         colBlock[activeCols[k]] = (*mit).first;
+      }
+   }
 
-            for (mid = m_modelRelax.begin(); mid != m_modelRelax.end(); mid++) {
-               int               blockId       = (*mid).first;
-               DecompSubModel& modelRelax    = (*mid).second;
-               vector<int>&      activeColumns
-               = modelRelax.getModel()->activeColumns;
-               vector<int>       ind;
-               vector<double>    els;
-               double            origCost = 0.0;
-               vector<int>::iterator it;
+   //---
+   //--- check and create the columns in parallel
+   //---
+   const int          nVars = cf.getNumVars();
+   vector<DecompVar*> vars(nVars, static_cast<DecompVar*>(NULL));
+#ifdef _OPENMP
+   #pragma omp parallel for schedule(dynamic, 64)
+#endif
 
-               for (it  = activeColumns.begin();
-                     it != activeColumns.end(); it++) {
-                  if (!UtilIsZero(solution[*it])) {
-                     ind.push_back(*it);
-                     els.push_back(solution[*it]);
-                     origCost += objCoeff[*it] * solution[*it];
-                  }
-               }
+   for (int v = 0; v < nVars; v++) {
+      const int      block   = cf.blockId[v];
+      const int      varType = cf.varType[v];
+      vector<int>    ind;
+      vector<double> els;
+      double         origCost = 0.0;
+      bool           ok       = varType == DecompVar_Point ||
+                                varType == DecompVar_Ray;
+
+      for (CoinBigIndex k = cf.start[v]; ok && k < cf.start[v + 1]; k++) {
+         const int    jFile = cf.ind[k];
+         const int    j     = jFile >= 0 && jFile < cf.numCols ?
+                              colMap[jFile] : -1;
+         const double x     = cf.els[k];
+
+         if (j < 0 || colBlock[j] != block) {
+            ok = false;
+            break;
+         }
 
-               DecompVar* directVar
-               = new DecompVar(ind, els, 0.0, origCost, varType);
-               directVar->setBlockId(blockId);
-               initVars.push_back(directVar);
-            }
+         if (varType == DecompVar_Point &&
+               (x < colLB[j] - DecompEpsilon || x > colUB[j] + DecompEpsilon)) {
+            ok = false;
+            break;
          }
 
-         //---
-         //--- update the upper bound
-         //---
-         double bestBoundUB = m_nodeStats.objBest.second;
+         ind.push_back(j);
+         els.push_back(x);
+         origCost += objCoeff[j] * x;
+      }
 
-         if (result->m_objUB < bestBoundUB) {
-            DecompSolution* directSol = new DecompSolution(nCoreCols,
-                  solution,
-                  result->m_objUB);
-            m_xhatIPFeas.push_back(directSol);
-            m_xhatIPBest = directSol;
-            setObjBoundIP(result->m_objUB);
-         }
+      if (!ok) {
+         continue;
       }
 
-      printf("======= END   Gen Init Vars - call Direct IP solver\n");
+      DecompVar* var = new DecompVar(ind, els, -m_infinity, origCost,
+                                     static_cast<DecompVarType>(varType));
+      var->setBlockId(block);
+      vars[v] = var;
    }
 
    //---
-   //--- check init vars for incumbent
+   //--- add the columns that are not already there
    //---
-   if (m_numConvexCon == 1) {
-      DecompVarList::iterator vli;
+   set<string>             hashes;
+   DecompVarList::iterator vli;
+   int                     nAdded   = 0;
+   int                     nSkipped = 0;
 
-      for (vli = initVars.begin(); vli != initVars.end(); vli++) {
-         //---
-         //--- unlikey to happen - but we should check ALL columns
-         //---  to see if they are IP feasible
-         //---
-         (*vli)->fillDenseArr(modelCore->getNumCols(),
-                              m_memPool.dblArrNCoreCols);
+   for (vli = initVars.begin(); vli != initVars.end(); vli++) {
+      hashes.insert((*vli)->getStrHash());
+   }
 
-         if (isIPFeasible(m_memPool.dblArrNCoreCols)) {
-            if (m_app->APPisUserFeasible(m_memPool.dblArrNCoreCols,
-                                         modelCore->getNumCols(),
-                                         m_param.TolZero)) {
-               DecompSolution* decompSol
-               = new DecompSolution(modelCore->getNumCols(),
-                                    m_memPool.dblArrNCoreCols,
-                                    (*vli)->getOriginalCost());
-               m_xhatIPBest = decompSol;
-               m_xhatIPFeas.push_back(decompSol);
-               //printf("var is ip feas with obj = %g\n",
-               //     (*vli)->getOriginalCost());
-               setObjBoundIP((*vli)->getOriginalCost());
-            }
-         }
+   for (int v = 0; v < nVars; v++) {
+      if (!vars[v]) {
+         nSkipped++;
+         continue;
+      }
+
+      if (!hashes.insert(vars[v]->getStrHash()).second) {
+         UTIL_DELPTR(vars[v]);
+         nSkipped++;
+         continue;
       }
+
+      initVars.push_back(vars[v]);
+      nAdded++;
    }
 
-   //---
-   //--- this will update the global UB before we start processing
-   //---   if we were lucky enough to find an incumbent in init vars
-   //---
-   //setCutoffUB(getCutoffUB());
-   m_function = DecompFuncGeneric;
+   UTIL_MSG(m_param.LogLevel, 1,
+            (*m_osLog) << "InitColumnFile " << m_param.InitColumnFile
+            << ": " << nAdded << " columns added, "
+            << nSkipped << " skipped." << endl;
+           );
    UtilPrintFuncEnd(m_osLog, m_classTag,
-                    "generateInitVars()", m_param.LogDebugLevel, 2);
-   nInitVars = static_cast<int>(initVars.size());
-   return nInitVars;
+                    "loadColumnFile()", m_param.LogDebugLevel, 2);
+   return nAdded;
 }
 
 //===========================================================================//
@@ -3735,8 +5480,11 @@ bool DecompAlgo::updateObjBound(const double mostNegRC)
    const double* colUpper = m_masterSI->getColUpper();
    //rStat might not be needed now, but will be needed
    // when we support ranged rows.
-   int* rStat = new int[m_masterSI->getNumRows()];
-   int* cStat = new int[m_masterSI->getNumCols()];
+   DecompMemPool& scratch = getScratch();
+   int* rStat = scratch.getIntArr(DecompScratch_RowStat,
+                                  m_masterSI->getNumRows());
+   int* cStat = scratch.getIntArr(DecompScratch_ColStat,
+                                  m_masterSI->getNumCols());
    m_masterSI->getBasisStatus(cStat, rStat);
 
    for (int c = 0; c < m_numCols; c++) {
@@ -3754,7 +5502,7 @@ bool DecompAlgo::updateObjBound(const double mostNegRC)
    }
 
    //zDW_LB = zDW_UBDual + mostNegRC;
-   zDW_LB = zDW_UBPrimal + mostNegRC;
+   zDW_LB = zDW_UBPrimal - m_masterObjGap + mostNegRC;
    setObjBound(zDW_LB, zDW_UBPrimal);
    /*
    double actDiff = fabs(zDW_UBDual - zDW_UBPrimal);
@@ -3813,14 +5561,46 @@ bool DecompAlgo::updateObjBound(const double mostNegRC)
                  << " isTight = " << isGapTight << "\n";
    }
 
-   UTIL_DELARR(rStat);
-   UTIL_DELARR(cStat);
    m_relGap = relGap;
    UtilPrintFuncEnd(m_osLog, m_classTag,
                     "updateObjBound()", m_param.LogDebugLevel, 2);
    return isGapTight;
 }
 
+//===========================================================================//
+double DecompAlgo::roundNodeBound(const double thisLB) const
+{
+   if (!m_param.NodeBoundRounding || !m_objIntegral ||
+         thisLB <= -m_infinity || thisLB >= m_infinity) {
+      return thisLB;
+   }
+
+   //---
+   //--- every solution has an integral value, so none is below ceil(LB)
+   //---   (less a tolerance, LB = 3 + 1e-9 must not round to 4)
+   //---
+   return ceil(thisLB - DecompEpsilon);
+}
+
+//===========================================================================//
+bool DecompAlgo::isNodeBoundPruned(const double thisLB,
+                                   const double globalUB,
+                                   const bool   isGlobal) const
+{
+   if (thisLB <= -m_infinity || globalUB >= m_infinity) {
+      return false;
+   }
+
+   const double bound = roundNodeBound(thisLB);
+
+   if (bound >= globalUB - m_param.NodeFathomAbsGap) {
+      return true;
+   }
+
+   return UtilCalculateGap(bound, globalUB, m_infinity)
+          <= (isGlobal ? m_param.NodeFathomRelGap : m_param.NodePruneRelGap);
+}
+
 //===========================================================================//
 void DecompAlgo::masterPhaseItoII()
 {
@@ -4060,10 +5840,45 @@ void DecompAlgo::phaseUpdate(DecompPhase&   phase,
    //--- was the current model found to be infeasible?
    //---
    if (status == STAT_INFEASIBLE) {
+      //---
+      //--- Farkas pricing: price against the infeasibility certificate
+      //---   of the master, the artificials stay fixed to 0
+      //---
+      if (useFarkasPricing()) {
+         if (phase == PHASE_PRICE1 && m_farkasPricing &&
+               priceCallsTotal > 0 && varsThisCall == 0) {
+            //---
+            //--- no column cuts off the ray, the node is infeasible
+            //---
+            UTIL_MSG(m_app->m_param.LogDebugLevel, 3,
+                     (*m_osLog)
+                     << "Node " << getNodeIndex()
+                     << " is Infeasible (Farkas)." << endl;);
+            m_farkasPricing = false;
+            m_stopCriteria  = DecompStopInfeasible;
+            nextPhase       = PHASE_DONE;
+            nextStatus      = STAT_INFEASIBLE;
+            goto PHASE_UPDATE_FINISH;
+         }
+
+         if (getFarkasRay(m_dualSolution)) {
+            m_farkasPricing   = true;
+            m_firstPhase2Call = false;
+            nextPhase         = PHASE_PRICE1;
+            nextStatus        = status;
+            goto PHASE_UPDATE_FINISH;
+         }
+
+         UTIL_MSG(m_param.LogLevel, 3,
+                  (*m_osLog) << "No usable Farkas ray, "
+                  << "switching to phase I." << endl;);
+      }
+
       //---
       //--- otherwise, switch to PHASEI
       //---   NOTE: this can happen when a new cut (or branch cut) is added
       //---
+      m_farkasPricing = false;
       masterPhaseIItoI();
       m_nodeStats.resetBestLB();
       m_firstPhase2Call = false;
@@ -4084,6 +5899,20 @@ void DecompAlgo::phaseUpdate(DecompPhase&   phase,
 
    switch (phase) {
    case PHASE_PRICE1: {
+      //---
+      //--- Farkas pricing made the master feasible, continue in phase II
+      //---   (the objective is already the original one)
+      //---
+      if (m_farkasPricing) {
+         m_farkasPricing   = false;
+         m_firstPhase2Call = true;
+         m_nodeStats.resetCutRound();
+         m_nodeStats.resetPriceRound();
+         nextPhase         = PHASE_PRICE2;
+         nextStatus        = status;
+         goto PHASE_UPDATE_FINISH;
+      }
+
       //---
       //--- we are in PHASEI, check to see if solution is feasible
       //---   to original by checking to see if all artificials are 0
@@ -4580,18 +6409,20 @@ void DecompAlgo::generateVarsAdjustDuals(const double* uOld,
       }
 
       for (r = nBaseCoreRows + m_numConvexCon; r < nMasterRows; r++) {
-         assert(m_masterRowType[r] == DecompRow_Cut);
+         assert(m_masterRowType[r] == DecompRow_Cut ||
+                m_masterRowType[r] == DecompRow_Branch);
       }
    }
 
    //NOTE: if no cuts, don't need to do any of this
    //      if DECOMP,  don't need to do any of this?
    //---
-   //--- append dual vector for any added cuts
+   //--- append dual vector for any added cuts (and lazy branching rows)
    //---    skip over convexity constraints
    //---
    assert((nMasterRows - nBaseCoreRows - m_numConvexCon) ==
-          getNumRowType(DecompRow_Cut));
+          getNumRowType(DecompRow_Cut) +
+          getNumRowType(DecompRow_Branch) - m_nRowsBranch);
    CoinDisjointCopyN(uOld        + nBaseCoreRows + m_numConvexCon,  //from
                      nMasterRows - nBaseCoreRows - m_numConvexCon,  //size
                      uNew        + nBaseCoreRows);                  //to
@@ -4697,8 +6528,9 @@ int DecompAlgo::generateVars(DecompVarList&     newVars,
    }
 
    //THINK: includes artificials now
-   redCostX = new double[nCoreCols]; // (c - uhat.A") in x-space
-   CoinAssertHint(redCostX, "Error: Out of Memory");
+   DecompMemPool& scratch = getScratch();
+   redCostX = scratch.getDblArr(DecompScratch_RedCostX,
+                                nCoreCols); // (c - uhat.A") in x-space
    //THINK: we should be checked col-type to make sure we get the
    //  right rows for the convexity constraints
    UTIL_DEBUG(m_app->m_param.LogDebugLevel, 4,
@@ -4714,8 +6546,8 @@ int DecompAlgo::generateVars(DecompVarList&     newVars,
    //--- it as an offset and just check for < 0 directly, rather than
    //--- less than alpha -- sign switches are a little messy
    //---
-   double* u_adjusted = new double[m - m_numConvexCon];
-   CoinAssertHint(u_adjusted, "Error: Out of Memory");
+   double* u_adjusted = scratch.getDblArr(DecompScratch_DualAdj,
+                                          m - m_numConvexCon);
    //---
    //--- remove the convexity constraints from the dual vector
    //---
@@ -5014,10 +6846,11 @@ int DecompAlgo::generateVars(DecompVarList&     newVars,
                }
             }
 
-            redCostXb = new double[nCoreCols]; // (c - uhat.A") in x-space
-            CoinAssertHint(redCostXb, "Error: Out of Memory");
-            uBlockAdj = new double[m - m_numConvexCon];
-            CoinAssertHint(uBlockAdj, "Error: Out of Memory");
+            // (c - uhat.A") in x-space
+            redCostXb = scratch.getDblArr(DecompScratch_RedCostXBlock,
+                                          nCoreCols);
+            uBlockAdj = scratch.getDblArr(DecompScratch_DualAdjBlock,
+                                          m - m_numConvexCon);
             //---
             //--- remove the convexity constraints from the dual vector
             //---
@@ -5041,8 +6874,6 @@ int DecompAlgo::generateVars(DecompVarList&     newVars,
                          &solveResult,
                          potentialVars,
 			 timeLimit);
-            UTIL_DELARR(redCostXb);
-            UTIL_DELARR(uBlockAdj);
          }
 
          if (solveResult.m_isCutoff) {
@@ -5248,11 +7079,6 @@ int DecompAlgo::generateVars(DecompVarList&     newVars,
       (*it)->print(m_infinity, m_osLog, m_app);
    }
              );
-   //---
-   //--- free local memory
-   //---
-   UTIL_DELARR(u_adjusted);
-   UTIL_DELARR(redCostX);
    m_stats.thisGenVars.push_back(m_stats.timerOther1.getRealTime());
    UtilPrintFuncEnd(m_osLog, m_classTag,
                     "generateVars()", m_param.LogDebugLevel, 2);
@@ -5268,9 +7094,25 @@ int DecompAlgo::generateCuts(double*         xhat,
    UtilPrintFuncBegin(m_osLog, m_classTag,
                       "generateCuts()", m_param.LogDebugLevel, 2);
    m_stats.timerOther1.reset();
+   DecompTraceScope traceCuts(m_trace, DecompTrace_CutGen, getNodeIndex());
    DecompConstraintSet*           modelCore   = m_modelCore.getModel();
-   m_app->generateCuts(xhat,
-                       newCuts);
+   //---
+   //--- the user separation can run as a task of the CGL stage
+   //---
+   const bool userInCgl = m_param.CutCGL && m_param.CutUserParallel &&
+                          m_param.CutCglThreads > 1;
+
+   if (!userInCgl) {
+      m_app->generateCuts(xhat,
+                          newCuts);
+   }
+
+   //---
+   //--- offer the cuts restored from a checkpoint (once)
+   //---
+   if (!m_restartCuts.empty()) {
+      newCuts.splice(newCuts.end(), m_restartCuts);
+   }
 
    //---
    //--- attempt to generate CGL cuts on x??
@@ -5314,7 +7156,8 @@ int DecompAlgo::generateCuts(double*         xhat,
                           m_masterSI,
                           xhat,
                           modelCore->integerVars,
-                          newCuts);
+                          newCuts,
+                          userInCgl ? m_app : NULL);
    }
 
 #if 1
@@ -5323,74 +7166,65 @@ int DecompAlgo::generateCuts(double*         xhat,
    //  this is the case of doing for init vars
    if ((m_param.CutDC == 1 && newCuts.size() == 0) ||
          (m_param.CutDC == 2)) {
-      //printf("\n\n==================================== IN DECOMP\n\n");
-      DecompAlgoD D(m_app, *m_utilParam,
-                    xhat, modelCore->getNumCols());
-      //also might want to use the columns you get here for something...
-      //heur for ubs, etc..
-      //either returns a set of cuts or a decomposition, have
-      //that wrap solve()?
-      D.solveD(&newCuts);
       //---
-      //--- copy the vars generated in passes of DC into initVars
-      //---   to warm-start DW master formulation
+      //--- the separator is kept, so its master and columns are reused
+      //---   (creating it points the application to it, so point the
+      //---   application back to this algorithm)
       //---
-      //--- NO: this won't work because it just copies the pointers
-      //---  and these will be deleted when D scopes out - see DecompAlgo
-      //---  destructor...
-      //m_vars.insert(m_vars.begin(), D.m_vars.begin(), D.m_vars.end());
+      if (!m_algoD) {
+         m_algoD = new DecompAlgoD(m_app, *m_utilParam,
+                                   modelCore->getNumCols());
+         m_app->m_decompAlgo = this;
+      }
+
+      DecompAlgoD* D = static_cast<DecompAlgoD*>(m_algoD);
+      D->solveD(xhat, &newCuts, m_param.CutDCTimeLimit);
       //---
-      //--- this moves the elements of D.m_vars to m_vars
-      //---   this is what we want since D will be deleted after this
+      //--- copy the vars generated in passes of DC into m_vars
+      //---   to warm-start DW master formulation (InitVarsWithCutDC)
       //---
-      m_vars.splice(m_vars.end(), D.m_vars);
-      //printf("VARS moved into CPM object\n");
-      //printVars(m_osLog);//use this to warm start DW
-      //a hidden advantage of decomp in BC?
+      D->copyNewVars(m_vars);
+      //---
+      //--- the decompositions that were feasible are solutions
+      //---
+      vector<DecompSolution*> solsD;
       DecompSolution* bestSol = NULL;
       vector<DecompSolution*>::iterator it;
       double thisBound;
       double bestBoundUB = m_nodeStats.objBest.second;
+      D->takeSolutions(solsD);
 
-      for (it  = D.m_xhatIPFeas.begin();
-            it != D.m_xhatIPFeas.end(); it++) {
+      for (it  = solsD.begin();
+            it != solsD.end(); it++) {
          thisBound = (*it)->getQuality();
          UTIL_DEBUG(m_param.LogDebugLevel, 3,
                     (*m_osLog) << "From DECOMP, IP Feasible with Quality =";
                     (*m_osLog) << thisBound << endl;
                    );
 
-         if ((*it)->getQuality() <= bestBoundUB) {
+         if ((*it)->getQuality() < bestBoundUB) {
             bestBoundUB = (*it)->getQuality();
             bestSol     = (*it);
          }
       }
 
-      //need to make copy of solution, since D.m_xhatIpFeas goes out of scope
       if (bestSol) {
-         DecompSolution* bestSolCp = new DecompSolution(*bestSol);
-         m_xhatIPFeas.push_back(bestSolCp);
-         setObjBoundIP(bestSolCp->getQuality());
-         m_xhatIPBest = bestSolCp;
-         //m_xhatIPBest->print();
+         m_xhatIPFeas.push_back(bestSol);
+         setObjBoundIP(bestSol->getQuality());
+         m_xhatIPBest = bestSol;
       }
 
-      //this could also very likely return a new gUB -
-      //  for the case when it does find a decomposition
-      //  and luckily it is feasible to original?
-      //STOP -- 6/6/08
-      //if decomp is found, then can't use currently - just looking for
-      //farkas -- if decomp is found this means that z_LP = z_DW for that
-      //relaxation??
-      // printf("D.m_stopCriteria = %s\n",
-      //     DecompAlgoStopStr[D.m_stopCriteria].c_str());
-      //who deletes this memory? better to pass in newCuts..
-      //printf("\n\n====================================OUT DECOMP\n\n");
-      //exit(1);
+      for (it = solsD.begin(); it != solsD.end(); it++) {
+         if (*it != bestSol) {
+            UTIL_DELPTR(*it);
+         }
+      }
    }
 
 #endif
    m_stats.thisGenCuts.push_back(m_stats.timerOther1.getRealTime());
+   m_stats.numCutsGenerated += static_cast<int>(newCuts.size());
+   traceCuts.setValue(static_cast<int>(newCuts.size()));
    UtilPrintFuncEnd(m_osLog, m_classTag,
                     "generateCuts()", m_param.LogDebugLevel, 2);
    return static_cast<int>(newCuts.size());
@@ -5413,6 +7247,7 @@ void DecompAlgo::addVarsToPool(DecompVarList& newVars)
    DecompConstraintSet* modelCore = m_modelCore.getModel();
    UtilPrintFuncBegin(m_osLog, m_classTag,
                       "addVarsToPool()", m_param.LogDebugLevel, 2);
+   m_stats.numColsGenerated += static_cast<int>(newVars.size());
    //printf("varpool size=%d\n", m_varpool.size());
    //---
    //--- sanity check - make sure the number of rows in core is
@@ -5431,7 +7266,9 @@ void DecompAlgo::addVarsToPool(DecompVarList& newVars)
       assert((getNumRowType(DecompRow_Original) +
               getNumRowType(DecompRow_Branch)   +
               getNumRowType(DecompRow_Cut)) == modelCore->getNumRows());
-      denseCol = new double[modelCore->getNumRows() + m_numConvexCon];
+      denseCol = getScratch().getDblArr(DecompScratch_DenseCol,
+                                        modelCore->getNumRows() +
+                                        m_numConvexCon);
    }
 
    //---
@@ -5516,7 +7353,8 @@ void DecompAlgo::addVarsToPool(DecompVarList& newVars)
          //in the master, the convexity constraints are put just
          //   after A'' (before any cuts were added)
          assert(m_masterRowType[convexity_index] == DecompRow_Convex);
-         assert(mpp - convexity_index == getNumRowType(DecompRow_Cut));
+         assert(mpp - convexity_index == getNumRowType(DecompRow_Cut) +
+                getNumRowType(DecompRow_Branch) - m_nRowsBranch);
          //---
          //--- for each cut row, move it to right/down
          //---    o=original, b=branch, x=convex, c=cut
@@ -5669,7 +7507,6 @@ void DecompAlgo::addVarsToPool(DecompVarList& newVars)
                     << m_param.DualStabAlpha << "." << endl;
    }
 
-   UTIL_DELARR(denseCol);
    UtilPrintFuncEnd(m_osLog, m_classTag,
                     "addVarsToPool()", m_param.LogDebugLevel, 2);
 }
@@ -5695,6 +7532,8 @@ void DecompAlgo::addVarsFromPool()
       return;
    }
 
+   DecompTraceScope traceAdd(m_trace, DecompTrace_ColumnAdd, getNodeIndex());
+
    //---
    //--- sort the pool by increasing reduced cost
    //---
@@ -5729,6 +7568,7 @@ void DecompAlgo::addVarsFromPool()
    }
 
    n_newcols = std::min<int>(n_newcols, index);
+   traceAdd.setValue(n_newcols);
    //TODO
    /*if(n_newcols > 0)
      m_cutpool.setRowsAreValid(false);*/
@@ -5776,7 +7616,7 @@ void DecompAlgo::addVarsFromPool()
 
       cub[index]      = (*vi).getUpperBound();
 
-      if (m_phase == PHASE_PRICE1) {
+      if (m_phase == PHASE_PRICE1 && !m_farkasPricing) {
          obj[index] = 0.0;
       } else {
          obj[index] = (*vi).getOrigCost();
@@ -6055,9 +7895,13 @@ int DecompAlgo::addCutsFromPool()
       rub[index]      = (*li).getUpperBound();
       rowBlock[index] = row;
       rowIndex        = m_masterSI->getNumRows() + index;
+
       //TODO: allow user to give cut names?
-      rowName         = "cut(" + UtilIntToStr(rowIndex) + ")";
-      rowNames.push_back(rowName);
+      if (!m_param.LowMemory) {
+         rowName = "cut(" + UtilIntToStr(rowIndex) + ")";
+         rowNames.push_back(rowName);
+      }
+
       //---
       //--- add the cut ptr to the list of cuts in masterLP
       //---
@@ -6306,6 +8150,9 @@ DecompStatus DecompAlgo::solveRelaxed(const double*         redCostX,
    int                   whichBlock = subModel.getBlockId();
    bool                  isRoot     = getNodeIndex() ? false : true;
    DecompConstraintSet* model       = subModel.getModel();
+   const size_t          nVarsIn    = vars.size();
+   DecompTraceScope      tracePrice(m_trace, DecompTrace_Pricing,
+                                    getNodeIndex(), whichBlock);
    UTIL_DEBUG(m_app->m_param.LogDebugLevel, 3,
               (*m_osLog) << "solve block b = " << whichBlock << endl;
               (*m_osLog) << "alpha         = " << alpha      << endl;
@@ -6333,6 +8180,19 @@ DecompStatus DecompAlgo::solveRelaxed(const double*         redCostX,
    doExact       = m_function == DecompFuncGenerateInitVars ? false : doExact;
    DecompSolverStatus solverStatus = DecompSolStatNoSolution;
    DecompVarList userVars;
+   //---
+   //--- column branching rows of this block (Ryan-Foster, ...) are only
+   //---   known to the built-in solver
+   //---
+   bool hasColumnRows = false;
+
+   for (size_t i = 0; i < m_branchRows.size(); i++) {
+      if (m_branchRows[i].type == DecompBranchRow_Column &&
+            (m_branchRows[i].blockId < 0 ||
+             m_branchRows[i].blockId == whichBlock)) {
+         hasColumnRows = true;
+      }
+   }
 
    //#ifndef RELAXED_THREADED
    if (m_param.SolveRelaxAsIp != 1) {
@@ -6361,6 +8221,42 @@ DecompStatus DecompAlgo::solveRelaxed(const double*         redCostX,
 
       nNewVars        = static_cast<int>(userVars.size()) - nVars;
 
+      //---
+      //--- drop the user columns that violate a column branching row,
+      //---   the built-in solver (which has the rows) then has to price
+      //---
+      if (hasColumnRows && !userVars.empty()) {
+         const int      nCols  = model->getNumColsOrig();
+         double*        denseS =
+            getScratch().getDblArr(DecompScratch_DenseS, nCols);
+         DecompVarList  keep;
+
+         for (it = userVars.begin(); it != userVars.end(); it++) {
+            bool isValid = true;
+            (*it)->fillDenseArr(nCols, denseS);
+
+            for (size_t i = 0; i < m_branchRows.size() && isValid; i++) {
+               const DecompBranchRow& row = m_branchRows[i];
+
+               if (row.type == DecompBranchRow_Column &&
+                     (row.blockId < 0 || row.blockId == whichBlock)) {
+                  isValid = row.isSatisfied(denseS, DecompEpsilon);
+               }
+            }
+
+            if (isValid) {
+               keep.push_back(*it);
+            } else {
+               UTIL_DELPTR(*it);
+            }
+         }
+
+         if (keep.size() < userVars.size()) {
+            userVars     = keep;
+            nNewVars     = static_cast<int>(userVars.size()) - nVars;
+            solverStatus = DecompSolStatNoSolution;
+         }
+      }
    }
 
    m_isColGenExact = (solverStatus == DecompSolStatOptimal);
@@ -6384,76 +8280,103 @@ DecompStatus DecompAlgo::solveRelaxed(const double*         redCostX,
       //--- However, to prove that the final DW LB is valid, we will need
       //---  solve the pricing problem to optimaity at some point.
       //---
-      assert(subprobSI);
-      //---
-      //--- reset the objective to reduced cost
+      //--- If the block has a recognized structure, try its oracle
+      //---  first; the MIP is only solved if the oracle gives up.
       //---
-      subModel.setOsiObjCoeff(redCostX);
+      bool solvedByOracle = false;
 
-      //---
-      //--- reset the col lbs/ubs to node bounds
-      //---
-      //--- for block angular case, the user must tell us
-      //---   the active columns
-      //---
-      //--- CAREFUL: this overrides the user subproblem column
-      //---  bounds - if for some reason they don't want that
-      //---  to match up with core, this might cause an issue
-      //---
-      if (m_param.BranchEnforceInSubProb) {
-         subModel.setActiveColBounds(m_colLBNode, m_colUBNode);
+      if (!isNested) {
+         map<int, DecompPricingOracle*>::iterator oit
+            = m_pricingOracles.find(whichBlock);
+
+         if (oit != m_pricingOracles.end() && !hasColumnRows) {
+            solvedByOracle = oit->second->solve(redCostX,
+                                                m_param.BranchEnforceInSubProb ?
+                                                m_colLBNode : NULL,
+                                                m_param.BranchEnforceInSubProb ?
+                                                m_colUBNode : NULL,
+                                                solveResult);
+            UTIL_DEBUG(m_param.LogDebugLevel, 4,
+                       (*m_osLog) << "block " << whichBlock << " "
+                       << oit->second->getName() << " oracle "
+                       << (solvedByOracle ? "solved" : "gave up") << endl;
+                      );
+         }
       }
 
-      //---
-      //--- dump subproblem model .mps/.lp
-      //---
-      if (m_param.LogDumpModel > 1) {
-         if (isNested) {
-            string baseName = "subProbN_" + subModel.getModelName();
+      if (!solvedByOracle) {
+         assert(subprobSI);
+         //---
+         //--- reset the objective to reduced cost
+         //---
+         subModel.setOsiObjCoeff(redCostX);
 
-            if (m_isStrongBranch) {
-               baseName += "_SB";
-            }
+         //---
+         //--- reset the col lbs/ubs to node bounds
+         //---
+         //--- for block angular case, the user must tell us
+         //---   the active columns
+         //---
+         //--- CAREFUL: this overrides the user subproblem column
+         //---  bounds - if for some reason they don't want that
+         //---  to match up with core, this might cause an issue
+         //---
+         if (m_param.BranchEnforceInSubProb) {
+            subModel.setActiveColBounds(m_colLBNode, m_colUBNode);
+            subModel.setBranchRows(m_branchRows);
+         }
 
-            printCurrentProblem(subprobSI,
-                                baseName,
-                                m_nodeStats.nodeIndex,
-                                m_nodeStats.cutCallsTotal,
-                                m_nodeStats.priceCallsTotal,
-                                whichBlock);
-         } else {
-            string baseName = "subProb_" + subModel.getModelName();
+         //---
+         //--- dump subproblem model .mps/.lp
+         //---
+         if (m_param.LogDumpModel > 1) {
+            if (isNested) {
+               string baseName = "subProbN_" + subModel.getModelName();
 
-            if (m_isStrongBranch) {
-               baseName += "_SB";
-            }
+               if (m_isStrongBranch) {
+                  baseName += "_SB";
+               }
 
-            std::cout << "problem name is "
-                      << baseName
-                      << m_nodeStats.nodeIndex
-                      << m_nodeStats.cutCallsTotal
-                      << m_nodeStats.priceCallsTotal
-                      << whichBlock
-                      << std::endl;
-            printCurrentProblem(subprobSI,
-                                baseName,
-                                m_nodeStats.nodeIndex,
-                                m_nodeStats.cutCallsTotal,
-                                m_nodeStats.priceCallsTotal,
-                                whichBlock);
+               printCurrentProblem(subprobSI,
+                                   baseName,
+                                   m_nodeStats.nodeIndex,
+                                   m_nodeStats.cutCallsTotal,
+                                   m_nodeStats.priceCallsTotal,
+                                   whichBlock);
+            } else {
+               string baseName = "subProb_" + subModel.getModelName();
+
+               if (m_isStrongBranch) {
+                  baseName += "_SB";
+               }
+
+               std::cout << "problem name is "
+                         << baseName
+                         << m_nodeStats.nodeIndex
+                         << m_nodeStats.cutCallsTotal
+                         << m_nodeStats.priceCallsTotal
+                         << whichBlock
+                         << std::endl;
+               printCurrentProblem(subprobSI,
+                                   baseName,
+                                   m_nodeStats.nodeIndex,
+                                   m_nodeStats.cutCallsTotal,
+                                   m_nodeStats.priceCallsTotal,
+                                   whichBlock);
+            }
          }
-      }
 
-      //---
-      //--- solve: min cx, s.t. A'x >= b', x in Z ([A,b] is in modelRelax.M)
-      //---
-      subModel.solveAsMIP(solveResult,
-			  m_param,
-			  doExact,
-			  doCutoff,
-			  isRoot,
-			  alpha - DecompEpsilon,
-			  timeLimit);
+         //---
+         //--- solve: min cx, s.t. A'x >= b', x in Z ([A,b] is in modelRelax.M)
+         //---
+         subModel.solveAsMIP(solveResult,
+                             m_param,
+                             doExact,
+                             doCutoff,
+                             isRoot,
+                             alpha - DecompEpsilon,
+                             timeLimit);
+      }
       //double * milpSolution = NULL;
       //if(solveResult->m_nSolutions)
       // milpSolution = solveResult->m_solution;
@@ -6494,16 +8417,15 @@ DecompStatus DecompAlgo::solveRelaxed(const double*         redCostX,
 
             //std::cout << "The variable Type is " << varType << std::endl;
             if (model->isSparse()) {
-               //TODO: this can just be a vector? ever need arb access?
-               map<int, int>::const_iterator mcit;
-               const map<int, int>& sparseToOrig = model->getMapSparseToOrig();
+               const vector<int>& sparseToOrig = model->getSparseToOrigIndex();
+               const int          nSparse      =
+                  static_cast<int>(sparseToOrig.size());
 
-               for (mcit  = sparseToOrig.begin();
-                     mcit != sparseToOrig.end(); mcit++) {
-                  i = mcit->first;  //sparse-index
-                  c = mcit->second; //original-index
+               for (i = 0; i < nSparse; i++) {
+                  c = sparseToOrig[i]; //original-index
 
-                  if (!UtilIsZero(milpSolution[i], m_app->m_param.TolZero)) {
+                  if (c >= 0 &&
+                        !UtilIsZero(milpSolution[i], m_app->m_param.TolZero)) {
                      ind.push_back(c);
                      els.push_back(milpSolution[i]);
                      //the reduced cost of shat: (c-uA").s
@@ -6572,8 +8494,8 @@ DecompStatus DecompAlgo::solveRelaxed(const double*         redCostX,
       //---   even if this check is for a nested model, it should
       //---   be feasible to base relaxed model for this block
       //---
-      double* xTemp = new double[n_origCols];
-      assert(xTemp);
+      double* xTemp = getScratch().getDblArr(DecompScratch_DenseS,
+                                             n_origCols);
       DecompVarList::iterator it;
 
       for (it = vars.begin(); it != vars.end(); it++) {
@@ -6598,13 +8520,13 @@ DecompStatus DecompAlgo::solveRelaxed(const double*         redCostX,
          }
       }
 
-      UTIL_DELARR(xTemp);
    }
 
    if (!m_param.SubProbParallel) {
       m_stats.thisSolveRelax.push_back(m_stats.timerOther1.getRealTime());
    }
 
+   tracePrice.setValue(static_cast<int>(vars.size() - nVarsIn));
    UtilPrintFuncEnd(m_osLog, m_classTag,
                     "solveRelaxed()", m_param.LogDebugLevel, 2);
    return STAT_UNKNOWN;
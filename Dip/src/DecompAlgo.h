@@ -51,6 +51,11 @@
 #include "DecompCutPool.h"
 #include "DecompMemPool.h"
 #include "DecompSolution.h"
+#include "DecompCheckpoint.h"
+#include "DecompColumnFile.h"
+#include "DecompTrace.h"
+#include "DecompBranchRow.h"
+#include "DecompPricingOracle.h"
 #include "DecompAlgoCGL.h"
 #include "AlpsDecompTreeNode.h"
 #include "OsiClpSolverInterface.hpp"
@@ -114,9 +119,13 @@ protected:
    DecompNodeStats m_nodeStats;
 
    /**
-    * Memory pool used to reduce the number of allocations needed.
+    * Memory pool used to reduce the number of allocations needed. It is
+    * the scratch arena of thread 0, the other threads (parallel pricing)
+    * use m_memPoolThreads[t - 1]; see getScratch().
     */
-   DecompMemPool m_memPool;
+   DecompMemPool  m_memPool;
+   DecompMemPool* m_memPoolThreads;
+   int            m_numMemPoolThreads;
 
    /**
     * Stream for log file (default to stdout).
@@ -125,6 +134,17 @@ protected:
 
    DecompAlgoCGL* m_cgl;
 
+   /**
+    * The decompose-and-cut separator (a DecompAlgoD, see CutDC), kept
+    * from call to call so its master and columns are reused.
+    */
+   DecompAlgo*    m_algoD;
+
+   /**
+    * Event trace of the decomposition loop (on if TraceFile is set).
+    */
+   DecompTrace    m_trace;
+
    /**
     * Pointer (and label) to current active model core/relax.
     */
@@ -162,6 +182,12 @@ protected:
    std::map<int, DecompSubModel>                m_modelRelax;
    std::map<int, std::vector<DecompSubModel> >  m_modelRelaxNest;
 
+   /**
+    * Pricing oracles for the blocks with a recognized structure
+    * (see DecompPricingOracle), by block id.
+    */
+   std::map<int, DecompPricingOracle*>          m_pricingOracles;
+
 
    /**
     * Containers for variables (current and pool).
@@ -189,11 +215,33 @@ protected:
    std::vector<DecompSolution*>   m_xhatIPFeas;
    DecompSolution*           m_xhatIPBest;
 
+   /**
+    * Checkpoint read at startup (Restart). Its columns and incumbent are
+    * used in initSetup, its open nodes are handed to Alps by the root.
+    */
+   DecompCheckpoint*         m_restart;
+
+   /**
+    * Cuts read from the checkpoint, offered to the cut pool in the
+    * first cut generation pass.
+    */
+   DecompCutList             m_restartCuts;
+
 
    //for cpx
    std::vector<double> m_primSolution;
    std::vector<double> m_dualSolution;
    std::vector<double> m_reducedCost;
+   /**
+    * Duality gap of the last master solution (0 unless the barrier was
+    * stopped early), subtracted from the master value in the bound.
+    */
+   double m_masterObjGap;
+   /**
+    * True if every solution has an integral objective value, so the
+    * node bounds can be rounded up (see NodeBoundRounding).
+    */
+   bool m_objIntegral;
    int m_numCols;
 
    bool m_isColGenExact;
@@ -247,6 +295,12 @@ protected:
    bool         m_firstPhase2Call;
    bool         m_isStrongBranch;
 
+   /**
+    * True while pricing against a Farkas ray of the (infeasible) master,
+    * in PHASE_PRICE1 with the artificial columns fixed to 0.
+    */
+   bool         m_farkasPricing;
+
    const AlpsDecompTreeNode* m_curNode;
 
    std:: vector<int>  m_masterOnlyCols;
@@ -255,6 +309,21 @@ protected:
     */
    std::map<int, int> m_masterOnlyColsMap;
 
+   /**
+    * Branching rows made on demand (BranchEnforceLazy): map from the
+    * core index of a column branched on to the master index of its
+    * x <= u row (its x >= l row is the next one).
+    */
+   bool               m_branchLazy;
+   std::map<int, int> m_branchRowsLazy;
+
+   /**
+    * The branching rows of the current node (see BranchGeneric) and the
+    * master index of the first row of each master row, by name.
+    */
+   std::vector<DecompBranchRow> m_branchRows;
+   std::map<std::string, int>   m_branchRowsGeneric;
+
    // variable dictating whether the branching is implemented
    // in the master problem or the subproblem
 
@@ -347,6 +416,17 @@ public:
                   const int         maxInnerIter = COIN_INT_MAX,
                   const int         maxOuterIter = COIN_INT_MAX);
 
+   /**
+    * Solve the master LP with the barrier of Clp, for
+    * SolveMasterUpdateAlgo = DecompBarrier (or DoInteriorPoint). Without
+    * crossover (MasterBarrierCrossover) the duals are those of an interior
+    * point, which oscillate less than those of a vertex. The barrier may
+    * stop early at MasterBarrierMaxIter iterations: the point is kept if it
+    * is primal and dual feasible, however poorly centered, and its duality
+    * gap is saved in m_masterObjGap.
+    */
+   void solveMasterBarrierClp();
+
    /**
     * Update of the phase for process loop.
     */
@@ -402,6 +482,22 @@ public:
       }
    }
 
+   /**
+    * The bound thisLB of a node, rounded up if the objective is integral
+    * (see NodeBoundRounding).
+    */
+   double roundNodeBound(const double thisLB) const;
+
+   /**
+    * True if a node with bound thisLB cannot improve on the incumbent
+    * globalUB (see NodeFathomAbsGap, NodePruneRelGap). With isGlobal,
+    * thisLB is the best bound of the open nodes and the relative
+    * tolerance is the optimality gap NodeFathomRelGap.
+    */
+   bool isNodeBoundPruned(const double thisLB,
+                          const double globalUB,
+                          const bool   isGlobal = false) const;
+
    /**
     * Return the value of infinity
     */
@@ -426,6 +522,21 @@ public:
    std::vector<double*> getDualRays(int maxNumRays);
    std::vector<double*> getDualRaysCpx(int maxNumRays);
    std::vector<double*> getDualRaysOsi(int maxNumRays);
+
+   /**
+    * Get the infeasibility certificate of the master from the LP solver
+    * (Farkas pricing). The ray is oriented like a phase I dual, so that
+    * pricing with c=0 finds the columns that cut it off. Returns false
+    * if the solver gives no ray or it does not prove infeasibility.
+    */
+   bool getFarkasRay(std::vector<double>& ray);
+
+   /**
+    * Is Farkas pricing used (instead of phase I) for this algorithm?
+    */
+   inline bool useFarkasPricing() const {
+      return m_param.FarkasPricing && m_algo == PRICE_AND_CUT;
+   }
    
    virtual int generateVars(DecompVarList&     newVars,
 			    double&            mostNegReducedCost);
@@ -473,6 +584,16 @@ public:
                                 const double* ubs);
    virtual void setSubProbBounds(const double* lbs,
                                  const double* ubs);
+   /**
+    * Reduced-cost fixing in x-space from the master duals and the LP
+    * relaxation of the blocks: tighten lbs/ubs (the node's bounds) for
+    * the integer columns that cannot move away from a bound in a
+    * solution with objective better than cutoff. Returns the number of
+    * columns tightened (0 if it does not apply, see RedCostFixing).
+    */
+   virtual int reducedCostFixing(double*      lbs,
+                                 double*      ubs,
+                                 const double cutoff);
 
    //int chooseBranchVar(int    & branchedOnIndex,
    //	       double & branchedOnValue);
@@ -481,6 +602,29 @@ public:
                    std::vector< std::pair<int, double> >& downBranchUb,
                    std::vector< std::pair<int, double> >& upBranchLb,
                    std::vector< std::pair<int, double> >& upBranchUb);
+   /**
+    * Branch on a linear function of the variables (see BranchGeneric):
+    * the down and up children get downRows and upRows on top of the rows
+    * of this node. Tried before chooseBranchSet; returns false if there
+    * is nothing to branch on this way.
+    */
+   virtual bool
+   chooseBranchRows(std::vector<DecompBranchRow>& downRows,
+                    std::vector<DecompBranchRow>& upRows);
+   /** Most fractional sum of a core row over a block (or all blocks). */
+   bool chooseBranchSum(std::vector<DecompBranchRow>& downRows,
+                        std::vector<DecompBranchRow>& upRows);
+   /**
+    * Most fractional Ryan-Foster pair: the master weight of the columns
+    * that cover both of two set-partitioning core rows.
+    */
+   bool chooseBranchRyanFoster(std::vector<DecompBranchRow>& downRows,
+                               std::vector<DecompBranchRow>& upRows);
+   /**
+    * Set the branching rows of a node: master rows in the master, column
+    * rows by fixing the violating master columns (and in pricing).
+    */
+   virtual void setBranchRows(const std::vector<DecompBranchRow>& rows);
 
 
 
@@ -497,6 +641,7 @@ public:
    void initSetup();
    void getModelsFromApp();
    void createOsiSubProblem(DecompSubModel& subModel);
+   void createPricingOracles();
    OsiSolverInterface *getOsiLpSolverInterface();
    OsiSolverInterface *getOsiIpSolverInterface();
 
@@ -520,6 +665,27 @@ public:
     *
     */
    void coreMatrixAppendColBounds();
+   /**
+    * Set the branching bounds of the master when the bound rows are
+    * made on demand (BranchEnforceLazy).
+    */
+   void setMasterBranchRows(const double* lbs,
+                            const double* ubs);
+   /**
+    * Append the rows a x <= u and a x >= l of each given row (with the
+    * given bounds, names "ub(name)" and "lb(name)") to the master and to
+    * the core, like cuts. Returns the master index of the first one.
+    */
+   int masterAppendBranchRows(const std::vector<CoinPackedVector>& rows,
+                              const std::vector<std::string>&      names,
+                              const std::vector<double>&           rowLB,
+                              const std::vector<double>&           rowUB);
+   /**
+    * Delete the given branching rows (made on demand) from the master,
+    * with their artificial columns, and from the core, and renumber the
+    * master rows and columns after them.
+    */
+   void masterDeleteBranchRows(std::vector<int>& delRows);
    void checkMasterDualObj();
    bool  checkPointFeasible(const DecompConstraintSet* modelCore,
                             const double*               x);
@@ -593,6 +759,17 @@ public:
                               double*            objCoeff,
                               std::vector<std::string>&    colNames);
 
+   /**
+    * Append the initial variables as columns (A''s plus the convexity
+    * row) to the master matrix with a single appendCols.
+    */
+   void masterMatrixAddVarCols(CoinPackedMatrix* masterM,
+                               DecompVarList&     vars,
+                               double*            colLB,
+                               double*            colUB,
+                               double*            objCoeff,
+                               std::vector<std::string>&    colNames);
+
    void masterMatrixAddArtCol(std::vector<CoinBigIndex>& colBeg,
                               std::vector<int         >& colInd,
                               std::vector<double      >& colVal,
@@ -650,6 +827,52 @@ public:
    void generateVarsCalcRedCost(const double* u,
                                 double*        redCostX);
 
+   /**
+    * Read CheckpointFile (Restart). The stored columns are appended to
+    * initVars, the cuts and incumbent are restored. Returns false if
+    * there is no usable checkpoint.
+    */
+   bool loadCheckpoint(DecompVarList& initVars);
+
+   /**
+    * Fill the columns (m_vars and var pool), the cuts (m_cuts and cut
+    * pool) and the incumbent into a checkpoint.
+    */
+   void fillCheckpoint(DecompCheckpoint& cp) const;
+
+   /**
+    * Identifies the model a checkpoint belongs to.
+    */
+   std::string checkpointStamp() const;
+
+   /**
+    * Collect the columns of m_vars and the var pool.
+    */
+   void collectVars(std::vector<const DecompVar*>& vars) const;
+
+   /**
+    * Read InitColumnFile and append its columns to initVars. Columns
+    * that do not belong to a block or violate the column bounds, and
+    * duplicates, are skipped. Returns the number of columns added.
+    */
+   int loadColumnFile(DecompVarList& initVars);
+
+   /**
+    * Write the columns (m_vars and var pool) to a column file.
+    */
+   void writeColumnFile(const std::string& fileName) const;
+
+   /**
+    * Write the event trace to TraceFile (in the format TraceFormat).
+    */
+   void writeTrace() const;
+
+   /**
+    * Estimate the memory used by each part of the solver (names, hashes,
+    * models, master, columns, cuts) and store it in the stats.
+    */
+   void calculateMemoryStats();
+
 
 
 
@@ -670,6 +893,13 @@ public:
    inline const double* getColUBNode() const {
       return m_colUBNode;
    }
+   /**
+    * The branching rows of the current node. A user pricing solver
+    * (DecompApp::solveRelaxed) must honor its column rows.
+    */
+   inline const std::vector<DecompBranchRow>& getBranchRows() const {
+      return m_branchRows;
+   }
    //inline OsiSolverInterface * getSubProbSI(int b){
    // return m_subprobSI[b];
    //}
@@ -678,6 +908,10 @@ public:
       return m_stats;
    }
 
+   inline const DecompNodeStats& getNodeStats() const {
+      return m_nodeStats;
+   }
+
    inline const double* getOrigObjective() const {
       return m_app->m_objective;
    }
@@ -730,6 +964,18 @@ public:
       return m_xhatIPFeas;
    }
 
+   /**
+    * Checkpoint read at startup (NULL if not restarting or once its
+    * open nodes have been handed to Alps).
+    */
+   inline DecompCheckpoint* getRestart() {
+      return m_restart;
+   }
+
+   inline void clearRestart() {
+      UTIL_DELPTR(m_restart);
+   }
+
    inline const double getCutoffUB() const {
       return m_cutoffUB;
    }
@@ -738,6 +984,13 @@ public:
       return m_stats;
    }
 
+   inline DecompTrace& getTrace() {
+      return m_trace;
+   }
+
+   /** The scratch arena of the calling thread. */
+   DecompMemPool& getScratch();
+
    inline const DecompParam& getDecompParam() const {
       return m_param;
    }
@@ -993,8 +1246,12 @@ public:
       m_stats      (),
       m_nodeStats  (),
       m_memPool    (),
+      m_memPoolThreads   (NULL),
+      m_numMemPoolThreads(0),
       m_osLog      (&std::cout),
       m_cgl          (0),
+      m_algoD        (0),
+      m_trace        (),
       m_origColLB  (),
       m_origColUB  (),
       m_masterSI   (0),
@@ -1010,6 +1267,10 @@ public:
       m_cutoffUB   (m_infinity),
       m_xhatIPFeas (),
       m_xhatIPBest (NULL),
+      m_restart    (NULL),
+      m_restartCuts(),
+      m_masterObjGap(0.0),
+      m_objIntegral (false),
       m_isColGenExact(false),
       m_numConvexCon (1),
       m_rrLastBlock (-1),
@@ -1022,7 +1283,9 @@ public:
       m_masterObjLast(m_infinity),
       m_firstPhase2Call(false),
       m_isStrongBranch(false),
+      m_farkasPricing(false),
       m_masterOnlyCols(),
+      m_branchLazy(false),
       m_branchingImplementation(DecompBranchInSubproblem)
    {
       std::string paramSection = DecompAlgoStr[algo];
@@ -1067,11 +1330,16 @@ public:
       UTIL_DELPTR(m_auxSI);
       UTIL_DELARR(m_xhat);
       UTIL_DELPTR(m_cgl);
+      UTIL_DELPTR(m_algoD);
       UtilDeleteVectorPtr(m_xhatIPFeas);
       UtilDeleteListPtr(m_vars);
       UtilDeleteListPtr(m_cuts);
+      UtilDeleteListPtr(m_restartCuts);
+      UTIL_DELPTR(m_restart);
       UTIL_DELARR(m_colLBNode);
       UTIL_DELARR(m_colUBNode);
+      UtilDeleteMapPtr(m_pricingOracles);
+      UTIL_DELARR(m_memPoolThreads);
    }
    /**
     * @}
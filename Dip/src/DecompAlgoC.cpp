@@ -113,66 +113,10 @@ void DecompAlgoC::recomposeSolution(const double* solution,
 //===========================================================================//
 void DecompAlgoC::phaseDone()
 {
-   //1 = every iter
-   //2 = only at end of node
-#if 0
-   DecompConstraintSet*           modelCore   = m_modelCore.getModel();
-
-   if (m_param.CutDC == 2) {
-      DecompCutList newCuts;
-      printf("\n\n==================================== IN DECOMP\n\n");
-      DecompAlgoD D(m_app, m_utilParam,
-                    m_xhat, modelCore->getNumCols());
-      //also might want to use the columns you get here for something...
-      //heur for ubs, etc..
-      //either returns a set of cuts or a decomposition, have
-      //that wrap solve()?
-      D.solveD(&newCuts);
-      //a hidden advantage of decomp in BC?
-      DecompSolution* bestSol = NULL;
-      vector<DecompSolution*>::const_iterator it;
-      double thisBound;
-      double bestBoundUB = m_nodeStats.objBest.second;
-      const vector<DecompSolution*>& xhatIPFeasD = D.getXhatIPFeas();
-
-      for (it  = xhatIPFeasD.begin();
-            it != xhatIPFeasD.end(); it++) {
-         thisBound = (*it)->getQuality();
-         UTIL_DEBUG(m_param.LogDebugLevel, 3,
-                    (*m_osLog) << "From DECOMP, IP Feasible with Quality =";
-                    (*m_osLog) << thisBound << endl;
-                   );
-
-         if ((*it)->getQuality() <= bestBoundUB) {
-            bestBoundUB = (*it)->getQuality();
-            bestSol     = (*it);
-         }
-      }
-
-      //need to make copy of solution, since D.m_xhatIpFeas goes out of scope
-      if (bestSol) {
-         DecompSolution* bestSolCp = new DecompSolution(*bestSol);
-         m_xhatIPFeas.push_back(bestSolCp);
-         setObjBoundUB(bestSolCp->getQuality());
-         m_xhatIPBest = bestSolCp;
-         //m_xhatIPBest->print();
-      }
-
-      //this could also very likely return a new gUB -
-      //  for the case when it does find a decomposition
-      //  and luckily it is feasible to original?
-      //STOP -- 6/6/08
-      //if decomp is found, then can't use currently - just looking for
-      //farkas -- if decomp is found this means that z_LP = z_DW for that
-      //relaxation??
-      printf("D.m_stopCriteria = %s\n",
-             DecompAlgoStopStr[D.getStopCriteria()].c_str());
-      //who deletes this memory? better to pass in newCuts..
-      printf("\n\n====================================OUT DECOMP\n\n");
-      //exit(1);
-   }
-
-#endif
+   //---
+   //--- decompose-and-cut (CutDC) runs as a separator, from
+   //---   DecompAlgo::generateCuts
+   //---
 }
 
 //===========================================================================//
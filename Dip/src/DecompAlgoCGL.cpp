@@ -26,6 +26,14 @@
 
 using namespace std;
 
+static const int   NumGenerators = 6;
+static const char* GeneratorName[NumGenerators] = {
+   "cliques", "odd-holes", "flow-covers",
+   "knap-covers", "mixint-round", "gomory"
+};
+/** Longest a poor generator is skipped (in calls). */
+static const int   MaxBackoff    = 16;
+
 //===========================================================================//
 int DecompAlgoCGL::initGenerators(const int doClique,
                                   const int doOddHole,
@@ -49,7 +57,7 @@ int DecompAlgoCGL::initGenerators(const int doClique,
    if (doOddHole) {
       m_genOddHole = new CglOddHole;
 
-      if (!m_genClique) {
+      if (!m_genOddHole) {
          return DecompStatOutOfMemory;
       }
    }
@@ -86,25 +94,64 @@ int DecompAlgoCGL::initGenerators(const int doClique,
       }
    }
 
+   //---
+   //--- the generators, in the order their cuts are merged
+   //---
+   CglCutGenerator* gens[NumGenerators] = {
+      m_genClique, m_genOddHole, m_genFlowCover,
+      m_genKnapCover, m_genMixIntRound, m_genGomory
+   };
+   m_gens.clear();
+
+   for (int g = 0; g < NumGenerators; g++) {
+      if (!gens[g]) {
+         continue;
+      }
+
+      Generator gen;
+      gen.name     = GeneratorName[g];
+      gen.gen      = gens[g];
+      gen.nCalls   = 0;
+      gen.nSkipped = 0;
+      gen.nCuts    = 0;
+      gen.time     = 0.0;
+      gen.lastTime = 0.0;
+      gen.skip     = 0;
+      gen.backoff  = 1;
+      m_gens.push_back(gen);
+   }
+
    return status;
 }
 
+//===========================================================================//
+void DecompAlgoCGL::printStats(ostream* os) const
+{
+   if (m_gens.empty()) {
+      return;
+   }
+
+   (*os) << "\n========== CGL Generators ==========\n";
+
+   for (size_t g = 0; g < m_gens.size(); g++) {
+      const Generator& gen = m_gens[g];
+      (*os) << setw(14) << left  << gen.name
+            << " calls= "   << setw(6) << right << gen.nCalls
+            << " skipped= " << setw(6) << right << gen.nSkipped
+            << " cuts= "    << setw(7) << right << gen.nCuts
+            << " time= "    << UtilDblToStr(gen.time, 3) << "\n";
+   }
+}
+
 //===========================================================================//
 int DecompAlgoCGL::generateCuts(OsiSolverInterface* cutGenSI,
                                 OsiSolverInterface* masterSI,
                                 double*              xhat,
                                 vector<int>&         integerVars,
-                                DecompCutList&       newCuts)
+                                DecompCutList&       newCuts,
+                                DecompApp*           userApp)
 {
-   OsiCuts      osiCuts;
    int          status           = DecompStatOk;
-   int          nCliqueCuts      = 0;
-   int          nOddHoleCuts     = 0;
-   int          nFlowCoverCuts   = 0;
-   int          nKnapCoverCuts   = 0;
-   int          nMixIntRoundCuts = 0;
-   int          nGomoryCuts      = 0;
-   int          nTotalCuts       = 0;
    //---
    //--- this is typically coming from relaxed master problem
    //---  which has no defined integers (why not?) you are using
@@ -204,95 +251,165 @@ int DecompAlgoCGL::generateCuts(OsiSolverInterface* cutGenSI,
    printf("Err=%d\n",err);fflush(stdout);
    assert(!err);
    #endif*/
-   if (m_genClique) {
-      UTIL_MSG(m_logLevel, 3,
-               (*m_logStream) << "Calling cut generator: cliques\n";
-              );
-      m_genClique->generateCuts(*cutGenClpSI, osiCuts);
-      nCliqueCuts = osiCuts.sizeCuts() - nTotalCuts;
-      nTotalCuts  = osiCuts.sizeCuts();
+   //---
+   //--- the generators to call this time (scheduling may skip some),
+   //---   longest running first so the slow ones start early
+   //---
+   const int                  nGens = static_cast<int>(m_gens.size());
+   vector< pair<double, int> > byTime;
+   vector<int>                task;
+   int                        g, k, i;
+
+   if (userApp) {
+      task.push_back(-1);
    }
 
-   if (m_genOddHole) {
-      UTIL_MSG(m_logLevel, 3,
-               (*m_logStream) << "Calling cut generator: cliques\n";
-              );
-      m_genOddHole->generateCuts(*cutGenClpSI, osiCuts);
-      nOddHoleCuts = osiCuts.sizeCuts() - nTotalCuts;
-      nTotalCuts   = osiCuts.sizeCuts();
+   for (g = 0; g < nGens; g++) {
+      Generator& gen = m_gens[g];
+
+      if (gen.skip > 0) {
+         gen.skip--;
+         gen.nSkipped++;
+         continue;
+      }
+
+      byTime.push_back(make_pair(-gen.lastTime, g));
    }
 
-   if (m_genFlowCover) {
-      UTIL_MSG(m_logLevel, 3,
-               (*m_logStream) << "Calling cut generator: flow-covers\n";
-              );
-      m_genFlowCover->generateCuts(*cutGenClpSI, osiCuts);
-      nFlowCoverCuts = osiCuts.sizeCuts() - nTotalCuts;
-      nTotalCuts     = osiCuts.sizeCuts();
+   sort(byTime.begin(), byTime.end());
+
+   for (k = 0; k < static_cast<int>(byTime.size()); k++) {
+      task.push_back(byTime[k].second);
    }
 
-   if (m_genKnapCover) {
-      UTIL_MSG(m_logLevel, 3,
-               (*m_logStream) << "Calling cut generator: knap-covers\n";
-              );
-      m_genKnapCover->generateCuts(*cutGenClpSI, osiCuts);
-      nKnapCoverCuts = osiCuts.sizeCuts() - nTotalCuts;
-      nTotalCuts     = osiCuts.sizeCuts();
+   //---
+   //--- in parallel, each generator works on its own copy of the solver
+   //---
+   const int                   nTasks   = static_cast<int>(task.size());
+   const bool                  parallel = m_numThreads > 1 && nTasks > 1;
+   vector<OsiSolverInterface*> taskSI(nTasks, cutGenClpSI);
+   vector<OsiCuts>             genCuts(nGens);
+   vector<double>              genTime(nGens, 0.0);
+   vector<char>                called(nGens, 0);
+   DecompCutList               userCuts;
+
+   if (parallel) {
+      for (k = 0; k < nTasks; k++) {
+         if (task[k] < 0) {
+            continue;
+         }
+
+         taskSI[k] = cutGenClpSI->clone();
+         taskSI[k]->setColSolution(xhat);
+
+         if (warmStart) {
+            taskSI[k]->setWarmStart(warmStart);
+         }
+      }
    }
 
-   if (m_genMixIntRound) {
-      UTIL_MSG(m_logLevel, 3,
-               (*m_logStream) << "Calling cut generator: mixint-round\n";
-              );
-      m_genMixIntRound->generateCuts(*cutGenClpSI, osiCuts);
-      nMixIntRoundCuts = osiCuts.sizeCuts() - nTotalCuts;
-      nTotalCuts       = osiCuts.sizeCuts();
+#ifdef _OPENMP
+   #pragma omp parallel for schedule(dynamic, 1) num_threads(m_numThreads) if (parallel)
+#endif
+
+   for (k = 0; k < nTasks; k++) {
+      UtilTimer timer;
+
+      if (task[k] < 0) {
+         userApp->generateCuts(xhat, userCuts);
+      } else {
+         m_gens[task[k]].gen->generateCuts(*taskSI[k], genCuts[task[k]]);
+         genTime[task[k]] = timer.getRealTime();
+         called[task[k]]  = 1;
+      }
    }
 
-   if (m_genGomory) {
-      UTIL_MSG(m_logLevel, 3,
-               (*m_logStream) << "Calling cut generator: gomory\n";
-              );
-      m_genGomory->generateCuts(*cutGenClpSI, osiCuts);
-      nGomoryCuts = osiCuts.sizeCuts() - nTotalCuts;
-      nTotalCuts  = osiCuts.sizeCuts();
+   if (parallel) {
+      for (k = 0; k < nTasks; k++) {
+         if (taskSI[k] != cutGenClpSI) {
+            UTIL_DELPTR(taskSI[k]);
+         }
+      }
    }
 
-   UTIL_MSG(m_logLevel, 3,
-            (*m_logStream)
-            << "Num clique     cuts= " << nCliqueCuts      << endl
-            << "Num odd-hole   cuts= " << nOddHoleCuts     << endl
-            << "Num flow-cover cuts= " << nFlowCoverCuts   << endl
-            << "Num knap-cover cuts= " << nKnapCoverCuts   << endl
-            << "Num mixed-int  cuts= " << nMixIntRoundCuts << endl
-            << "Num gomory     cuts= " << nGomoryCuts      << endl;
-           );
-   //osiCuts.printCuts();
-   int i;
-
-   for (i = 0; i < osiCuts.sizeRowCuts(); i++) {
-      CoinAssertDebug(osiCuts.rowCut(i).consistent());
-      CoinAssertDebug(osiCuts.rowCut(i).consistent(*cutGenClpSI));
-      CoinAssertDebug(!osiCuts.rowCut(i).infeasible(*cutGenClpSI));
-      //CoinAssertDebug(osiCuts.rowCut(i).violated(xhat) > 1.e-5);
-      DecompCutOsi* decompCut = new DecompCutOsi(osiCuts.rowCut(i));
-
-      if (osiCuts.rowCut(i).violated(xhat) < DecompEpsilon) {
-         UTIL_DEBUG(m_logLevel, 3,
-                    (*m_logStream) <<
-                    "WARNING: CGL cut " << i << " not violated." << endl;
-                    osiCuts.rowCut(i).print();
-                   );
-      } else {
+   //---
+   //--- merge in generator order: keep the violated cuts, and a cut
+   //---   found by several generators only once
+   //---
+   const double infinity = cutGenClpSI->getInfinity();
+   set<string>  cutHash;
+   int          nColCuts = 0;
+   newCuts.splice(newCuts.end(), userCuts);
+
+   for (g = 0; g < nGens; g++) {
+      if (!called[g]) {
+         continue;
+      }
+
+      Generator& gen       = m_gens[g];
+      OsiCuts&   osiCuts   = genCuts[g];
+      int        nViolated = 0;
+      int        nAdded    = 0;
+
+      for (i = 0; i < osiCuts.sizeRowCuts(); i++) {
+         OsiRowCut&       rowCut = osiCuts.rowCut(i);
+         CoinAssertDebug(rowCut.consistent());
+         CoinAssertDebug(rowCut.consistent(*cutGenClpSI));
+         CoinAssertDebug(!rowCut.infeasible(*cutGenClpSI));
+
+         if (rowCut.violated(xhat) < DecompEpsilon) {
+            UTIL_DEBUG(m_logLevel, 3,
+                       (*m_logStream) <<
+                       "WARNING: CGL cut " << i << " not violated." << endl;
+                       rowCut.print();
+                      );
+            continue;
+         }
+
+         nViolated++;
+         DecompCutOsi* decompCut = new DecompCutOsi(rowCut);
+         decompCut->setStringHash(infinity);
+
+         if (!cutHash.insert(decompCut->getStrHash()).second) {
+            UTIL_DELPTR(decompCut);
+            continue;
+         }
+
          newCuts.push_back(decompCut);
+         nAdded++;
+      }
+
+      nColCuts += osiCuts.sizeColCuts();
+      //---
+      //--- statistics and schedule
+      //---
+      gen.nCalls++;
+      gen.nCuts    += nAdded;
+      gen.time     += genTime[g];
+      gen.lastTime  = genTime[g];
+
+      if ((m_schedule && nViolated == 0) ||
+            (m_timeBudget > 0.0 && genTime[g] > m_timeBudget)) {
+         gen.skip    = gen.backoff;
+         gen.backoff = std::min(2 * gen.backoff, MaxBackoff);
+      } else {
+         gen.backoff = 1;
       }
+
+      UTIL_MSG(m_logLevel, 3,
+               (*m_logStream)
+               << "Num " << setw(14) << left << gen.name << " cuts= "
+               << setw(5) << right << nAdded
+               << " (violated= " << nViolated << ")"
+               << " time= " << UtilDblToStr(genTime[g], 3) << endl;
+              );
    }
 
    UTIL_DEBUG(m_logLevel, 3,
 
-   if (osiCuts.sizeColCuts() > 0) {
+   if (nColCuts > 0) {
    (*m_logStream)
-      << "WARNING: " << osiCuts.sizeColCuts()
+      << "WARNING: " << nColCuts
       << " CGL col cuts found." << endl;
    }
              );
@@ -37,9 +37,30 @@
 #include "CglKnapsackCover.hpp"
 #include "CglMixedIntegerRounding2.hpp"
 
+class DecompApp;
+
 //===========================================================================//
 class DecompAlgoCGL {
 
+private:
+   /**
+    * A generator with its statistics. After a call that finds no violated
+    * cut or takes longer than the time budget, a generator is skipped for
+    * m_backoff calls and m_backoff doubles (up to MaxBackoff); a good call
+    * resets it.
+    */
+   struct Generator {
+      std::string      name;
+      CglCutGenerator* gen;
+      int              nCalls;
+      int              nSkipped;
+      int              nCuts;
+      double           time;
+      double           lastTime;
+      int              skip;
+      int              backoff;
+   };
+
    //----------------------------------------------------------------------//
    /**
     * @name Data.
@@ -57,7 +78,17 @@ private:
    CglMixedIntegerRounding2* m_genMixIntRound;
    CglGomory*                 m_genGomory;
 
+   /** The active generators, in the order their cuts are merged. */
+   std::vector<Generator>     m_gens;
+
    DecompAlgoType             m_algo;
+
+   /** Threads for the separation stage (1 = serial). */
+   int                        m_numThreads;
+   /** Time budget per generator call (seconds, 0 = none). */
+   double                     m_timeBudget;
+   /** Skip generators that do not find violated cuts? */
+   bool                       m_schedule;
    /**
     * @}
     */
@@ -76,11 +107,24 @@ public:
                       const int doKnapCover,
                       const int doMixIntRound,
                       const int doGomory);
+
+   /**
+    * Generate the CGL cuts that are violated by xhat. With more than one
+    * thread, the generators run concurrently, each on its own copy of
+    * cutGenSI. If userApp is given, its DecompApp::generateCuts runs as
+    * one more task of the stage (its cuts come first in newCuts); it must
+    * then be thread safe and must not use the solvers of the algorithm.
+    * Cuts found by more than one generator are added once.
+    */
    int generateCuts(OsiSolverInterface* cutGenSI,
                     OsiSolverInterface* masterSI,
                     double*              xhat,
                     std::vector<int>&         integerVars,
-                    DecompCutList&       newCuts);
+                    DecompCutList&       newCuts,
+                    DecompApp*           userApp = NULL);
+
+   /** Print the statistics of each generator. */
+   void printStats(std::ostream* os) const;
 
 
 
@@ -101,6 +145,15 @@ public:
    void setLogStream(std::ostream* logStream) {
       m_logStream = logStream;
    }
+   void setNumThreads(const int numThreads) {
+      m_numThreads = std::max(numThreads, 1);
+   }
+   void setTimeBudget(const double timeBudget) {
+      m_timeBudget = timeBudget;
+   }
+   void setSchedule(const bool schedule) {
+      m_schedule = schedule;
+   }
    /**
     * @}
     */
@@ -126,7 +179,11 @@ public:
       m_genKnapCover  (0),
       m_genMixIntRound(0),
       m_genGomory     (0),
-      m_algo          (algo) {
+      m_gens          (),
+      m_algo          (algo),
+      m_numThreads    (1),
+      m_timeBudget    (0.0),
+      m_schedule      (false) {
    }
 
    /**
@@ -23,6 +23,148 @@ using namespace std;
 
 //TODO: generateInitVars should be based on cost = -xhat
 
+//===========================================================================//
+DecompAlgoStop DecompAlgoD::solveD(const double*  xhat,
+                                   DecompCutList* newCuts,
+                                   const double   timeLimit)
+{
+   UtilPrintFuncBegin(m_osLog, m_classTag,
+                      "solveD()", m_param.LogDebugLevel, 1);
+   //---
+   //--- the application talks to this algorithm during the call
+   //---
+   DecompAlgo* owner    = m_app->m_decompAlgo;
+   m_app->m_decompAlgo = this;
+   m_newCuts           = newCuts;
+   m_xhatD.assign(xhat, xhat + m_numOrigCols);
+   //---
+   //--- price, no cut
+   //---
+   m_param.TotalCutItersLimit   = 0;
+   m_param.RoundCutItersLimit   = 0;
+   m_param.TotalPriceItersLimit = 1000;
+   m_param.RoundPriceItersLimit = 1000;
+   m_param.SolveMasterAsMip     = 0;
+   m_param.TimeLimit            = timeLimit;
+
+   if (!m_isSetupD) {
+      //---
+      //--- first call: build the master around xhat
+      //---
+      initSetup();
+      m_isSetupD = true;
+   } else {
+      //---
+      //--- later calls: keep the columns, move the right-hand side of
+      //---   the original rows to xhat and go back to phase I
+      //---
+      for (int i = 0; i < m_numOrigCols; i++) {
+         m_masterSI->setRowBounds(i, m_xhatD[i], m_xhatD[i]);
+      }
+
+      masterPhaseIItoI();
+   }
+
+   m_stopCriteria = DecompStopNo;
+   m_stats.timerOverall.reset();
+   processNode(NULL, -m_infinity, m_infinity);
+   m_app->m_decompAlgo = owner;
+   UTIL_MSG(m_param.LogLevel, 2,
+            (*m_osLog) << "Decompose-and-cut stop= "
+            << DecompAlgoStopStr[m_stopCriteria]
+            << " columns= " << m_vars.size()
+            << " time= "
+            << UtilDblToStr(m_stats.timerOverall.getRealTime(), 3)
+            << endl;
+           );
+   UtilPrintFuncEnd(m_osLog, m_classTag,
+                    "solveD()", m_param.LogDebugLevel, 1);
+   return m_stopCriteria;
+}
+
+//===========================================================================//
+void DecompAlgoD::copyNewVars(DecompVarList& vars)
+{
+   DecompVarList::iterator li = m_vars.begin();
+   int                     n  = 0;
+
+   for (; li != m_vars.end(); li++, n++) {
+      if (n >= m_numVarsCopied) {
+         vars.push_back(new DecompVar(*(*li)));
+      }
+   }
+
+   m_numVarsCopied = n;
+}
+
+//===========================================================================//
+void DecompAlgoD::takeSolutions(vector<DecompSolution*>& sols)
+{
+   sols.insert(sols.end(), m_xhatIPFeas.begin(), m_xhatIPFeas.end());
+   m_xhatIPFeas.clear();
+   m_xhatIPBest = NULL;
+}
+
+//===========================================================================//
+void DecompAlgoD::decompositionHeuristic()
+{
+   //---
+   //--- xhat = sum{k, s} s lambda[k][s]; the point with the largest
+   //---   weight in each block is a point of P', together they may be
+   //---   feasible (always so, for one block and integral xhat)
+   //---
+   const int             nMasterCols = m_masterSI->getNumCols();
+   const double*         lambda      = m_masterSI->getColSolution();
+   vector<DecompVar*>    bestVar(m_numConvexCon, static_cast<DecompVar*>(0));
+   vector<double>        bestLam(m_numConvexCon, 0.0);
+   DecompVarList::iterator li;
+   int                   b, k;
+
+   for (li = m_vars.begin(); li != m_vars.end(); li++) {
+      const int c = (*li)->getColMasterIndex();
+      b = (*li)->getBlockId();
+
+      if (c < 0 || c >= nMasterCols || b < 0 || b >= m_numConvexCon) {
+         continue;
+      }
+
+      if (lambda[c] > bestLam[b] + DecompEpsilon) {
+         bestLam[b] = lambda[c];
+         bestVar[b] = *li;
+      }
+   }
+
+   vector<double> x(m_numOrigCols, 0.0);
+
+   for (b = 0; b < m_numConvexCon; b++) {
+      if (!bestVar[b]) {
+         return;
+      }
+
+      const CoinPackedVector& s   = bestVar[b]->m_s;
+      const int*              ind = s.getIndices();
+      const double*           els = s.getElements();
+
+      for (k = 0; k < s.getNumElements(); k++) {
+         x[ind[k]] += els[k];
+      }
+   }
+
+   if (!isIPFeasible(&x[0]) ||
+         !m_app->APPisUserFeasible(&x[0], m_numOrigCols, m_param.TolZero)) {
+      return;
+   }
+
+   DecompSolution* decompSol = new DecompSolution(m_numOrigCols,
+                                                  &x[0],
+                                                  getOrigObjective());
+   UTIL_MSG(m_param.LogLevel, 3,
+            (*m_osLog) << "Decomposition gives a solution, quality= "
+            << UtilDblToStr(decompSol->getQuality()) << endl;
+           );
+   m_xhatIPFeas.push_back(decompSol);
+}
+
 // ------------------------------------------------------------------------- //
 void DecompAlgoD::phaseUpdate(DecompPhase&   phase,
                               DecompStatus& status)
@@ -115,6 +257,15 @@ void DecompAlgoD::phaseDone()
          printVars(m_osLog);   //use this to warm start DW
       }
 
+      //---
+      //--- a decomposition was found
+      //---
+      if (m_status == STAT_FEASIBLE) {
+         decompositionHeuristic();
+      }
+
+      UtilPrintFuncEnd(m_osLog, m_classTag,
+                       "phaseDone()", m_param.LogDebugLevel, 1);
       return;
    }
 
@@ -165,7 +316,10 @@ void DecompAlgoD::phaseDone()
    }
 
    if (lhs < 0) {
-      printf(" VIOLATED FARKAS CUT lhs = %g\n", lhs);
+      UTIL_MSG(m_param.LogLevel, 3,
+               (*m_osLog) << "Violated Farkas cut lhs= "
+               << UtilDblToStr(lhs) << endl;
+              );
       CoinPackedVector cut;
       OsiRowCut        rowCut;
 
@@ -216,7 +370,8 @@ void DecompAlgoD::masterMatrixAddArtCols(CoinPackedMatrix* masterM,
    int              r, colIndex;
    DecompConstraintSet*           modelCore   = m_modelCore.getModel();
    vector<string>& rowNames      = modelCore->colNames;
-   bool             hasNames      = rowNames.empty() ? false : true;
+   bool             hasNames      = rowNames.empty() || m_param.LowMemory ?
+                                    false : true;
    string           colName;
    string           strIndex;
    string           colNameL  = origOrBranch == 'O' ? "sOL(c_" : "sBL(c_";
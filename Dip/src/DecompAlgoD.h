@@ -22,11 +22,19 @@
  * \class DecompAlgoD
  * \brief Class for DECOMP algorithm Decomp.
  *
+ * Decompose-and-cut as a separation service: given a point x*, solve
+ *   min  sum{i} (splus[i] + sminus[i])
+ *   s.t. sum{k, s in F'[k]} s[i] lambda[k][s] + splus[i] - sminus[i] = x*[i]
+ *        sum{s in F'[k]} lambda[k][s] = 1, k in K
+ * by pricing. If the objective reaches 0, x* is decomposed into points of
+ * P' (which are tried as solutions); if pricing proves it cannot, x* is
+ * not in P' and the duals give a Farkas cut.
+ *
+ * The object is meant to be kept: the master and its columns are built
+ * on the first call to solveD, later calls only change the right-hand
+ * side to the new point, so the columns found so far warm start them.
  */
 //===========================================================================//
-//THINK: derive from DecompAlgo or DecompAlgoPC?? THINK
-//THINK: how can we reuse this object since call many times?
-//   if init phase is feasible, we are done....
 
 
 //===========================================================================//
@@ -47,15 +55,16 @@ private:
     */
    std::string m_classTag;
 
-   //TODO
-   double*             m_xhatD;
-   //TODO
+   /** The point to decompose. */
+   std::vector<double> m_xhatD;
+   /** Where to put the Farkas cut. */
    DecompCutList*      m_newCuts;
-   //TODO
+   /** Number of original columns (rows of the master). */
    int                 m_numOrigCols;
-
-
-
+   /** Has the master been built? */
+   bool                m_isSetupD;
+   /** Number of columns already handed out by copyNewVars. */
+   int                 m_numVarsCopied;
 
    /**
     * @}
@@ -83,6 +92,12 @@ private:
                             DecompStatus& status);
    virtual void phaseDone();
 
+   /**
+    * Try the decomposition as a solution: the point of each block with
+    * the largest weight.
+    */
+   void decompositionHeuristic();
+
    /**
     * Set the current integer bound and update best/history.
     */
@@ -107,16 +122,23 @@ private:
 
 
 public:
-   void solveD(DecompCutList* newCuts) {
-      m_newCuts = newCuts;
-      //need to change parameters to price, no cut
-      m_param.TotalCutItersLimit   = 0;
-      m_param.RoundCutItersLimit   = 0;
-      m_param.TotalPriceItersLimit = 1000;
-      m_param.RoundPriceItersLimit = 1000;
-      m_param.SolveMasterAsMip      = 0;
-      processNode(NULL, m_infinity, m_infinity);
-   }
+   /**
+    * Decompose xhat: returns the stop criterion, DecompStopInfeasible if
+    * xhat is not in P' (a Farkas cut was then appended to newCuts). The
+    * call stops after timeLimit seconds, without a cut.
+    */
+   DecompAlgoStop solveD(const double*  xhat,
+                         DecompCutList* newCuts,
+                         const double   timeLimit = COIN_DBL_MAX);
+
+   /**
+    * Append copies of the columns generated since the last call (for
+    * example, to warm start a Dantzig-Wolfe master).
+    */
+   void copyNewVars(DecompVarList& vars);
+
+   /** Take the solutions found since the last call. */
+   void takeSolutions(std::vector<DecompSolution*>& sols);
 
 
 public:
@@ -137,20 +159,30 @@ private:
 public:
 
    /**
-    * Default constructors.
+    * Default constructors. The setup is done on the first solveD.
+    *
+    * NOTE: like any algorithm, this sets app->m_decompAlgo to itself;
+    *   an owning algorithm must set it back.
     */
    DecompAlgoD(DecompApp*             app,
                UtilParameters&        utilParam,
-               double*                xhat,
-               int                    numOrigCols) //need to pass this? :
-      :
-   DecompAlgoPC(app, utilParam, false, DECOMP),
-      m_classTag   ("D-ALGOD"),
-      m_xhatD      (xhat),
-      m_newCuts    (0),
-      m_numOrigCols(numOrigCols)
+               int                    numOrigCols) :
+      DecompAlgoPC(app, utilParam, false, DECOMP),
+      m_classTag     ("D-ALGOD"),
+      m_xhatD        (),
+      m_newCuts      (0),
+      m_numOrigCols  (numOrigCols),
+      m_isSetupD     (false),
+      m_numVarsCopied(0)
    {
       m_param.CutCglGomory = 0;
+      //---
+      //--- the master objective is the phase I one by design, and the
+      //---   columns and checkpoints are those of the owning algorithm
+      //---
+      m_param.FarkasPricing  = false;
+      m_param.Restart        = false;
+      m_param.InitColumnFile = "";
    }
 
    /**
@@ -324,6 +324,8 @@ int DecompAlgoPC::compressColumns()
       return status;
    }
 
+   DecompTraceScope traceCompress(m_trace, DecompTrace_ColumnCompress,
+                                  getNodeIndex());
    //TODO: reuse memory
    //TODO: using getBasics instead of getBasis since seems cheaper
    int    c;
@@ -462,6 +464,7 @@ int DecompAlgoPC::compressColumns()
       m_masterSI->deleteCols(static_cast<int>(lpColsToDelete.size()),
                              &lpColsToDelete[0]);
       m_cutpool.setRowsAreValid(false);
+      traceCompress.setValue(static_cast<int>(lpColsToDelete.size()));
       UTIL_MSG(m_param.LogLevel, 3,
                (*m_osLog) << "Num Columns Deleted = "
                << lpColsToDelete.size()
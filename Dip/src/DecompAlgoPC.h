@@ -99,8 +99,9 @@ private:
    virtual const double* getMasterDualSolution() const {
       //---
       //--- return the duals to be used in pricing step
+      //---   (a Farkas ray is not stabilized)
       //---
-      if (m_param.DualStab) {
+      if (m_param.DualStab && !m_farkasPricing) {
          return &m_dualST[0];
       } else {
          return &m_dualSolution[0];
@@ -198,7 +199,7 @@ public:
                 UtilParameters& utilParam,
                 bool             doSetup    = true,
 		const DecompAlgoType   algo = PRICE_AND_CUT) :
-      DecompAlgo(algo, app, utilParam),
+      DecompAlgo(algo, app, utilParam, doSetup),
       m_classTag("D-ALGOPC") {
       //---
       //--- do any parameter overrides of the defaults here
@@ -16,6 +16,8 @@
 #include "DecompAlgo.h"
 #include "DecompVar.h"
 #include "DecompConfig.h"
+#include "DecompMpsReader.h"
+#include "DecompModelCache.h"
 #include <vector>
 #include <set>
 #include <fstream>
@@ -149,6 +151,17 @@ void DecompApp::initializeApp()
    UtilPrintFuncBegin(m_osLog, m_classTag,
                       "initializeApp()", m_param.LogLevel, 2);
 
+   //---
+   //--- the cache holds the user (block file) decomposition only, and
+   //---   not what postsolve needs
+   //---
+   if (m_param.ModelCacheFile != "" && !m_param.Concurrent &&
+         !m_param.Presolve && readModelCache()) {
+      UtilPrintFuncEnd(m_osLog, m_classTag,
+                       "initializeApp()", m_param.LogLevel, 2);
+      return;
+   }
+
    readProblem();
 
    if (!m_param.Concurrent && !NumBlocks) {
@@ -165,6 +178,11 @@ void DecompApp::initializeApp()
       singlyBorderStructureDetection();
    }
 
+   //---
+   //--- presolve once the blocks are known, so that it keeps them
+   //---
+   preprocess();
+
    /*
     * After identifying the strucuture either through files or
     * automatic structure detection, call the method below to
@@ -231,11 +249,43 @@ void DecompApp::readProblem()
       m_lpIO.messageHandler()->setLogLevel(m_param.LogLpLevel);
    }
 
-   if (m_param.InstanceFormat == "MPS") {
+   double offset = 0;
+
+   if (m_param.InstanceFormat == "MPSParallel") {
+      //---
+      //--- the parallel reader needs random access to the file, so
+      //---   compressed files go through CoinMpsIO as usual
+      //---
+      m_param.InstanceFormat = "MPS";
+      string::size_type idx = fileName.rfind('.');
+
+      if (idx != string::npos && fileName.substr(idx + 1) == "gz") {
+         (*m_osLog) << "Compressed instance, using the serial MPS reader."
+                    << endl;
+         m_mpsIO.messageHandler()->setLogLevel(m_param.LogLpLevel);
+      } else {
+         DecompMpsReader reader(m_param.NumThreadsRead, m_infinity,
+                                m_osLog, m_param.LogLevel);
+         rstatus = reader.readMps(fileName.c_str());
+
+         if (rstatus >= 0) {
+            reader.loadInto(m_mpsIO);
+            offset = reader.objectiveOffset();
+         }
+
+         foundFormat = true;
+      }
+   }
+
+   if (foundFormat) {
+      //--- already read by DecompMpsReader
+   } else if (m_param.InstanceFormat == "MPS") {
       rstatus = m_mpsIO.readMps(fileName.c_str());
+      offset  = m_mpsIO.objectiveOffset();
       foundFormat = true;
    } else if (m_param.InstanceFormat == "LP") {
       m_lpIO.readLp(fileName.c_str());
+      offset = m_lpIO.objectiveOffset();
       foundFormat = true;
    }
 
@@ -251,29 +301,16 @@ void DecompApp::readProblem()
    }
 
    if (m_param.LogLevel >= 2) {
-      if (m_param.InstanceFormat == "MPS") {
-         (*m_osLog) << "Objective Offset = "
-                    << UtilDblToStr(m_mpsIO.objectiveOffset()) << endl;
-      } else if (m_param.InstanceFormat == "LP") {
-         (*m_osLog) << "Objective Offset = "
-                    << UtilDblToStr(m_lpIO.objectiveOffset()) << endl;
-      }
+      (*m_osLog) << "Objective Offset = "
+                 << UtilDblToStr(offset) << endl;
    }
 
    //---
    //--- set best known lb/ub
    //---
-   double offset = 0;
-
-   if (m_param.InstanceFormat == "MPS") {
-      offset = m_mpsIO.objectiveOffset();
-   } else if (m_param.InstanceFormat == "LP") {
-      offset = m_lpIO.objectiveOffset();
-   }
-
+   m_objOffset = offset;
    setBestKnownLB(m_param.BestKnownLB + offset);
    setBestKnownUB(m_param.BestKnownUB + offset);
-   preprocess();
 
    if (m_param.InstanceFormat == "MPS") {
       m_matrix = m_mpsIO.getMatrixByRow();
@@ -284,7 +321,181 @@ void DecompApp::readProblem()
 
 
 
-void DecompApp::preprocess() {}
+// --------------------------------------------------------------------- //
+void DecompApp::preprocess()
+{
+   if (!m_param.Presolve) {
+      return;
+   }
+
+   UtilPrintFuncBegin(m_osLog, m_classTag,
+                      "preprocess()", m_param.LogLevel, 2);
+   const bool              isMps = m_param.InstanceFormat == "MPS";
+   const int               nRows = isMps ? m_mpsIO.getNumRows()
+                                   : m_lpIO.getNumRows();
+   const int               nCols = isMps ? m_mpsIO.getNumCols()
+                                   : m_lpIO.getNumCols();
+   const CoinPackedMatrix* M     = isMps ? m_mpsIO.getMatrixByRow()
+                                   : m_lpIO.getMatrixByRow();
+   //---
+   //--- the block of each row, -1 for the core
+   //---
+   vector<int>                      rowBlock(nRows, -1);
+   map<int, vector<int> >::iterator mit;
+   vector<int>::iterator            vit;
+
+   for (mit = m_blocks.begin(); mit != m_blocks.end(); mit++) {
+      for (vit = (*mit).second.begin(); vit != (*mit).second.end(); vit++) {
+         rowBlock[*vit] = (*mit).first;
+      }
+   }
+
+   DecompPresolve* presolve = new DecompPresolve(m_infinity, m_osLog,
+                                                 m_param.LogLevel);
+   CoinAssertHint(presolve, "Error: Out of Memory");
+   bool feasible;
+
+   if (isMps) {
+      feasible = presolve->presolve(*M,
+                                    m_mpsIO.getColLower(),
+                                    m_mpsIO.getColUpper(),
+                                    m_mpsIO.getObjCoefficients(),
+                                    m_mpsIO.integerColumns(),
+                                    m_mpsIO.getRowLower(),
+                                    m_mpsIO.getRowUpper(),
+                                    rowBlock, m_param.ObjectiveSense,
+                                    m_param.PresolvePasses);
+   } else {
+      feasible = presolve->presolve(*M,
+                                    m_lpIO.getColLower(),
+                                    m_lpIO.getColUpper(),
+                                    m_lpIO.getObjCoefficients(),
+                                    m_lpIO.integerColumns(),
+                                    m_lpIO.getRowLower(),
+                                    m_lpIO.getRowUpper(),
+                                    rowBlock, m_param.ObjectiveSense,
+                                    m_param.PresolvePasses);
+   }
+
+   if (!feasible) {
+      //---
+      //--- leave it to the solver to prove it
+      //---
+      (*m_osLog) << "Presolve found the instance infeasible,"
+                 << " it is solved as it is." << endl;
+      UTIL_DELPTR(presolve);
+      UtilPrintFuncEnd(m_osLog, m_classTag,
+                       "preprocess()", m_param.LogLevel, 2);
+      return;
+   }
+
+   if (m_param.LogLevel >= 1) {
+      presolve->printStats();
+   }
+
+   //---
+   //--- the reduced instance replaces the original one in m_mpsIO
+   //---
+   const vector<int>& rowsKept = presolve->getRowsKept();
+   const vector<int>& colsKept = presolve->getColsKept();
+   vector<string>     rowNames;
+   vector<string>     colNames;
+   vector<double>     colLB, colUB, objective, rowLB, rowUB;
+   vector<char>       integerVars;
+   int                i;
+   m_colNamesOrig.clear();
+
+   for (i = 0; i < nCols; i++) {
+      m_colNamesOrig.push_back(isMps ? m_mpsIO.columnName(i)
+                               : m_lpIO.columnName(i));
+   }
+
+   for (i = 0; i < presolve->getNumRows(); i++) {
+      rowNames.push_back(isMps ? m_mpsIO.rowName(rowsKept[i])
+                         : m_lpIO.rowName(rowsKept[i]));
+   }
+
+   for (i = 0; i < presolve->getNumCols(); i++) {
+      colNames.push_back(m_colNamesOrig[colsKept[i]]);
+   }
+
+   presolve->getColumnData(colLB, colUB, objective, integerVars);
+   presolve->getRowData(rowLB, rowUB);
+   const int nColsNew = presolve->getNumCols();
+   const int nRowsNew = presolve->getNumRows();
+   m_mpsIO.setMpsData(presolve->getMatrix(), m_infinity,
+                      nColsNew ? &colLB[0]       : 0,
+                      nColsNew ? &colUB[0]       : 0,
+                      nColsNew ? &objective[0]   : 0,
+                      nColsNew ? &integerVars[0] : 0,
+                      nRowsNew ? &rowLB[0]       : 0,
+                      nRowsNew ? &rowUB[0]       : 0,
+                      colNames, rowNames);
+   m_param.InstanceFormat = "MPS";
+   m_matrix               = m_mpsIO.getMatrixByRow();
+   //---
+   //--- the rows of the blocks, in the reduced instance; the blocks
+   //---   whose rows were all removed are dropped (their columns go to
+   //---   the master) and the others renumbered
+   //---
+   map<int, vector<int> > blocks;
+   int                    blockId = 0;
+
+   for (mit = m_blocks.begin(); mit != m_blocks.end(); mit++) {
+      vector<int> rows;
+
+      for (vit = (*mit).second.begin(); vit != (*mit).second.end(); vit++) {
+         if (presolve->getNewRow(*vit) >= 0) {
+            rows.push_back(presolve->getNewRow(*vit));
+         }
+      }
+
+      if (!rows.empty()) {
+         blocks.insert(make_pair(blockId++, rows));
+      }
+   }
+
+   if (blockId < static_cast<int>(m_blocks.size())) {
+      UTIL_MSG(m_param.LogLevel, 1,
+               (*m_osLog) << "Presolve removed "
+               << m_blocks.size() - blockId << " block(s)." << endl;);
+   }
+
+   m_blocks.swap(blocks);
+   m_presolve = presolve;
+   //---
+   //--- the best known bounds are for the instance
+   //---
+   const double offset = getPresolveObjOffset();
+   setBestKnownLB(getBestKnownLB() - offset);
+   setBestKnownUB(getBestKnownUB() - offset);
+   UtilPrintFuncEnd(m_osLog, m_classTag,
+                    "preprocess()", m_param.LogLevel, 2);
+}
+
+// --------------------------------------------------------------------- //
+double DecompApp::getPresolveObjOffset() const
+{
+   //---
+   //--- the model minimizes ObjectiveSense times the instance objective
+   //---
+   return m_presolve ? m_param.ObjectiveSense * m_presolve->getObjOffset()
+          : 0.0;
+}
+
+// --------------------------------------------------------------------- //
+bool DecompApp::postsolveSolution(const double*   x,
+                                  vector<double>& xOrig,
+                                  vector<string>& colNamesOrig) const
+{
+   if (!m_presolve) {
+      return false;
+   }
+
+   m_presolve->postsolve(x, xOrig);
+   colNamesOrig = m_colNamesOrig;
+   return true;
+}
 
 void DecompApp::readBlockFile()
 {
@@ -631,10 +842,9 @@ void DecompApp::readInitSolutionFile(DecompVarList& initVars)
    //---
    int                    i;
    map<string, int>        colNameToIndex;
-   const vector<string>& colNames = m_modelC->getColNames();
 
    for (i = 0; i < m_modelC->getNumCols(); i++) {
-      colNameToIndex.insert(make_pair(colNames[i], i));
+      colNameToIndex.insert(make_pair(m_modelC->getColName(i), i));
    }
 
    //---
@@ -687,7 +897,16 @@ void DecompApp::readInitSolutionFile(DecompVarList& initVars)
          break;
       }
 
-      colIndex        = colNameToIndex[colName];
+      //---
+      //--- columns removed by presolve are not in the model
+      //---
+      map<string, int>::iterator cit = colNameToIndex.find(colName);
+
+      if (cit == colNameToIndex.end()) {
+         continue;
+      }
+
+      colIndex        = cit->second;
       blockIndex      = colIndexToBlockIndex[colIndex];
       /*
       const double* colLB = m_modelC->getColLB();
@@ -741,7 +960,8 @@ void DecompApp::readInitSolutionFile(DecompVarList& initVars)
                                      -1.0,
                                      origCost);
       var->setBlockId(indexPair.second);
-      var->print(m_decompAlgo->getInfinity(), m_osLog, colNames);
+      var->print(m_decompAlgo->getInfinity(), m_osLog,
+                 m_modelC->getColNames());
       initVars.push_back(var);
       printf("Adding initial variable with origCost = %g\n", origCost);
    }
@@ -1284,6 +1504,14 @@ void DecompApp::createModels()
                 << std::endl ;
    }
 
+   //---
+   //--- snapshot the models before the framework prepares them
+   //---
+   if (m_param.ModelCacheFile != "" && !m_param.Concurrent &&
+         !m_param.Presolve) {
+      writeModelCache(modelCore);
+   }
+
    //---
    //--- set core and system in framework
    //---
@@ -1320,6 +1548,74 @@ void DecompApp::createModels()
    //exit(1);
 }
 
+// --------------------------------------------------------------------- //
+string DecompApp::modelCacheStamp() const
+{
+   vector<string> files;
+   string         dir = m_param.DataDir != "" ?
+                        m_param.DataDir + UtilDirSlash() : "";
+   files.push_back(dir + m_param.Instance);
+   files.push_back(m_param.BlockFile != "" ? dir + m_param.BlockFile : "");
+   files.push_back(m_param.PermuteFile != "" ? dir + m_param.PermuteFile : "");
+   //---
+   //--- options that change what createModels() builds
+   //---
+   files.push_back("UseSparse=" + UtilIntToStr(m_param.UseSparse)
+                   + ",ObjectiveSense=" + UtilIntToStr(m_param.ObjectiveSense)
+                   + ",NumBlocks=" + UtilIntToStr(NumBlocks)
+                   + ",InstanceFormat=" + m_param.InstanceFormat
+                   + ",BlockFileFormat=" + m_param.BlockFileFormat);
+   return DecompModelCache::sourceStamp(files);
+}
+
+// --------------------------------------------------------------------- //
+void DecompApp::writeModelCache(DecompConstraintSet* modelCore)
+{
+   DecompModelCache cache(m_osLog, m_param.LogLevel);
+   cache.write(m_param.ModelCacheFile, modelCacheStamp(), m_objOffset,
+               modelCore->getNumColsOrig(), m_objective, modelCore, m_modelR);
+}
+
+// --------------------------------------------------------------------- //
+bool DecompApp::readModelCache()
+{
+   UtilPrintFuncBegin(m_osLog, m_classTag,
+                      "readModelCache()", m_param.LogLevel, 2);
+   DecompModelCache               cache(m_osLog, m_param.LogLevel);
+   DecompConstraintSet*           modelCore = NULL;
+   map<int, DecompConstraintSet*> modelRelax;
+   vector<double>                 objective;
+   double                         offset = 0.0;
+
+   if (!cache.read(m_param.ModelCacheFile, modelCacheStamp(),
+                   offset, objective, modelCore, modelRelax)) {
+      return false;
+   }
+
+   m_objOffset = offset;
+   setBestKnownLB(m_param.BestKnownLB + offset);
+   setBestKnownUB(m_param.BestKnownUB + offset);
+   setModelObjective(objective.empty() ? NULL : &objective[0],
+                     static_cast<int>(objective.size()));
+   //---
+   //--- same as the end of createModels()
+   //---
+   m_modelC = modelCore;
+   m_modelR = modelRelax;
+   setModelCore(modelCore, "core");
+   map<int, DecompConstraintSet*>::iterator mdi;
+
+   for (mdi = m_modelR.begin(); mdi != m_modelR.end(); mdi++) {
+      setModelRelax((*mdi).second,
+                    "relax" + UtilIntToStr((*mdi).first),
+                    (*mdi).first);
+   }
+
+   UtilPrintFuncEnd(m_osLog, m_classTag,
+                    "readModelCache()", m_param.LogLevel, 2);
+   return true;
+}
+
 /*
 int DecompApp::generateInitVars(DecompVarList & initVars){
    UtilPrintFuncBegin(m_osLog, m_classTag,
@@ -1722,7 +2018,7 @@ void DecompApp::setModelRelax(DecompConstraintSet* model,
 			      const std::string    modelName,
 			      const int            blockId) {
    if (model && !model->hasPrepRun()) {
-      model->prepareModel(m_infinity);
+      model->prepareModel(m_infinity, false, !m_param.LowMemory);
    }
    
    //---
@@ -1749,7 +2045,7 @@ void DecompApp::setModelRelaxNest(DecompConstraintSet* model,
    assert(model);
    
    if (!model->hasPrepRun()) {
-      model->prepareModel(m_infinity);
+      model->prepareModel(m_infinity, false, !m_param.LowMemory);
    }
    
    DecompModel appModel(model, modelName, blockId, *m_utilParam);
@@ -22,6 +22,8 @@
 #include "DecompModel.h"
 #include "DecompSolution.h"
 #include "DecompConstraintSet.h"
+#include "DecompPresolve.h"
+#include "UtilHash.h"
 #include "CoinMpsIO.hpp"
 #include "CoinLpIO.hpp"
 
@@ -65,6 +67,11 @@ protected:
    double m_bestKnownLB;
    double m_bestKnownUB;
 
+   /**
+    * The objective offset (constant term) of the instance.
+    */
+   double m_objOffset;
+
 public:
 
    /** Number of Blocks
@@ -127,6 +134,14 @@ public:
 
    std::map<int, std::vector<int> > m_blocks;
 
+   /** The presolve of the instance (NULL if it was not presolved) */
+
+   DecompPresolve* m_presolve;
+
+   /** Column names of the instance before presolve */
+
+   std::vector<std::string> m_colNamesOrig;
+
 
    /**
     * serves as an index to track different DecompApp
@@ -150,10 +165,28 @@ public:
     */
 
 
-   /** Preprocess (standard ): on the TODO list*/
-
+   /**
+    * Presolve the instance (see the Presolve parameter), once the blocks
+    * are known: the instance and m_blocks are replaced by the reduced
+    * ones.
+    */
    void preprocess();
 
+   /**
+    * Map a solution of the (presolved) model back to the instance:
+    * values and names of the original columns. Returns false if there
+    * was no presolve.
+    */
+   bool postsolveSolution(const double*             x,
+                          std::vector<double>&      xOrig,
+                          std::vector<std::string>& colNamesOrig) const;
+
+   /**
+    * The objective of the columns removed by presolve, to add to the
+    * objective of the model to get the one of the instance.
+    */
+   double getPresolveObjOffset() const;
+
    /**
     * Print startup message to log.
     */
@@ -207,7 +240,7 @@ public:
       assert(model);
 
       if (!model->hasPrepRun()) {
-	 model->prepareModel(m_infinity, true);
+	 model->prepareModel(m_infinity, true, !m_param.LowMemory);
       }
 
       m_modelCore.setModel(model);
@@ -397,6 +430,18 @@ public:
    /** Read block file */
    void readBlockFile();
 
+   /**
+    * Read the models from ModelCacheFile instead of the instance and
+    * block file. Returns false if there is no usable cache.
+    */
+   bool readModelCache();
+
+   /** Write the models created by createModels() to ModelCacheFile */
+   void writeModelCache(DecompConstraintSet* modelCore);
+
+   /** Fingerprint of the files the models are built from */
+   std::string modelCacheStamp() const;
+
    /** Read Problem */
    void readProblem();
 
@@ -444,18 +489,25 @@ public:
       m_osLog      (&std::cout  ),
       m_bestKnownLB(-1e75  ),
       m_bestKnownUB( 1e75  ),
+      m_objOffset  ( 0.0   ),
       NumBlocks    (  0    ),
       m_utilParam  (&utilParam),
       m_objective  ( NULL  ),
       m_modelCore  (utilParam),
       m_matrix     ( NULL  ),
       m_modelC     ( NULL  ),
+      m_presolve   ( NULL  ),
       m_threadIndex(  0    )
    {
       //---
       //--- get application parameters
       //---
       m_param.getSettings(utilParam);
+      //---
+      //--- the hashes are made as the models are set, so this has to be
+      //---   decided before that
+      //---
+      UtilSetCompactHash(m_param.LowMemory);
       
       if (m_param.LogLevel >= 1) {
 	 m_param.dumpSettings();
@@ -473,6 +525,7 @@ public:
       UTIL_DELARR(m_objective);
       UtilDeleteMapPtr(m_modelR);
       UTIL_DELPTR(m_modelC);
+      UTIL_DELPTR(m_presolve);
    };
 };
 
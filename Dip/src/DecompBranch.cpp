@@ -97,3 +97,370 @@ chooseBranchSet(std::vector< std::pair<int, double> >& downBranchLB,
                       "chooseBranchSet()", m_param.LogDebugLevel, 1);
 }
 
+
+// --------------------------------------------------------------------- //
+bool DecompAlgo::
+chooseBranchRows(std::vector<DecompBranchRow>& downRows,
+                 std::vector<DecompBranchRow>& upRows)
+{
+   //---
+   //--- The master of price-and-cut can enforce rows on the master
+   //---   columns; the other algorithms only branch on variables.
+   //---
+   if (m_param.BranchGeneric == 0 || m_algo != PRICE_AND_CUT) {
+      return false;
+   }
+
+   UtilPrintFuncBegin(m_osLog, m_classTag,
+                      "chooseBranchRows()", m_param.LogDebugLevel, 1);
+   bool gotBranch = false;
+
+   if (m_param.BranchGeneric >= 2) {
+      //---
+      //--- Ryan-Foster rows are enforced in the pricing problems
+      //---
+      if (m_param.BranchEnforceInSubProb) {
+         gotBranch = chooseBranchRyanFoster(downRows, upRows);
+      } else {
+         UTIL_MSG(m_param.LogDebugLevel, 3,
+                  (*m_osLog) << "Ryan-Foster branching needs "
+                  << "BranchEnforceInSubProb, skipped.\n";
+                 );
+      }
+   }
+
+   if (!gotBranch && m_param.BranchGeneric != 2) {
+      gotBranch = chooseBranchSum(downRows, upRows);
+   }
+
+   UtilPrintFuncEnd(m_osLog, m_classTag,
+                    "chooseBranchRows()", m_param.LogDebugLevel, 1);
+   return gotBranch;
+}
+
+// --------------------------------------------------------------------- //
+bool DecompAlgo::
+chooseBranchSum(std::vector<DecompBranchRow>& downRows,
+                std::vector<DecompBranchRow>& upRows)
+{
+   //---
+   //--- For each original core row a x, the sums of a x over each block
+   //---   (and over all blocks) are integral if a is integral on integer
+   //---   columns only. Choose the most fractional sum of two or more
+   //---   variables (one variable is left to chooseBranchSet).
+   //---
+   //--- Example, sum over block 1 of row 3 = 1.5:
+   //---    sum(3,1) <= 1 (down)
+   //---    sum(3,1) >= 2 (up  )
+   //---
+   DecompConstraintSet* modelCore = m_modelCore.getModel();
+   const int             nCols     = modelCore->getNumCols();
+   const int             nRows     = modelCore->nBaseRowsOrig;
+   const double*         x         = getXhat();
+   std::vector<char>     isInt(nCols, 0);
+   std::vector<int>      colBlock(nCols, -1);
+   std::vector<int>::const_iterator intIt;
+   std::map<int, DecompSubModel>::iterator mit;
+   int    r, k, j, b;
+   int    branchRow   = -1;
+   int    branchBlock = -1;
+   double branchValue = 0.0;
+   double maxDist     = DecompEpsilon;//TODO: parameter
+
+   for (intIt =  modelCore->integerVars.begin();
+         intIt != modelCore->integerVars.end(); intIt++) {
+      isInt[*intIt] = 1;
+   }
+
+   for (mit = m_modelRelax.begin(); mit != m_modelRelax.end(); mit++) {
+      const std::vector<int>& activeCols
+         = (*mit).second.getModel()->getActiveColumns();
+
+      for (size_t c = 0; c < activeCols.size(); c++) {
+         colBlock[activeCols[c]] = (*mit).first;
+      }
+   }
+
+   const CoinPackedMatrix* M = modelCore->getMatrix();
+   CoinPackedMatrix        rowM(*M);
+
+   if (rowM.isColOrdered()) {
+      rowM.reverseOrdering();
+   }
+
+   for (r = 0; r < nRows; r++) {
+      CoinShallowPackedVector row = rowM.getVector(r);
+      const int*    ind = row.getIndices();
+      const double* els = row.getElements();
+      std::map<int, std::pair<double, int> > blockSum;//block -> (sum,len)
+      std::map<int, std::pair<double, int> >::iterator bit;
+      double total = 0.0;
+      bool   isIntegral = true;
+
+      for (k = 0; k < row.getNumElements() && isIntegral; k++) {
+         j = ind[k];
+
+         if (!isInt[j] || els[k] != floor(els[k])) {
+            isIntegral = false;
+            break;
+         }
+
+         bit = blockSum.insert(std::make_pair(colBlock[j],
+                                              std::make_pair(0.0, 0))).first;
+         bit->second.first  += els[k] * x[j];
+         bit->second.second += 1;
+         total              += els[k] * x[j];
+      }
+
+      if (!isIntegral || row.getNumElements() < 2) {
+         continue;
+      }
+
+      for (bit = blockSum.begin(); bit != blockSum.end(); bit++) {
+         const double v    = bit->second.first;
+         const double dist = fabs(v - floor(v + 0.5));
+
+         if (bit->first >= 0 && bit->second.second >= 2 && dist > maxDist) {
+            maxDist     = dist;
+            branchRow   = r;
+            branchBlock = bit->first;
+            branchValue = v;
+         }
+      }
+
+      //---
+      //--- the sum over all blocks (if it is not a block's sum)
+      //---
+      const double dist = fabs(total - floor(total + 0.5));
+
+      if (blockSum.size() >= 2 && dist > maxDist) {
+         maxDist     = dist;
+         branchRow   = r;
+         branchBlock = -1;
+         branchValue = total;
+      }
+   }
+
+   if (branchRow < 0) {
+      return false;
+   }
+
+   CoinShallowPackedVector row = rowM.getVector(branchRow);
+   DecompBranchRow         down;
+
+   for (k = 0; k < row.getNumElements(); k++) {
+      j = row.getIndices()[k];
+      b = colBlock[j];
+
+      if (branchBlock < 0 || b == branchBlock) {
+         down.ind.push_back(j);
+         down.els.push_back(row.getElements()[k]);
+      }
+   }
+
+   down.type    = DecompBranchRow_Master;
+   down.blockId = branchBlock;
+   down.name    = "sum(" + UtilIntToStr(branchRow) + ","
+                  + (branchBlock < 0 ? std::string("all") :
+                     UtilIntToStr(branchBlock)) + ")";
+   DecompBranchRow up(down);
+   down.lb = -m_infinity;
+   down.ub = floor(branchValue);
+   up.lb   = ceil(branchValue);
+   up.ub   = m_infinity;
+   downRows.push_back(down);
+   upRows.push_back(up);
+   UTIL_MSG(m_param.LogDebugLevel, 3,
+            (*m_osLog) << "branch on " << down.name
+            << " (" << down.ind.size() << " columns) = "
+            << branchValue << "\n";
+           );
+   return true;
+}
+
+// --------------------------------------------------------------------- //
+bool DecompAlgo::
+chooseBranchRyanFoster(std::vector<DecompBranchRow>& downRows,
+                       std::vector<DecompBranchRow>& upRows)
+{
+   //---
+   //--- For set-partitioning core rows (sum of binaries = 1), a column
+   //---   covers row r if it has a 1 in it. If the master weight of the
+   //---   columns covering both r1 and r2 is fractional, branch
+   //---      apart   : (row r1 + row r2) s <= 1 for every column s (down)
+   //---      together: (row r1 - row r2) s  = 0 for every column s (up  )
+   //---   Both are rows on each column, so they are enforced in pricing.
+   //---
+   DecompConstraintSet* modelCore = m_modelCore.getModel();
+   const int             nRows     = modelCore->nBaseRowsOrig;
+   const int             nCols     = modelCore->getNumCols();
+   const double*         colLB     = modelCore->getColLB();
+   const double*         colUB     = modelCore->getColUB();
+   std::vector<char>     isBinary(nCols, 0);
+   std::vector<char>     isSP(nRows, 0);
+   std::vector<int>::const_iterator intIt;
+   int r, k, nSP = 0;
+
+   if (m_primSolution.empty()) {
+      return false;
+   }
+
+   for (intIt =  modelCore->integerVars.begin();
+         intIt != modelCore->integerVars.end(); intIt++) {
+      isBinary[*intIt] = colLB[*intIt] > -DecompEpsilon &&
+                         colUB[*intIt] < 1.0 + DecompEpsilon;
+   }
+
+   const CoinPackedMatrix* M = modelCore->getMatrix();
+   CoinPackedMatrix        rowM(*M);
+   CoinPackedMatrix        colM(*M);
+
+   if (rowM.isColOrdered()) {
+      rowM.reverseOrdering();
+   }
+
+   if (!colM.isColOrdered()) {
+      colM.reverseOrdering();
+   }
+
+   for (r = 0; r < nRows; r++) {
+      CoinShallowPackedVector row = rowM.getVector(r);
+
+      if (modelCore->rowSense[r] != 'E' ||
+            fabs(modelCore->rowRhs[r] - 1.0) > DecompEpsilon) {
+         continue;
+      }
+
+      isSP[r] = 1;
+
+      for (k = 0; k < row.getNumElements(); k++) {
+         if (row.getElements()[k] != 1.0 || !isBinary[row.getIndices()[k]]) {
+            isSP[r] = 0;
+            break;
+         }
+      }
+
+      nSP += isSP[r];
+   }
+
+   if (nSP < 2) {
+      return false;
+   }
+
+   //---
+   //--- weight of the columns covering each pair of rows
+   //---
+   std::map< std::pair<int, int>, double > together;
+   std::map< std::pair<int, int>, double >::iterator pit;
+   DecompVarList::iterator li;
+   const double* lambda = getMasterPrimalSolution();
+
+   for (li = m_vars.begin(); li != m_vars.end(); li++) {
+      const double l = lambda[(*li)->getColMasterIndex()];
+
+      if (l < DecompEpsilon) {
+         continue;
+      }
+
+      const CoinPackedVector& s = (*li)->m_s;
+      std::vector<int>        covered;
+
+      for (k = 0; k < s.getNumElements(); k++) {
+         if (s.getElements()[k] < 0.5) {
+            continue;
+         }
+
+         CoinShallowPackedVector col = colM.getVector(s.getIndices()[k]);
+
+         for (int e = 0; e < col.getNumElements(); e++) {
+            r = col.getIndices()[e];
+
+            if (r < nRows && isSP[r]) {
+               covered.push_back(r);
+            }
+         }
+      }
+
+      std::sort(covered.begin(), covered.end());
+      covered.erase(std::unique(covered.begin(), covered.end()),
+                    covered.end());
+
+      for (size_t a = 0; a < covered.size(); a++) {
+         for (size_t c = a + 1; c < covered.size(); c++) {
+            together[std::make_pair(covered[a], covered[c])] += l;
+         }
+      }
+   }
+
+   int    r1 = -1, r2 = -1;
+   double maxDist = DecompEpsilon;//TODO: parameter
+   double value   = 0.0;
+
+   for (pit = together.begin(); pit != together.end(); pit++) {
+      const double dist = fabs(pit->second - floor(pit->second + 0.5));
+
+      if (dist > maxDist) {
+         maxDist = dist;
+         r1      = pit->first.first;
+         r2      = pit->first.second;
+         value   = pit->second;
+      }
+   }
+
+   if (r1 < 0) {
+      return false;
+   }
+
+   //---
+   //--- apart: row r1 + row r2 <= 1, together: row r1 - row r2 = 0
+   //---
+   std::map<int, std::pair<double, double> > coef;//col -> (apart,together)
+   std::map<int, std::pair<double, double> >::iterator cit;
+   CoinShallowPackedVector row1 = rowM.getVector(r1);
+   CoinShallowPackedVector row2 = rowM.getVector(r2);
+
+   for (k = 0; k < row1.getNumElements(); k++) {
+      cit = coef.insert(std::make_pair(row1.getIndices()[k],
+                                       std::make_pair(0.0, 0.0))).first;
+      cit->second.first  += 1.0;
+      cit->second.second += 1.0;
+   }
+
+   for (k = 0; k < row2.getNumElements(); k++) {
+      cit = coef.insert(std::make_pair(row2.getIndices()[k],
+                                       std::make_pair(0.0, 0.0))).first;
+      cit->second.first  += 1.0;
+      cit->second.second -= 1.0;
+   }
+
+   const std::string pair = UtilIntToStr(r1) + "," + UtilIntToStr(r2);
+   DecompBranchRow   apart, join;
+   apart.type    = DecompBranchRow_Column;
+   apart.blockId = -1;
+   apart.name    = "rfApart(" + pair + ")";
+   apart.lb      = -m_infinity;
+   apart.ub      = 1.0;
+   join.type     = DecompBranchRow_Column;
+   join.blockId  = -1;
+   join.name     = "rfTogether(" + pair + ")";
+   join.lb       = 0.0;
+   join.ub       = 0.0;
+
+   for (cit = coef.begin(); cit != coef.end(); cit++) {
+      apart.ind.push_back(cit->first);
+      apart.els.push_back(cit->second.first);
+
+      if (cit->second.second != 0.0) {
+         join.ind.push_back(cit->first);
+         join.els.push_back(cit->second.second);
+      }
+   }
+
+   downRows.push_back(apart);
+   upRows.push_back(join);
+   UTIL_MSG(m_param.LogDebugLevel, 3,
+            (*m_osLog) << "branch on Ryan-Foster pair (" << pair
+            << ") = " << value << "\n";
+           );
+   return true;
+}
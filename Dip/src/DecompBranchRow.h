@@ -0,0 +1,84 @@
+//===========================================================================//
+// This file is part of the DIP Solver Framework.                            //
+//                                                                           //
+// DIP is distributed under the Eclipse Public License as part of the        //
+// COIN-OR repository (http://www.coin-or.org).                              //
+//                                                                           //
+// Authors: Matthew Galati, SAS Institute Inc. (matthew.galati@sas.com)      //
+//          Ted Ralphs, Lehigh University (ted@lehigh.edu)                   //
+//          Jiadong Wang, Lehigh University (jiw408@lehigh.edu)              //
+//                                                                           //
+// Copyright (C) 2002-2019, Lehigh University, Matthew Galati, Ted Ralphs    //
+// All Rights Reserved.                                                      //
+//===========================================================================//
+
+//===========================================================================//
+#ifndef DecompBranchRow_h_
+#define DecompBranchRow_h_
+
+//===========================================================================//
+#include "Decomp.h"
+
+//===========================================================================//
+/** How a branching row is enforced. */
+enum DecompBranchRowType {
+   /**
+    * lb <= a x <= ub for the x of the master, a row of the master (whose
+    * dual is part of the reduced costs). Works with any pricing solver.
+    */
+   DecompBranchRow_Master,
+   /**
+    * lb <= a s <= ub for every column s of the block(s): the row is added
+    * to the pricing problems and the master columns that violate it are
+    * fixed to 0 (needs BranchEnforceInSubProb).
+    */
+   DecompBranchRow_Column
+};
+
+//===========================================================================//
+/**
+ * A branching decision on a linear function of the original variables,
+ * for branching on more than one variable at a time (sums, Ryan-Foster
+ * pairs, ...). The name identifies the function a x: rows with the same
+ * name share their master row, only the bounds change from node to node.
+ */
+//===========================================================================//
+struct DecompBranchRow {
+   int                 type;
+   /** The block of a column row (-1 = every block). */
+   int                 blockId;
+   std::string         name;
+   std::vector<int>    ind;
+   std::vector<double> els;
+   double              lb;
+   double              ub;
+
+   /** a s for a column s, given as a dense vector in original space. */
+   inline double activity(const double* s) const {
+      double act = 0.0;
+
+      for (size_t k = 0; k < ind.size(); k++) {
+         act += els[k] * s[ind[k]];
+      }
+
+      return act;
+   }
+
+   inline bool isSatisfied(const double* s,
+                           const double  tol) const {
+      const double act = activity(s);
+      return act >= lb - tol && act <= ub + tol;
+   }
+
+   DecompBranchRow() :
+      type   (DecompBranchRow_Master),
+      blockId(-1),
+      name   (),
+      ind    (),
+      els    (),
+      lb     (0.0),
+      ub     (0.0) {
+   }
+};
+
+#endif
@@ -0,0 +1,191 @@
+//===========================================================================//
+// This file is part of the DIP Solver Framework.                            //
+//                                                                           //
+// DIP is distributed under the Eclipse Public License as part of the        //
+// COIN-OR repository (http://www.coin-or.org).                              //
+//                                                                           //
+// Authors: Matthew Galati, SAS Institute Inc. (matthew.galati@sas.com)      //
+//          Ted Ralphs, Lehigh University (ted@lehigh.edu)                   //
+//          Jiadong Wang, Lehigh University (jiw408@lehigh.edu)              //
+//                                                                           //
+// Copyright (C) 2002-2019, Lehigh University, Matthew Galati, Ted Ralphs    //
+// All Rights Reserved.                                                      //
+//===========================================================================//
+
+//===========================================================================//
+#include "DecompCheckpoint.h"
+#include "UtilBinaryIO.h"
+#include "UtilMacrosDecomp.h"
+
+using namespace std;
+
+static const char* CheckpointMagic = "DIPCKPT";
+
+//===========================================================================//
+void DecompCheckpoint::write(const string& fileName) const
+{
+   UtilBinaryWriter out;
+   out.putString(stamp);
+   out.put<double>(timeElapsed);
+   out.put<int32_t>(nodesProcessed);
+   out.put<double>(bestLB);
+   out.put<double>(incumbentValue);
+   out.putVector(incumbent);
+   out.put<uint64_t>(vars.size());
+
+   for (size_t i = 0; i < vars.size(); i++) {
+      const Var& var = vars[i];
+      out.put<int32_t>(var.blockId);
+      out.put<int32_t>(var.varType);
+      out.put<double>(var.origCost);
+      out.putVector(var.ind);
+      out.putVector(var.els);
+   }
+
+   out.put<uint64_t>(cuts.size());
+
+   for (size_t i = 0; i < cuts.size(); i++) {
+      const Cut& cut = cuts[i];
+      out.put<double>(cut.lb);
+      out.put<double>(cut.ub);
+      out.putVector(cut.ind);
+      out.putVector(cut.els);
+   }
+
+   out.put<uint64_t>(nodes.size());
+
+   for (size_t i = 0; i < nodes.size(); i++) {
+      const Node& node = nodes[i];
+      out.put<double>(node.quality);
+      out.put<int32_t>(node.branchedDir);
+      out.putVector(node.colLB);
+      out.putVector(node.colUB);
+      out.put<uint64_t>(node.branchRows.size());
+
+      for (size_t k = 0; k < node.branchRows.size(); k++) {
+         const DecompBranchRow& row = node.branchRows[k];
+         out.put<int32_t>(row.type);
+         out.put<int32_t>(row.blockId);
+         out.putString(row.name);
+         out.putVector(row.ind);
+         out.putVector(row.els);
+         out.put<double>(row.lb);
+         out.put<double>(row.ub);
+      }
+   }
+
+   if (!UtilWriteBinaryFile(fileName, CheckpointMagic, Version,
+                            out.getBuffer())) {
+      throw UtilException("Cannot write checkpoint " + fileName + ".",
+                          "write", "DecompCheckpoint");
+   }
+}
+
+//===========================================================================//
+bool DecompCheckpoint::read(const string& fileName,
+                            string&       errMsg)
+{
+   vector<char> payload;
+
+   if (!UtilReadBinaryFile(fileName, CheckpointMagic, Version,
+                           payload, errMsg)) {
+      return false;
+   }
+
+   UtilBinaryReader in(payload);
+   DecompCheckpoint cp;
+
+   try {
+      cp.stamp          = in.getString();
+      cp.timeElapsed    = in.get<double>();
+      cp.nodesProcessed = in.get<int32_t>();
+      cp.bestLB         = in.get<double>();
+      cp.incumbentValue = in.get<double>();
+      in.getVector(cp.incumbent);
+      uint64_t nVars = in.get<uint64_t>();
+
+      for (uint64_t i = 0; i < nVars; i++) {
+         Var var;
+         var.blockId  = in.get<int32_t>();
+         var.varType  = in.get<int32_t>();
+         var.origCost = in.get<double>();
+         in.getVector(var.ind);
+         in.getVector(var.els);
+
+         if (var.ind.size() != var.els.size()) {
+            throw UtilException("Inconsistent column in checkpoint.",
+                                "read", "DecompCheckpoint");
+         }
+
+         cp.vars.push_back(var);
+      }
+
+      uint64_t nCuts = in.get<uint64_t>();
+
+      for (uint64_t i = 0; i < nCuts; i++) {
+         Cut cut;
+         cut.lb = in.get<double>();
+         cut.ub = in.get<double>();
+         in.getVector(cut.ind);
+         in.getVector(cut.els);
+
+         if (cut.ind.size() != cut.els.size()) {
+            throw UtilException("Inconsistent cut in checkpoint.",
+                                "read", "DecompCheckpoint");
+         }
+
+         cp.cuts.push_back(cut);
+      }
+
+      uint64_t nNodes = in.get<uint64_t>();
+
+      for (uint64_t i = 0; i < nNodes; i++) {
+         Node node;
+         node.quality     = in.get<double>();
+         node.branchedDir = in.get<int32_t>();
+         in.getVector(node.colLB);
+         in.getVector(node.colUB);
+
+         if (node.colLB.size() != node.colUB.size()) {
+            throw UtilException("Inconsistent node in checkpoint.",
+                                "read", "DecompCheckpoint");
+         }
+
+         uint64_t nRows = in.get<uint64_t>();
+
+         for (uint64_t k = 0; k < nRows; k++) {
+            DecompBranchRow row;
+            row.type    = in.get<int32_t>();
+            row.blockId = in.get<int32_t>();
+            row.name    = in.getString();
+            in.getVector(row.ind);
+            in.getVector(row.els);
+            row.lb      = in.get<double>();
+            row.ub      = in.get<double>();
+
+            if (row.ind.size() != row.els.size() ||
+                  (row.type != DecompBranchRow_Master &&
+                   row.type != DecompBranchRow_Column)) {
+               throw UtilException("Inconsistent branching row in "
+                                   "checkpoint.",
+                                   "read", "DecompCheckpoint");
+            }
+
+            node.branchRows.push_back(row);
+         }
+
+         cp.nodes.push_back(node);
+      }
+
+      if (!in.atEnd()) {
+         throw UtilException("Trailing data in checkpoint.",
+                             "read", "DecompCheckpoint");
+      }
+   } catch (CoinError& e) {
+      errMsg = e.message();
+      return false;
+   }
+
+   *this = cp;
+   return true;
+}
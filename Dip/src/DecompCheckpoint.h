@@ -0,0 +1,127 @@
+//===========================================================================//
+// This file is part of the DIP Solver Framework.                            //
+//                                                                           //
+// DIP is distributed under the Eclipse Public License as part of the        //
+// COIN-OR repository (http://www.coin-or.org).                              //
+//                                                                           //
+// Authors: Matthew Galati, SAS Institute Inc. (matthew.galati@sas.com)      //
+//          Ted Ralphs, Lehigh University (ted@lehigh.edu)                   //
+//          Jiadong Wang, Lehigh University (jiw408@lehigh.edu)              //
+//                                                                           //
+// Copyright (C) 2002-2019, Lehigh University, Matthew Galati, Ted Ralphs    //
+// All Rights Reserved.                                                      //
+//===========================================================================//
+
+//===========================================================================//
+#ifndef DecompCheckpoint_h_
+#define DecompCheckpoint_h_
+
+//===========================================================================//
+#include "Decomp.h"
+#include "DecompBranchRow.h"
+
+//===========================================================================//
+/**
+ * Search state of a branch-and-price-and-cut run, written periodically
+ * to CheckpointFile and read back with Restart=1.
+ *
+ * Everything is stored in terms of the original (core) columns so that
+ * it is independent of the master LP that was active when it was
+ * written:
+ *   - the columns (m_vars and the var pool) as points/rays in x-space,
+ *   - the cuts (active and pooled) as rows in x-space,
+ *   - the open nodes of the tree as column bounds and branching rows,
+ *   - the incumbent and a few run statistics.
+ *
+ * The file uses the header of UtilBinaryIO.h (magic "DIPCKPT").
+ */
+//===========================================================================//
+class DecompCheckpoint {
+
+public:
+   static const unsigned int Version = 2;
+
+   /** A column (point or ray of one block) in x-space. */
+   struct Var {
+      int                 blockId;
+      int                 varType;
+      double              origCost;
+      std::vector<int>    ind;
+      std::vector<double> els;
+   };
+
+   /** A cut in x-space, lb <= a.x <= ub. */
+   struct Cut {
+      double              lb;
+      double              ub;
+      std::vector<int>    ind;
+      std::vector<double> els;
+   };
+
+   /** An open node of the search tree. */
+   struct Node {
+      double                       quality;
+      int                          branchedDir;
+      std::vector<double>          colLB;
+      std::vector<double>          colUB;
+      /** Branching rows (block sums, Ryan-Foster pairs) of the node. */
+      std::vector<DecompBranchRow> branchRows;
+   };
+
+public:
+   /**
+    * Identifies the model the checkpoint belongs to (instance and size
+    * of the core); a checkpoint for another model is rejected.
+    */
+   std::string         stamp;
+
+   //---
+   //--- statistics of the run(s) that wrote this checkpoint
+   //---
+   double              timeElapsed;
+   int                 nodesProcessed;
+   double              bestLB;
+
+   //---
+   //--- incumbent (empty if none found yet)
+   //---
+   double              incumbentValue;
+   std::vector<double> incumbent;
+
+   std::vector<Var>    vars;
+   std::vector<Cut>    cuts;
+   std::vector<Node>   nodes;
+
+public:
+   /**
+    * Write the checkpoint. Throws UtilException if the file cannot be
+    * written.
+    */
+   void write(const std::string& fileName) const;
+
+   /**
+    * Read the checkpoint. Returns false, with a reason in errMsg, if the
+    * file is missing, corrupt or was written by another version.
+    */
+   bool read(const std::string& fileName,
+             std::string&       errMsg);
+
+   /** Drop the stored data (keeps stamp and statistics). */
+   void clear() {
+      incumbent.clear();
+      vars.clear();
+      cuts.clear();
+      nodes.clear();
+   }
+
+public:
+   DecompCheckpoint() :
+      stamp         (),
+      timeElapsed   (0.0),
+      nodesProcessed(0),
+      bestLB        (-COIN_DBL_MAX),
+      incumbentValue( COIN_DBL_MAX) {
+   }
+};
+
+#endif
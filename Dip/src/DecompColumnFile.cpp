@@ -0,0 +1,104 @@
+//===========================================================================//
+// This file is part of the DIP Solver Framework.                            //
+//                                                                           //
+// DIP is distributed under the Eclipse Public License as part of the        //
+// COIN-OR repository (http://www.coin-or.org).                              //
+//                                                                           //
+// Authors: Matthew Galati, SAS Institute Inc. (matthew.galati@sas.com)      //
+//          Ted Ralphs, Lehigh University (ted@lehigh.edu)                   //
+//          Jiadong Wang, Lehigh University (jiw408@lehigh.edu)              //
+//                                                                           //
+// Copyright (C) 2002-2019, Lehigh University, Matthew Galati, Ted Ralphs    //
+// All Rights Reserved.                                                      //
+//===========================================================================//
+
+//===========================================================================//
+#include "DecompColumnFile.h"
+#include "UtilBinaryIO.h"
+#include "UtilMacrosDecomp.h"
+
+using namespace std;
+
+static const char* ColumnFileMagic = "DIPCOLS";
+
+//===========================================================================//
+void DecompColumnFile::append(const int     block,
+                              const int     type,
+                              const int     len,
+                              const int*    index,
+                              const double* value)
+{
+   blockId.push_back(block);
+   varType.push_back(type);
+   ind.insert(ind.end(), index, index + len);
+   els.insert(els.end(), value, value + len);
+   start.push_back(static_cast<CoinBigIndex>(ind.size()));
+}
+
+//===========================================================================//
+void DecompColumnFile::write(const string& fileName) const
+{
+   UtilBinaryWriter out;
+   out.put<int32_t>(numCols);
+   out.putStrings(colNames);
+   out.putVector(blockId);
+   out.putVector(varType);
+   out.putVector(start);
+   out.putVector(ind);
+   out.putVector(els);
+
+   if (!UtilWriteBinaryFile(fileName, ColumnFileMagic, Version,
+                            out.getBuffer())) {
+      throw UtilException("Cannot write column file " + fileName + ".",
+                          "write", "DecompColumnFile");
+   }
+}
+
+//===========================================================================//
+bool DecompColumnFile::read(const string& fileName,
+                            string&       errMsg)
+{
+   vector<char> payload;
+
+   if (!UtilReadBinaryFile(fileName, ColumnFileMagic, Version,
+                           payload, errMsg)) {
+      return false;
+   }
+
+   UtilBinaryReader in(payload);
+   DecompColumnFile cf;
+
+   try {
+      cf.numCols = in.get<int32_t>();
+      in.getStrings(cf.colNames);
+      in.getVector(cf.blockId);
+      in.getVector(cf.varType);
+      in.getVector(cf.start);
+      in.getVector(cf.ind);
+      in.getVector(cf.els);
+
+      //---
+      //--- the starts must be monotone and end at the number of nonzeros
+      //---
+      bool ok = cf.blockId.size() == cf.varType.size()   &&
+                cf.start.size()   == cf.blockId.size() + 1 &&
+                cf.ind.size()     == cf.els.size()       &&
+                cf.start[0]       == 0                   &&
+                cf.start.back()   == static_cast<CoinBigIndex>(cf.ind.size());
+
+      for (size_t i = 1; ok && i < cf.start.size(); i++) {
+         ok = cf.start[i - 1] <= cf.start[i];
+      }
+
+      if (!ok || !in.atEnd()) {
+         throw UtilException("Inconsistent column file.",
+                             "read", "DecompColumnFile");
+      }
+   } catch (CoinError& e) {
+      errMsg = e.message();
+      return false;
+   }
+
+   *this = cf;
+   return true;
+}
@@ -0,0 +1,92 @@
+//===========================================================================//
+// This file is part of the DIP Solver Framework.                            //
+//                                                                           //
+// DIP is distributed under the Eclipse Public License as part of the        //
+// COIN-OR repository (http://www.coin-or.org).                              //
+//                                                                           //
+// Authors: Matthew Galati, SAS Institute Inc. (matthew.galati@sas.com)      //
+//          Ted Ralphs, Lehigh University (ted@lehigh.edu)                   //
+//          Jiadong Wang, Lehigh University (jiw408@lehigh.edu)              //
+//                                                                           //
+// Copyright (C) 2002-2019, Lehigh University, Matthew Galati, Ted Ralphs    //
+// All Rights Reserved.                                                      //
+//===========================================================================//
+
+//===========================================================================//
+#ifndef DecompColumnFile_h_
+#define DecompColumnFile_h_
+
+//===========================================================================//
+#include "Decomp.h"
+
+//===========================================================================//
+/**
+ * Binary file of master columns (points and rays in x-space), used to
+ * warm start a later solve of the same or a similar model.
+ *
+ * The columns are stored in compressed sparse form (one start array
+ * and one index/element array for all columns) so that they can be read
+ * with a few bulk reads. The names of the core columns are stored too;
+ * if the model being solved has different columns, the stored columns
+ * are mapped by name.
+ *
+ * The file uses the header of UtilBinaryIO.h (magic "DIPCOLS").
+ */
+//===========================================================================//
+class DecompColumnFile {
+
+public:
+   static const unsigned int Version = 1;
+
+public:
+   /** Names of the core columns when the file was written. */
+   std::vector<std::string>  colNames;
+   /** Number of core columns when the file was written. */
+   int                       numCols;
+
+   //---
+   //--- per column
+   //---
+   std::vector<int>          blockId;
+   std::vector<int>          varType;
+   std::vector<CoinBigIndex> start;   //size numVars+1
+   std::vector<int>          ind;
+   std::vector<double>       els;
+
+public:
+   inline int getNumVars() const {
+      return static_cast<int>(blockId.size());
+   }
+
+   /** Append a column. */
+   void append(const int           block,
+               const int           type,
+               const int           len,
+               const int*          index,
+               const double*       value);
+
+   /**
+    * Write the file. Throws UtilException if it cannot be written.
+    */
+   void write(const std::string& fileName) const;
+
+   /**
+    * Read the file. Returns false, with a reason in errMsg, if it is
+    * missing, corrupt or was written by another version.
+    */
+   bool read(const std::string& fileName,
+             std::string&       errMsg);
+
+public:
+   DecompColumnFile() :
+      colNames(),
+      numCols (0),
+      blockId (),
+      varType (),
+      start   (1, 0),
+      ind     (),
+      els     () {
+   }
+};
+
+#endif
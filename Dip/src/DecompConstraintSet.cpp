@@ -20,7 +20,8 @@
 using namespace std;
 
 //===========================================================================//
-void DecompConstraintSet::prepareModel(double infinity, bool modelIsCore)
+void DecompConstraintSet::prepareModel(double infinity, bool modelIsCore,
+                                       bool makeNames)
 {
    //---
    //--- For each model:
@@ -53,19 +54,19 @@ void DecompConstraintSet::prepareModel(double infinity, bool modelIsCore)
    }
 
    nBaseRows = getNumRows();
-   //TODO: make this an option
    //---
    //--- if row/col names are not given, make up default ones
+   //---   (not in low-memory mode, see getRowName/getColName)
    //---
    int i, j;
 
-   if (rowNames.size() == 0) {
+   if (makeNames && rowNames.size() == 0) {
       for (i = 0; i < numRows; i++) {
          rowNames.push_back("r(" + UtilIntToStr(i) + ")");
       }
    }
 
-   if (colNames.size() == 0) {
+   if (makeNames && colNames.size() == 0) {
       for (j = 0; j < numCols; j++) {
          colNames.push_back("x(" + UtilIntToStr(j) + ")");
       }
@@ -116,6 +117,8 @@ void DecompConstraintSet::prepareModel(double infinity, bool modelIsCore)
       fixNonActiveColumns();
    }
 
+   createSparseIndex();
+
    //---
    //--- create set from vector - easier to check overlap, etc
    //---
@@ -166,6 +169,38 @@ void DecompConstraintSet::createRowHash(double infinity)
    }
 }
 
+//===========================================================================//
+void DecompConstraintSet::getMemoryUsage(double& namesBytes,
+                                         double& hashBytes,
+                                         double& modelBytes) const
+{
+   namesBytes = UtilStringBytes(rowNames) + UtilStringBytes(colNames);
+   hashBytes  = UtilStringBytes(rowHash);
+   modelBytes = UtilVectorBytes(rowSense) + UtilVectorBytes(rowRhs)
+                + UtilVectorBytes(rowLB) + UtilVectorBytes(rowUB)
+                + UtilVectorBytes(colLB) + UtilVectorBytes(colUB)
+                + UtilVectorBytes(integerVars) + UtilVectorBytes(integerMark)
+                + UtilVectorBytes(activeColumns)
+                + UtilVectorBytes(masterOnlyCols)
+                + UtilVectorBytes(m_origToSparseIndex)
+                + UtilVectorBytes(m_sparseToOrigIndex);
+   //---
+   //--- the map nodes hold a pair and about 4 pointers
+   //---
+   modelBytes += static_cast<double>(activeColumnsS.size() *
+                                     (sizeof(int) + 4 * sizeof(void*)));
+   modelBytes += static_cast<double>((m_origToSparse.size() +
+                                      m_sparseToOrig.size()) *
+                                     (2 * sizeof(int) + 4 * sizeof(void*)));
+
+   if (M) {
+      modelBytes += static_cast<double>(M->getNumElements()) *
+                    (sizeof(int) + sizeof(double));
+      modelBytes += static_cast<double>(M->getMajorDim()) *
+                    (sizeof(CoinBigIndex) + sizeof(int));
+   }
+}
+
 //===========================================================================//
 void DecompConstraintSet::checkSenseAndBound(double infinity)
 {
@@ -253,6 +288,31 @@ void DecompConstraintSet::fixNonActiveColumns()
    UTIL_DELARR(marker);
 }
 
+//===========================================================================//
+void DecompConstraintSet::createSparseIndex()
+{
+   //---
+   //--- flat copies of the orig <-> sparse maps, for the inner loops
+   //---   that map every column (setting objectives, bounds, ...)
+   //---
+   m_origToSparseIndex.clear();
+   m_sparseToOrigIndex.clear();
+
+   if (!isSparse()) {
+      return;
+   }
+
+   map<int, int>::const_iterator mcit;
+   m_origToSparseIndex.assign(m_numColsOrig, -1);
+   m_sparseToOrigIndex.assign(getNumCols(), -1);
+
+   for (mcit  = m_origToSparse.begin();
+         mcit != m_origToSparse.end(); mcit++) {
+      m_origToSparseIndex[mcit->first]  = mcit->second;
+      m_sparseToOrigIndex[mcit->second] = mcit->first;
+   }
+}
+
 //===========================================================================//
 CoinPackedMatrix* DecompConstraintSet::sparseToOrigMatrix()
 {
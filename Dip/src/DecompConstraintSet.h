@@ -59,6 +59,9 @@ public:
    int           m_numColsOrig;
    std::map<int, int> m_origToSparse;
    std::map<int, int> m_sparseToOrig;
+   //the same maps as arrays (see createSparseIndex), -1 = not mapped
+   std::vector<int>   m_origToSparseIndex;
+   std::vector<int>   m_sparseToOrigIndex;
    double        m_infinity;
 
 public:
@@ -93,6 +96,18 @@ public:
    inline const std::vector<std::string>& getColNames() const {
       return colNames;
    }
+   /**
+    * The name of a row (column): the given name if there is one, a
+    * default name made on the fly if not (see LowMemory).
+    */
+   inline std::string getRowName(const int r) const {
+      return r < static_cast<int>(rowNames.size()) ?
+             rowNames[r] : "r(" + UtilIntToStr(r) + ")";
+   }
+   inline std::string getColName(const int j) const {
+      return j < static_cast<int>(colNames.size()) ?
+             colNames[j] : "x(" + UtilIntToStr(j) + ")";
+   }
    inline std::vector<std::string>& getRowNamesMutable() {
       return rowNames;
    }
@@ -126,19 +141,36 @@ public:
    inline const std::map<int, int>& getMapSparseToOrig() const {
       return m_sparseToOrig;
    };
+   /** Sparse index of each original column (empty if not sparse). */
+   inline const std::vector<int>& getOrigToSparseIndex() const {
+      return m_origToSparseIndex;
+   };
+   /** Original index of each sparse column (empty if not sparse). */
+   inline const std::vector<int>& getSparseToOrigIndex() const {
+      return m_sparseToOrigIndex;
+   };
    inline const std::vector<int>& getMasterOnlyCols() const {
       return masterOnlyCols;
    }
 
 
 public:
-   void prepareModel(double infinity, bool modelIsCore = false);
+   void prepareModel(double infinity, bool modelIsCore = false,
+                     bool makeNames = true);
    void createRowHash(double infinity);
    void checkSenseAndBound(double infinity);
    void sensesToBounds(double infinity);
    void boundsToSenses(double infinity);
    void fixNonActiveColumns();
+   void createSparseIndex();
    CoinPackedMatrix* sparseToOrigMatrix();
+   /**
+    * Approximate bytes used by the names, by the row hashes and by the
+    * rest of the model (matrix, bounds, index maps).
+    */
+   void getMemoryUsage(double& namesBytes,
+                       double& hashBytes,
+                       double& modelBytes) const;
 
    inline void appendRow(CoinPackedVector& row,
                          double             loBound,
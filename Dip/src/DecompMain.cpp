@@ -451,15 +451,20 @@ void DecompAuto(DecompApp milp,
          cout << "Unknown" << endl;
       }
 
-      decompMainParam.bestLB = alpsModel.getGlobalLB();
-      decompMainParam.bestUB = alpsModel.getGlobalUB();
+      //---
+      //--- bounds of the instance (presolve may have removed some of the
+      //---   objective)
+      //---
+      const double objShift = milp.getPresolveObjOffset();
+      decompMainParam.bestLB = alpsModel.getGlobalLB() + objShift;
+      decompMainParam.bestUB = alpsModel.getGlobalUB() + objShift;
       cout << "BestLB        = " << setw(10)
-           << UtilDblToStr(alpsModel.getGlobalLB(), 5) << endl
+           << UtilDblToStr(decompMainParam.bestLB, 5) << endl
            << "BestUB        = " << setw(10)
-           << UtilDblToStr(alpsModel.getGlobalUB(), 5) << endl
+           << UtilDblToStr(decompMainParam.bestUB, 5) << endl
            << "OptiGap       = " << setw(10)
-           << UtilDblToStr(UtilCalculateGap(alpsModel.getGlobalLB(),
-                                            alpsModel.getGlobalUB(),
+           << UtilDblToStr(UtilCalculateGap(decompMainParam.bestLB,
+                                            decompMainParam.bestUB,
 					    milp.getDecompAlgo()->getInfinity()), 5)
            << endl
            << "Nodes         = "
@@ -513,7 +518,19 @@ void DecompAuto(DecompApp milp,
       if (milp.m_param.SolutionOutputToFile
             && alpsModel.getGlobalUB() < 1.e100) {
          const DecompSolution* solution = alpsModel.getBestSolution();
-         const vector<string>& colNames = alpsModel.getColNames();
+         vector<string>         colNames = alpsModel.getColNames();
+
+         //---
+         //--- in low-memory mode the names are made only now
+         //---
+         if (colNames.empty()) {
+            const DecompConstraintSet* modelCore =
+               alpsModel.getDecompAlgo()->getModelCore().getModel();
+
+            for (int i = 0; i < solution->getSize(); i++) {
+               colNames.push_back(modelCore->getColName(i));
+            }
+         }
          string solutionFile;
 
          if (milp.m_param.SolutionOutputFileName == "") {
@@ -532,21 +549,35 @@ void DecompAuto(DecompApp milp,
             solutionFile = milp.m_param.SolutionOutputFileName;
          }
 
+         //---
+         //--- the file has the solution of the instance
+         //---
+         const double*  sol      = solution->getValues();
+         int            nSolCols = solution->getSize();
+         vector<double> solOrig;
+         vector<string> colNamesOrig;
+
+         if (milp.postsolveSolution(sol, solOrig, colNamesOrig)) {
+            sol      = &solOrig[0];
+            nSolCols = static_cast<int>(solOrig.size());
+         } else {
+            colNamesOrig = colNames;
+         }
+
          ofstream osSolution(solutionFile.c_str());
          osSolution.precision(16);
-         const double* sol = solution->getValues();
          osSolution << "=obj=" << setw(10);
          osSolution.precision(8);
-         osSolution << " " << alpsModel.getGlobalUB()
+         osSolution << " " << decompMainParam.bestUB
                     << std::endl;
 
-         for (int i = 0; i < solution->getSize(); i++) {
+         for (int i = 0; i < nSolCols; i++) {
             if (!UtilIsZero(sol[i])) {
-               osSolution << colNames[i] << setw(10);
+               osSolution << colNamesOrig[i] << setw(10);
                osSolution.precision(8);
                osSolution << " " << sol[i] << std::endl;
             } else {
-               osSolution << colNames[i] << setw(10);
+               osSolution << colNamesOrig[i] << setw(10);
                osSolution.precision(8);
                osSolution << " " << 0.0000000 << std::endl;
             }
@@ -17,13 +17,93 @@
 #define DecompMemPool_h_
 
 #include "CoinError.hpp"
+#include <vector>
+#include <algorithm>
 
 // --------------------------------------------------------------------- //
+/**
+ * The scratch buffers of DecompMemPool, one per use so that two buffers
+ * in use at the same time are never the same memory.
+ */
+enum DecompScratchDbl {
+   DecompScratch_RedCostX,     //(c - u A'') in x-space, generateVars
+   DecompScratch_DualAdj,      //duals without the convexity rows
+   DecompScratch_RedCostXBlock,//same, for the user duals of one block
+   DecompScratch_DualAdjBlock,
+   DecompScratch_DenseS,       //a column in x-space
+   DecompScratch_DenseCol,     //a column in master row space
+   DecompScratch_RowRhs,       //row bounds to set in the master
+   DecompScratch_RowRange,
+   DecompScratch_TabRhs,       //dual rays: tableau rhs, y_B, B^-1 rows
+   DecompScratch_Yb,
+   DecompScratch_BInvRow,
+   DecompScratch_BInvARow,
+   DecompScratch_CostEps,      //perturbed costs, generateInitVars
+   DecompScratch_NumDbl
+};
+enum DecompScratchInt {
+   DecompScratch_RowIndex,     //rows to set in the master
+   DecompScratch_Basics,       //dual rays: basic variables
+   DecompScratch_RowStat,      //basis status of the master
+   DecompScratch_ColStat,
+   DecompScratch_NumInt
+};
+enum DecompScratchChar {
+   DecompScratch_RowSense,     //row senses to set in the master
+   DecompScratch_NumChar
+};
+
+// --------------------------------------------------------------------- //
+/**
+ * Memory reused from one iteration to the next. Besides the two arrays
+ * sized to the core, it is an arena of scratch buffers: a buffer is
+ * asked for with its size and only grows (geometrically), so once the
+ * sizes stop changing an iteration makes no heap allocation for them.
+ * A buffer is valid until the next request of the same buffer.
+ *
+ * DecompAlgo owns one pool per thread (see DecompAlgo::getScratch), so
+ * the buffers are never shared by two threads. The counters give the
+ * number of requests and the number and volume of the allocations
+ * made to serve them.
+ */
 class DecompMemPool {
 public:
    double* dblArrNCoreCols;
    double* dblArrNCoreRows;
 
+private:
+   std::vector<double> m_dblBuf [DecompScratch_NumDbl];
+   std::vector<int>    m_intBuf [DecompScratch_NumInt];
+   std::vector<char>   m_charBuf[DecompScratch_NumChar];
+   long long           m_numRequests;
+   long long           m_numAllocs;
+   double              m_bytesAllocated;
+
+private:
+   DecompMemPool(const DecompMemPool&);
+   DecompMemPool& operator=(const DecompMemPool&);
+
+   template <class T>
+   T* getBuffer(std::vector<T>& buf,
+                const int       size) {
+      m_numRequests++;
+
+      if (static_cast<int>(buf.size()) < size) {
+         //---
+         //--- grow by half at least, the master rows/columns grow a few
+         //---   at a time
+         //---
+         const size_t newSize = std::max(static_cast<size_t>(size),
+                                         buf.size() + buf.size() / 2);
+         std::vector<T>().swap(buf);
+         buf.resize(newSize);
+         m_numAllocs++;
+         m_bytesAllocated += static_cast<double>(newSize * sizeof(T));
+      }
+
+      return buf.empty() ? 0 : &buf[0];
+   }
+
 public:
    void allocateMemory(const int nCoreCols,
                        const int nCoreRows) {
@@ -38,10 +118,55 @@ public:
       }
    }
 
+   /** A scratch buffer of (at least) size elements. */
+   inline double* getDblArr(const DecompScratchDbl which,
+                            const int              size) {
+      return getBuffer(m_dblBuf[which], size);
+   }
+   inline int* getIntArr(const DecompScratchInt which,
+                         const int              size) {
+      return getBuffer(m_intBuf[which], size);
+   }
+   inline char* getCharArr(const DecompScratchChar which,
+                           const int               size) {
+      return getBuffer(m_charBuf[which], size);
+   }
+
+   inline long long getNumRequests() const {
+      return m_numRequests;
+   }
+   inline long long getNumAllocs() const {
+      return m_numAllocs;
+   }
+   inline double getBytesAllocated() const {
+      return m_bytesAllocated;
+   }
+   /** Bytes held by the scratch buffers now. */
+   double getBytesHeld() const {
+      double bytes = 0.0;
+
+      for (int i = 0; i < DecompScratch_NumDbl; i++) {
+         bytes += static_cast<double>(m_dblBuf[i].capacity() * sizeof(double));
+      }
+
+      for (int i = 0; i < DecompScratch_NumInt; i++) {
+         bytes += static_cast<double>(m_intBuf[i].capacity() * sizeof(int));
+      }
+
+      for (int i = 0; i < DecompScratch_NumChar; i++) {
+         bytes += static_cast<double>(m_charBuf[i].capacity());
+      }
+
+      return bytes;
+   }
+
 public:
    DecompMemPool() :
       dblArrNCoreCols(0),
-      dblArrNCoreRows(0) {
+      dblArrNCoreRows(0),
+      m_numRequests  (0),
+      m_numAllocs    (0),
+      m_bytesAllocated(0.0) {
    }
    ~DecompMemPool() {
       UTIL_DELARR(dblArrNCoreCols);
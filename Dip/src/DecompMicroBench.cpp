@@ -0,0 +1,430 @@
+//===========================================================================//
+// This file is part of the DIP Solver Framework.                            //
+//                                                                           //
+// DIP is distributed under the Eclipse Public License as part of the        //
+// COIN-OR repository (http://www.coin-or.org).                              //
+//                                                                           //
+// Authors: Matthew Galati, SAS Institute Inc. (matthew.galati@sas.com)      //
+//          Ted Ralphs, Lehigh University (ted@lehigh.edu)                   //
+//          Jiadong Wang, Lehigh University (jiw408@lehigh.edu)              //
+//                                                                           //
+// Copyright (C) 2002-2019, Lehigh University, Matthew Galati, Ted Ralphs    //
+// All Rights Reserved.                                                      //
+//===========================================================================//
+
+//===========================================================================//
+// Micro-benchmarks of DIP's inner kernels (make microbench).
+//
+// A synthetic block-angular binary program is generated: NumBlocks blocks
+// of ColsPerBlock columns with RowsPerBlock knapsack rows each, linked by
+// LinkingRows knapsack rows. After the usual price-and-cut setup (which
+// is not timed), each kernel is called Repeat times on random data:
+//
+//   hash           UtilCreateStringHash of NumVars sparse columns
+//   calcRedCost    DecompAlgo::generateVarsCalcRedCost
+//   addVarsToPool  DecompAlgo::addVarsToPool of NumVars new columns
+//   setRedCosts    DecompVarPool::setReducedCosts over the pool
+//   isParallel     DecompVarPool::isParallel, pool against master columns
+//   masterBounds   DecompAlgo::setMasterBounds
+//   recompose      DecompAlgo::recomposeSolution
+//
+// The sizes are set in the [MICROBENCH] section, e.g.,
+//   decomp_microbench --MICROBENCH:NumBlocks 50 --MICROBENCH:Repeat 100
+//===========================================================================//
+
+//===========================================================================//
+#include "UtilParameters.h"
+#include "UtilHash.h"
+#include "UtilTimer.h"
+//===========================================================================//
+#include "DecompApp.h"
+#include "DecompAlgoPC.h"
+#include "DecompVarPool.h"
+//===========================================================================//
+#include <iomanip>
+
+using namespace std;
+
+//===========================================================================//
+/** Sizes of the synthetic model and of the runs. */
+struct MicroBenchParam {
+   int    NumBlocks;
+   int    ColsPerBlock;
+   int    RowsPerBlock;
+   int    LinkingRows;
+   double Density;
+   double LinkingDensity;
+   int    NumVars;
+   int    Repeat;
+   int    Seed;
+};
+
+//===========================================================================//
+/** Application building the synthetic block-angular model. */
+//===========================================================================//
+class MicroBench_DecompApp : public DecompApp {
+
+private:
+   MicroBenchParam m_mbParam;
+
+private:
+   /** Append a knapsack row over cols (random weights, half capacity). */
+   void appendKnapsackRow(DecompConstraintSet* model,
+                          const vector<int>&   cols) {
+      CoinPackedVector row;
+      double           sumWeights = 0.0;
+
+      for (size_t k = 0; k < cols.size(); k++) {
+         const double weight = UtilURand(1, 50);
+         row.insert(cols[k], weight);
+         sumWeights += weight;
+      }
+
+      model->appendRow(row, -m_infinity, 0.5 * sumWeights);
+   }
+
+   /** Columns of [first, last) picked with probability density. */
+   void randomSubset(const int     first,
+                     const int     last,
+                     const double  density,
+                     vector<int>&  cols) {
+      cols.clear();
+
+      for (int j = first; j < last; j++) {
+         if (UtilURand(0.0, 1.0) < density) {
+            cols.push_back(j);
+         }
+      }
+
+      if (cols.empty()) {
+         cols.push_back(first + rand() % (last - first));
+      }
+   }
+
+   DecompConstraintSet* newModel(const int nCols) {
+      DecompConstraintSet* model = new DecompConstraintSet();
+      model->M = new CoinPackedMatrix(false, 0.0, 0.0);
+      model->M->setDimensions(0, nCols);
+      model->colLB.assign(nCols, 0.0);
+      model->colUB.assign(nCols, 1.0);
+
+      for (int j = 0; j < nCols; j++) {
+         model->integerVars.push_back(j);
+      }
+
+      return model;
+   }
+
+public:
+   inline const MicroBenchParam& getMicroBenchParam() const {
+      return m_mbParam;
+   }
+
+   void initializeApp() {
+      const MicroBenchParam& p = m_mbParam;
+      const int   nCols = p.NumBlocks * p.ColsPerBlock;
+      vector<int> cols;
+      int         b, r, j;
+      srand(p.Seed);
+      //---
+      //--- maximize a random profit
+      //---
+      vector<double> objective(nCols);
+
+      for (j = 0; j < nCols; j++) {
+         objective[j] = -UtilURand(1.0, 100.0);
+      }
+
+      setModelObjective(&objective[0], nCols);
+      //---
+      //--- linking rows over all the blocks
+      //---
+      DecompConstraintSet* modelCore = newModel(nCols);
+
+      for (r = 0; r < p.LinkingRows; r++) {
+         randomSubset(0, nCols, p.LinkingDensity, cols);
+         appendKnapsackRow(modelCore, cols);
+      }
+
+      m_modelC  = modelCore;
+      NumBlocks = p.NumBlocks;
+      setModelCore(modelCore, "core");
+
+      //---
+      //--- the rows of each block only touch its own columns
+      //---
+      for (b = 0; b < p.NumBlocks; b++) {
+         const int            first      = b * p.ColsPerBlock;
+         DecompConstraintSet* modelRelax = newModel(nCols);
+
+         for (j = first; j < first + p.ColsPerBlock; j++) {
+            modelRelax->activeColumns.push_back(j);
+         }
+
+         for (r = 0; r < p.RowsPerBlock; r++) {
+            randomSubset(first, first + p.ColsPerBlock, p.Density, cols);
+            appendKnapsackRow(modelRelax, cols);
+         }
+
+         m_modelR.insert(make_pair(b, modelRelax));
+         setModelRelax(modelRelax, "relax" + UtilIntToStr(b), b);
+      }
+   }
+
+public:
+   MicroBench_DecompApp(UtilParameters& utilParam) :
+      DecompApp(utilParam) {
+      const char* sec = "MICROBENCH";
+      m_mbParam.NumBlocks      = utilParam.GetSetting("NumBlocks",      10,   sec);
+      m_mbParam.ColsPerBlock   = utilParam.GetSetting("ColsPerBlock",   50,   sec);
+      m_mbParam.RowsPerBlock   = utilParam.GetSetting("RowsPerBlock",   2,    sec);
+      m_mbParam.LinkingRows    = utilParam.GetSetting("LinkingRows",    20,   sec);
+      m_mbParam.Density        = utilParam.GetSetting("Density",        0.5,  sec);
+      m_mbParam.LinkingDensity = utilParam.GetSetting("LinkingDensity", 0.1,  sec);
+      m_mbParam.NumVars        = utilParam.GetSetting("NumVars",        1000, sec);
+      m_mbParam.Repeat         = utilParam.GetSetting("Repeat",         20,   sec);
+      m_mbParam.Seed           = utilParam.GetSetting("Seed",           1,    sec);
+      m_mbParam.NumBlocks      = max(m_mbParam.NumBlocks,    1);
+      m_mbParam.ColsPerBlock   = max(m_mbParam.ColsPerBlock, 1);
+   }
+};
+
+//===========================================================================//
+/** Price-and-cut algorithm with access to the kernels under test. */
+//===========================================================================//
+class MicroBench_DecompAlgo : public DecompAlgoPC {
+
+private:
+   const MicroBenchParam& m_mbParam;
+
+private:
+   void report(const string& kernel,
+               const int     nCalls,
+               const double  seconds) {
+      cout << setw(16) << left  << kernel
+           << setw(10) << right << nCalls
+           << setw(14) << UtilDblToStr(seconds, 6)
+           << setw(14) << UtilDblToStr(1.0e6 * seconds / max(nCalls, 1), 3)
+           << endl;
+   }
+
+   /** Random columns (half of the columns of a random block). */
+   void randomVars(const int      numVars,
+                   DecompVarList& vars) {
+      const MicroBenchParam& p   = m_mbParam;
+      const double*          obj = getOrigObjective();
+      vector<int>            ind;
+      vector<double>         els;
+
+      for (int v = 0; v < numVars; v++) {
+         const int b     = rand() % p.NumBlocks;
+         const int first = b * p.ColsPerBlock;
+         double    cost  = 0.0;
+         ind.clear();
+
+         for (int j = first; j < first + p.ColsPerBlock; j++) {
+            if (rand() & 1) {
+               ind.push_back(j);
+               cost += obj[j];
+            }
+         }
+
+         els.assign(ind.size(), 1.0);
+         DecompVar* var = new DecompVar(ind, els, -1.0, cost);
+         var->setBlockId(b);
+         vars.push_back(var);
+      }
+   }
+
+   void clearVarPool() {
+      for (DecompVarPool::iterator vi = m_varpool.begin();
+            vi != m_varpool.end(); vi++) {
+         (*vi).deleteVar();
+         (*vi).deleteCol();
+      }
+
+      m_varpool.clear();
+   }
+
+public:
+   void run() {
+      const MicroBenchParam& p         = m_mbParam;
+      DecompConstraintSet*   modelCore = m_modelCore.getModel();
+      const int              nCoreCols = modelCore->getNumCols();
+      const int              nCoreRows = modelCore->getNumRows();
+      const int              nRows     = m_masterSI->getNumRows();
+      const int              nCols     = m_masterSI->getNumCols();
+      UtilTimer              timer;
+      double                 t;
+      int                    i, k;
+      cout << "Model: " << nCoreCols << " cols, " << nCoreRows
+           << " linking rows, " << p.NumBlocks << " blocks; master: "
+           << nRows << " rows, " << nCols << " cols" << endl;
+      cout << setw(16) << left  << "kernel"
+           << setw(10) << right << "calls"
+           << setw(14) << "total (s)"
+           << setw(14) << "per call (us)" << endl;
+      //---
+      //--- hash of sparse columns
+      //---
+      {
+         DecompVarList vars;
+         randomVars(p.NumVars, vars);
+         t = 0.0;
+
+         for (k = 0; k < p.Repeat; k++) {
+            timer.reset();
+
+            for (DecompVarList::iterator li = vars.begin();
+                  li != vars.end(); li++) {
+               const CoinPackedVector& s = (*li)->m_s;
+               UtilCreateStringHash(s.getNumElements(),
+                                    s.getIndices(),
+                                    s.getElements());
+            }
+
+            t += timer.getRealTime();
+         }
+
+         report("hash", p.Repeat * p.NumVars, t);
+         UtilDeleteListPtr(vars);
+      }
+
+      //---
+      //--- reduced costs in x-space
+      //---
+      {
+         vector<double> u(nCoreRows), redCostX(nCoreCols);
+         t = 0.0;
+
+         for (k = 0; k < p.Repeat; k++) {
+            for (i = 0; i < nCoreRows; i++) {
+               u[i] = UtilURand(-1.0, 1.0);
+            }
+
+            timer.reset();
+            generateVarsCalcRedCost(nCoreRows ? &u[0] : NULL, &redCostX[0]);
+            t += timer.getRealTime();
+         }
+
+         report("calcRedCost", p.Repeat, t);
+      }
+
+      //---
+      //--- expand new columns into the pool, then price and compare them
+      //---
+      double tAdd = 0.0, tRedCost = 0.0, tParallel = 0.0;
+      vector<double> u(nRows);
+
+      for (k = 0; k < p.Repeat; k++) {
+         DecompVarList newVars;
+         randomVars(p.NumVars, newVars);
+         clearVarPool();
+         timer.reset();
+         addVarsToPool(newVars);
+         tAdd += timer.getRealTime();
+
+         for (i = 0; i < nRows; i++) {
+            u[i] = UtilURand(-1.0, 1.0);
+         }
+
+         timer.reset();
+         m_varpool.setReducedCosts(&u[0], STAT_FEASIBLE);
+         tRedCost += timer.getRealTime();
+         timer.reset();
+
+         for (DecompVarPool::iterator vi = m_varpool.begin();
+               vi != m_varpool.end(); vi++) {
+            m_varpool.isParallel(m_vars, *vi, m_param.ParallelColsLimit);
+         }
+
+         tParallel += timer.getRealTime();
+      }
+
+      clearVarPool();
+      report("addVarsToPool", p.Repeat, tAdd);
+      report("setRedCosts",   p.Repeat, tRedCost);
+      report("isParallel",    p.Repeat, tParallel);
+      //---
+      //--- branching bounds in the master
+      //---
+      {
+         vector<double> lbs(modelCore->colLB), ubs(modelCore->colUB);
+         t = 0.0;
+
+         for (k = 0; k < p.Repeat; k++) {
+            for (i = 0; i < nCoreCols; i++) {
+               lbs[i] = modelCore->colLB[i];
+               ubs[i] = modelCore->colUB[i];
+
+               if (rand() % 10 == 0) {
+                  if (rand() & 1) {
+                     lbs[i] = 1.0;
+                  } else {
+                     ubs[i] = 0.0;
+                  }
+               }
+            }
+
+            timer.reset();
+            setMasterBounds(&lbs[0], &ubs[0]);
+            t += timer.getRealTime();
+         }
+
+         setMasterBounds(&modelCore->colLB[0], &modelCore->colUB[0]);
+         report("masterBounds", p.Repeat, t);
+      }
+
+      //---
+      //--- recompose x from a convex combination of the master columns
+      //---
+      {
+         const int      nMasterCols = m_masterSI->getNumCols();
+         vector<double> lambda(nMasterCols, 0.0), x(nCoreCols);
+         t = 0.0;
+
+         for (k = 0; k < p.Repeat; k++) {
+            for (DecompVarList::iterator li = m_vars.begin();
+                  li != m_vars.end(); li++) {
+               lambda[(*li)->getColMasterIndex()] = UtilURand(0.0, 1.0);
+            }
+
+            timer.reset();
+            recomposeSolution(&lambda[0], &x[0]);
+            t += timer.getRealTime();
+         }
+
+         report("recompose", p.Repeat, t);
+      }
+   }
+
+public:
+   MicroBench_DecompAlgo(MicroBench_DecompApp* app,
+                         UtilParameters&       utilParam) :
+      DecompAlgoPC(app, utilParam),
+      m_mbParam(app->getMicroBenchParam()) {
+   }
+};
+
+//===========================================================================//
+int main(int argc, char** argv)
+{
+   try {
+      UtilParameters utilParam(argc, argv);
+      UtilTimer      timer;
+      timer.start();
+      MicroBench_DecompApp app(utilParam);
+      app.initializeApp();
+      MicroBench_DecompAlgo algo(&app, utilParam);
+      cout << "Setup real=" << UtilDblToStr(timer.getRealTime(), 3)
+           << " (not timed below)" << endl;
+      algo.run();
+   } catch (CoinError& ex) {
+      cerr << "COIN Exception [ " << ex.message() << " ]"
+           << " at " << ex.fileName()  << ":L" << ex.lineNumber()
+           << " in " << ex.className() << "::" << ex.methodName() << endl;
+      return 1;
+   }
+
+   return 0;
+}
@@ -0,0 +1,265 @@
+//===========================================================================//
+// This file is part of the DIP Solver Framework.                            //
+//                                                                           //
+// DIP is distributed under the Eclipse Public License as part of the        //
+// COIN-OR repository (http://www.coin-or.org).                              //
+//                                                                           //
+// Authors: Matthew Galati, SAS Institute Inc. (matthew.galati@sas.com)      //
+//          Ted Ralphs, Lehigh University (ted@lehigh.edu)                   //
+//          Jiadong Wang, Lehigh University (jiw408@lehigh.edu)              //
+//                                                                           //
+// Copyright (C) 2002-2019, Lehigh University, Matthew Galati, Ted Ralphs    //
+// All Rights Reserved.                                                      //
+//===========================================================================//
+
+//===========================================================================//
+#include "DecompMinCostFlow.h"
+
+#include <queue>
+
+using namespace std;
+
+static const double FlowTol            = 1.0e-9;
+static const int    AugmentationFactor = 100;
+
+//===========================================================================//
+int DecompMinCostFlow::addArc(const int tail,
+                              const int head)
+{
+   assert(tail >= 0 && tail < m_numNodes);
+   assert(head >= 0 && head < m_numNodes);
+   m_tail.push_back(tail);
+   m_head.push_back(head);
+   m_outStart.clear();
+   return static_cast<int>(m_tail.size()) - 1;
+}
+
+//===========================================================================//
+void DecompMinCostFlow::buildAdjacency()
+{
+   const int nArcs = getNumArcs();
+   int       a, v;
+   m_outStart.assign(m_numNodes + 1, 0);
+
+   for (a = 0; a < nArcs; a++) {
+      m_outStart[m_tail[a] + 1]++;
+      m_outStart[m_head[a] + 1]++;
+   }
+
+   for (v = 0; v < m_numNodes; v++) {
+      m_outStart[v + 1] += m_outStart[v];
+   }
+
+   vector<int> next(m_outStart.begin(), m_outStart.end() - 1);
+   m_outEdge.resize(2 * nArcs);
+
+   for (a = 0; a < nArcs; a++) {
+      m_outEdge[next[m_tail[a]]++] = 2 * a;
+      m_outEdge[next[m_head[a]]++] = 2 * a + 1;
+   }
+}
+
+//===========================================================================//
+bool DecompMinCostFlow::solve(const double*   cost,
+                              const double*   arcLB,
+                              const double*   arcUB,
+                              const double    infinity,
+                              vector<double>& flow)
+{
+   const int    nArcs  = getNumArcs();
+   const int    nEdges = 2 * nArcs;
+   const double inf    = COIN_DBL_MAX;
+   int          a, e, v;
+
+   if (static_cast<int>(m_outStart.size()) != m_numNodes + 1) {
+      buildAdjacency();
+   }
+
+   //---
+   //--- shift the flow by the lower bounds and saturate the finite
+   //---   arcs with negative cost, so that only arcs of infinite
+   //---   capacity can have a negative residual cost
+   //---
+   vector<double> resCap(nEdges), edgeCost(nEdges);
+   vector<double> excess(m_supply);
+   flow.assign(nArcs, 0.0);
+
+   for (a = 0; a < nArcs; a++) {
+      const double cap = arcUB[a] >= infinity ? inf : arcUB[a] - arcLB[a];
+
+      if (cap < -FlowTol) {
+         return false;
+      }
+
+      flow[a]              = arcLB[a];
+      excess[m_tail[a]]   -= arcLB[a];
+      excess[m_head[a]]   += arcLB[a];
+      edgeCost[2 * a]      = cost[a];
+      edgeCost[2 * a + 1]  = -cost[a];
+      resCap[2 * a]        = max(cap, 0.0);
+      resCap[2 * a + 1]    = 0.0;
+
+      if (cost[a] < 0.0 && cap < inf) {
+         flow[a]           += resCap[2 * a];
+         excess[m_tail[a]] -= resCap[2 * a];
+         excess[m_head[a]] += resCap[2 * a];
+         resCap[2 * a + 1]  = resCap[2 * a];
+         resCap[2 * a]      = 0.0;
+      }
+   }
+
+   //---
+   //--- feasible potentials on the residual graph, label-correcting
+   //---   from the potentials of the last solve; a node queued more
+   //---   than n times means a negative cycle (of infinite capacity)
+   //---
+   vector<double>& pi = m_potential;
+   vector<int>     nQueued(m_numNodes, 0);
+   vector<char>    inQueue(m_numNodes, 1);
+   deque<int>      labelQ;
+
+   for (v = 0; v < m_numNodes; v++) {
+      labelQ.push_back(v);
+   }
+
+   while (!labelQ.empty()) {
+      v = labelQ.front();
+      labelQ.pop_front();
+      inQueue[v] = 0;
+
+      for (int i = m_outStart[v]; i < m_outStart[v + 1]; i++) {
+         e = m_outEdge[i];
+
+         if (resCap[e] <= FlowTol) {
+            continue;
+         }
+
+         const int w = (e & 1) ? m_tail[e >> 1] : m_head[e >> 1];
+
+         if (pi[v] + edgeCost[e] < pi[w] - FlowTol) {
+            pi[w] = pi[v] + edgeCost[e];
+
+            if (!inQueue[w]) {
+               if (++nQueued[w] > m_numNodes) {
+                  pi.assign(m_numNodes, 0.0);
+                  return false;
+               }
+
+               inQueue[w] = 1;
+               labelQ.push_back(w);
+            }
+         }
+      }
+   }
+
+   //---
+   //--- successive shortest paths from the excess to the deficit nodes
+   //---
+   typedef pair<double, int> DistNode;
+   const int      maxAugment = AugmentationFactor * (m_numNodes + nArcs);
+   vector<double> dist(m_numNodes);
+   vector<int>    pred(m_numNodes);
+   vector<char>   done(m_numNodes);
+   int            nAugment = 0;
+
+   while (true) {
+      priority_queue<DistNode, vector<DistNode>, greater<DistNode> > heap;
+      dist.assign(m_numNodes, inf);
+      pred.assign(m_numNodes, -1);
+      done.assign(m_numNodes, 0);
+
+      for (v = 0; v < m_numNodes; v++) {
+         if (excess[v] > FlowTol) {
+            dist[v] = 0.0;
+            heap.push(DistNode(0.0, v));
+         }
+      }
+
+      if (heap.empty()) {
+         break;
+      }
+
+      int t = -1;
+
+      while (!heap.empty()) {
+         DistNode top = heap.top();
+         heap.pop();
+         v = top.second;
+
+         if (done[v] || top.first > dist[v]) {
+            continue;
+         }
+
+         done[v] = 1;
+
+         if (excess[v] < -FlowTol) {
+            t = v;
+            break;
+         }
+
+         for (int i = m_outStart[v]; i < m_outStart[v + 1]; i++) {
+            e = m_outEdge[i];
+
+            if (resCap[e] <= FlowTol) {
+               continue;
+            }
+
+            const int    w  = (e & 1) ? m_tail[e >> 1] : m_head[e >> 1];
+            const double rc = max(edgeCost[e] + pi[v] - pi[w], 0.0);
+
+            if (!done[w] && dist[v] + rc < dist[w]) {
+               dist[w] = dist[v] + rc;
+               pred[w] = e;
+               heap.push(DistNode(dist[w], w));
+            }
+         }
+      }
+
+      if (t < 0 || ++nAugment > maxAugment) {
+         //---
+         //--- some excess cannot reach a deficit: infeasible
+         //---
+         return false;
+      }
+
+      for (v = 0; v < m_numNodes; v++) {
+         pi[v] += done[v] ? dist[v] : dist[t];
+      }
+
+      //---
+      //--- augment along the path by the bottleneck
+      //---
+      double delta = -excess[t];
+      int    s     = t;
+
+      while (pred[s] >= 0) {
+         e     = pred[s];
+         delta = min(delta, resCap[e]);
+         s     = (e & 1) ? m_head[e >> 1] : m_tail[e >> 1];
+      }
+
+      delta = min(delta, excess[s]);
+
+      for (v = t; pred[v] >= 0;) {
+         e = pred[v];
+         resCap[e]     -= delta;
+         resCap[e ^ 1] += delta;
+         flow[e >> 1]  += (e & 1) ? -delta : delta;
+         v = (e & 1) ? m_head[e >> 1] : m_tail[e >> 1];
+      }
+
+      excess[s] -= delta;
+      excess[t] += delta;
+   }
+
+   //---
+   //--- no excess left; a deficit left means the supplies do not balance
+   //---
+   for (v = 0; v < m_numNodes; v++) {
+      if (excess[v] < -FlowTol) {
+         return false;
+      }
+   }
+
+   return true;
+}
@@ -0,0 +1,102 @@
+//===========================================================================//
+// This file is part of the DIP Solver Framework.                            //
+//                                                                           //
+// DIP is distributed under the Eclipse Public License as part of the        //
+// COIN-OR repository (http://www.coin-or.org).                              //
+//                                                                           //
+// Authors: Matthew Galati, SAS Institute Inc. (matthew.galati@sas.com)      //
+//          Ted Ralphs, Lehigh University (ted@lehigh.edu)                   //
+//          Jiadong Wang, Lehigh University (jiw408@lehigh.edu)              //
+//                                                                           //
+// Copyright (C) 2002-2019, Lehigh University, Matthew Galati, Ted Ralphs    //
+// All Rights Reserved.                                                      //
+//===========================================================================//
+
+//===========================================================================//
+#ifndef DecompMinCostFlow_h_
+#define DecompMinCostFlow_h_
+
+//===========================================================================//
+#include "Decomp.h"
+
+//===========================================================================//
+/**
+ * Min-cost flow on a fixed directed graph:
+ *   min  c.x
+ *   s.t. sum{a out of v} x[a] - sum{a into v} x[a] = b[v], for all v
+ *        l[a] <= x[a] <= u[a]
+ *
+ * The graph and the supplies b are given once; the costs and the arc
+ * bounds are given on each call to solve(), which uses successive
+ * shortest paths (Dijkstra on reduced costs). The node potentials of the
+ * last solve are kept and used as the starting labels of the next one,
+ * so when the costs change little (as reduced costs do between pricing
+ * rounds) few label corrections are needed. A single source-sink pair
+ * with no binding capacity is solved by one shortest path.
+ */
+//===========================================================================//
+class DecompMinCostFlow {
+
+private:
+   int                 m_numNodes;
+   std::vector<int>    m_tail;
+   std::vector<int>    m_head;
+   std::vector<double> m_supply;
+
+   //---
+   //--- residual graph: edge 2a is arc a forward, 2a+1 backward;
+   //---   outgoing edges of node v are m_outEdge[m_outStart[v]..]
+   //---
+   std::vector<int>    m_outStart;
+   std::vector<int>    m_outEdge;
+
+   /** Node potentials of the last solve (warm start). */
+   std::vector<double> m_potential;
+
+private:
+   void buildAdjacency();
+
+public:
+   /** Add an arc, returns its index. */
+   int addArc(const int tail,
+              const int head);
+
+   inline void setSupply(const int    node,
+                         const double supply) {
+      m_supply[node] = supply;
+   }
+
+   inline int getNumNodes() const {
+      return m_numNodes;
+   }
+   inline int getNumArcs() const {
+      return static_cast<int>(m_tail.size());
+   }
+
+   /**
+    * Solve for the given arc costs and bounds (an upper bound of
+    * infinity or more is taken as uncapacitated). Returns false if the
+    * flow is infeasible, unbounded (a negative cycle of infinite
+    * capacity) or the augmentation limit is hit.
+    */
+   bool solve(const double*        cost,
+              const double*        arcLB,
+              const double*        arcUB,
+              const double         infinity,
+              std::vector<double>& flow);
+
+public:
+   DecompMinCostFlow(const int numNodes) :
+      m_numNodes (numNodes),
+      m_tail     (),
+      m_head     (),
+      m_supply   (numNodes, 0.0),
+      m_outStart (),
+      m_outEdge  (),
+      m_potential(numNodes, 0.0) {
+   }
+
+   ~DecompMinCostFlow() {}
+};
+
+#endif
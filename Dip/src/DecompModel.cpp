@@ -217,6 +217,171 @@ FUNC_EXIT:
    return isFeas;
 }
 
+//===========================================================================//
+void DecompSubModel::setOsi(OsiSolverInterface* osi)
+{
+   m_osi     = osi;
+   m_numCols = m_osi->getNumCols();
+   DecompConstraintSet* model = getModel();
+
+   if (model && model->isSparse() &&
+         static_cast<int>(model->getSparseToOrigIndex().size()) != m_numCols) {
+      model->createSparseIndex();
+   }
+
+   //---
+   //--- start from what the solver has now
+   //---
+   const double* obj   = m_osi->getObjCoefficients();
+   const double* colLB = m_osi->getColLower();
+   const double* colUB = m_osi->getColUpper();
+   m_objApplied.assign(obj, obj + m_numCols);
+   m_colLBApplied.assign(colLB, colLB + m_numCols);
+   m_colUBApplied.assign(colUB, colUB + m_numCols);
+   m_changedInd.reserve(m_numCols);
+   m_changedVal.reserve(2 * m_numCols);
+}
+
+//===========================================================================//
+void DecompSubModel::setOsiObjCoeff(const double* objCoeff)
+{
+   assert(m_osi);
+   assert(m_numCols == m_osi->getNumCols());
+   const vector<int>& sparseToOrig = getModel()->getSparseToOrigIndex();
+   const bool         isSparse     = !sparseToOrig.empty();
+   int                j, k;
+   m_changedInd.clear();
+   m_changedVal.clear();
+
+   for (k = 0; k < m_numCols; k++) {
+      j = isSparse ? sparseToOrig[k] : k;
+
+      if (j < 0 || objCoeff[j] == m_objApplied[k]) {
+         continue;
+      }
+
+      m_objApplied[k] = objCoeff[j];
+      m_changedInd.push_back(k);
+      m_changedVal.push_back(objCoeff[j]);
+   }
+
+   if (!m_changedInd.empty()) {
+      m_osi->setObjCoeffSet(&m_changedInd[0],
+                            &m_changedInd[0] + m_changedInd.size(),
+                            &m_changedVal[0]);
+   }
+}
+
+//===========================================================================//
+void DecompSubModel::setActiveColBounds(const double* colLB,
+                                        const double* colUB)
+{
+   assert(m_osi);
+   assert(m_numCols == m_osi->getNumCols());
+   DecompConstraintSet*    model         = getModel();
+   const vector<int>&      activeColumns = model->activeColumns;
+   const vector<int>&      sparseToOrig  = model->getSparseToOrigIndex();
+   vector<int>::const_iterator vi;
+   int j, k;
+   m_changedInd.clear();
+   m_changedVal.clear();
+
+   //---
+   //--- if no active columns are set,  assume they are all active
+   //---   for e.g., in the case of one block (or sparse)
+   //---
+   if (!sparseToOrig.empty()) {
+      for (k = 0; k < m_numCols; k++) {
+         j = sparseToOrig[k];
+
+         if (j >= 0) {
+            queueColBounds(k, colLB[j], colUB[j]);
+         }
+      }
+   } else if (activeColumns.size()) {
+      for (vi = activeColumns.begin(); vi != activeColumns.end(); vi++) {
+         queueColBounds(*vi, colLB[*vi], colUB[*vi]);
+      }
+   } else {
+      for (k = 0; k < m_numCols; k++) {
+         queueColBounds(k, colLB[k], colUB[k]);
+      }
+   }
+
+   if (!m_changedInd.empty()) {
+      m_osi->setColSetBounds(&m_changedInd[0],
+                             &m_changedInd[0] + m_changedInd.size(),
+                             &m_changedVal[0]);
+   }
+}
+
+//===========================================================================//
+int DecompSubModel::setBranchRows(const vector<DecompBranchRow>& rows)
+{
+   assert(m_osi);
+   const int nRows = m_osi->getNumRows();
+
+   if (m_numBaseRows < 0) {
+      m_numBaseRows = nRows;
+   }
+
+   //---
+   //--- remove the rows of the previous node
+   //---
+   if (nRows > m_numBaseRows) {
+      vector<int> del;
+
+      for (int r = m_numBaseRows; r < nRows; r++) {
+         del.push_back(r);
+      }
+
+      m_osi->deleteRows(static_cast<int>(del.size()), &del[0]);
+   }
+
+   //---
+   //--- add the rows of this block in terms of the subproblem columns
+   //---
+   DecompConstraintSet*      model        = getModel();
+   const vector<int>&        origToSparse = model->getOrigToSparseIndex();
+   const set<int>&           activeCols   = model->activeColumnsS;
+   const double              osiInf       = m_osi->getInfinity();
+   int nAdded = 0;
+
+   for (size_t i = 0; i < rows.size(); i++) {
+      const DecompBranchRow& row = rows[i];
+
+      if (row.type != DecompBranchRow_Column ||
+            (row.blockId >= 0 && row.blockId != getBlockId())) {
+         continue;
+      }
+
+      CoinPackedVector v;
+
+      for (size_t k = 0; k < row.ind.size(); k++) {
+         const int j = row.ind[k];
+
+         if (!origToSparse.empty()) {
+            if (origToSparse[j] >= 0) {
+               v.insert(origToSparse[j], row.els[k]);
+            }
+         } else if (activeCols.empty() || activeCols.count(j)) {
+            v.insert(j, row.els[k]);
+         }
+      }
+
+      if (v.getNumElements() == 0) {
+         continue;
+      }
+
+      m_osi->addRow(v,
+                    row.lb <= -osiInf ? -osiInf : row.lb,
+                    row.ub >=  osiInf ?  osiInf : row.ub);
+      nAdded++;
+   }
+
+   return nAdded;
+}
+
 //===========================================================================//
 void DecompSubModel::solveAsMIP(DecompSolverResult*  result,
 				DecompParam&         param,
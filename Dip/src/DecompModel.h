@@ -20,6 +20,7 @@
 #include "DecompParam.h"
 #include "DecompConstraintSet.h"
 #include "DecompSolverResult.h"
+#include "DecompBranchRow.h"
 
 //===========================================================================//
 //naming convention - usually would do DecompModelXx, DecompModelYy
@@ -92,8 +93,32 @@ class DecompSubModel : public DecompModel {
 private:
    OsiSolverInterface*   m_osi;
    int                   m_numCols;
-   int*                  m_colIndices;
    int                   m_counter;
+   /** Rows of the subproblem before any branching rows were added. */
+   int                   m_numBaseRows;
+   //---
+   //--- the objective and column bounds last set in m_osi (in the
+   //---   subproblem's column space), so that only the entries that
+   //---   changed are sent to the solver, in one call
+   //---
+   std::vector<double>   m_objApplied;
+   std::vector<double>   m_colLBApplied;
+   std::vector<double>   m_colUBApplied;
+   std::vector<int>      m_changedInd;
+   std::vector<double>   m_changedVal;
+
+   /** Queue new bounds for column k (subproblem index) if they changed. */
+   inline void queueColBounds(const int    k,
+                              const double lb,
+                              const double ub) {
+      if (lb != m_colLBApplied[k] || ub != m_colUBApplied[k]) {
+         m_colLBApplied[k] = lb;
+         m_colUBApplied[k] = ub;
+         m_changedInd.push_back(k);
+         m_changedVal.push_back(lb);
+         m_changedVal.push_back(ub);
+      }
+   }
 public:
 
    inline void setCounter(const int num) {
@@ -104,87 +129,28 @@ public:
       return m_counter;
    }
 
-   void setOsi(OsiSolverInterface* osi) {
-      m_osi = osi;
-
-      if (!m_colIndices) {
-         //---
-         //--- For use with (re-)setting the objective coefficients
-         //---  setup an array of indices 0,...,n-1. This object assumes
-         //---  that the number of columns stayed constant throughout.
-         //---
-         const int numCols = m_osi->getNumCols();
-         m_numCols         = numCols;
-         m_colIndices      = new int[numCols];
-
-         if (!m_colIndices) {
-            UtilExceptionMemory("setOsi", "DecompSubModel");
-         }
-
-         UtilIotaN(m_colIndices, numCols, 0);
-      }
-   }
-
-   void setOsiObjCoeff(const double* objCoeff) {
-      assert(m_osi);
-      assert(m_colIndices);
-      assert(m_numCols == m_osi->getNumCols());
-
-      if (getModel()->isSparse()) {
-         const DecompConstraintSet* model = getModel();
-         const std::map<int, int>& origToSparse = model->getMapOrigToSparse();
-         std::map<int, int>::const_iterator mcit;
-
-         for (mcit = origToSparse.begin();
-               mcit != origToSparse.end(); mcit++) {
-            m_osi->setObjCoeff(mcit->second,           //sparse-index
-                               objCoeff[mcit->first]); //original-index
-         }
-      } else
-         m_osi->setObjCoeffSet(m_colIndices,
-                               m_colIndices + m_numCols, objCoeff);
-   }
+   /**
+    * Set the solver of the subproblem. The number of columns is assumed
+    * to stay constant from then on.
+    */
+   void setOsi(OsiSolverInterface* osi);
 
+   /** Set the objective (given in original space), the changes only. */
+   void setOsiObjCoeff(const double* objCoeff);
 
+   /**
+    * Set the bounds (given in original space) of the active columns, the
+    * changes only.
+    */
    void setActiveColBounds(const double* colLB,
-                           const double* colUB) {
-      DecompConstraintSet* model         = getModel();
-      std::vector<int>&          activeColumns = model->activeColumns;
-
-      //---
-      //--- if no active columns are set,  assume they are all active
-      //---   for e.g., in the case of one block (or sparse)
-      //---
-      if (model->isSparse()) {
-         const std::map<int, int>& origToSparse = model->getMapOrigToSparse();
-         std::map<int, int>::const_iterator mcit;
-
-         for (mcit  = origToSparse.begin();
-               mcit != origToSparse.end(); mcit++) {
-            m_osi->setColLower(mcit->second,        //sparse-index
-                               colLB[mcit->first]); //original-index
-            m_osi->setColUpper(mcit->second,        //sparse-index
-                               colUB[mcit->first]); //original-index
-            //printf("setColBounds orig:%d sparse:%d lb:%g ub:%g\n",
-            //   mcit->first, mcit->second,
-            //   colLB[mcit->first],
-            //   colUB[mcit->first]);
-         }
-      } else {
-         if (activeColumns.size()) {
-            std::vector<int>::iterator vi;
+                           const double* colUB);
 
-            for (vi = activeColumns.begin(); vi != activeColumns.end(); vi++) {
-               //printf("setColBounds i:%d to LB:%g UB:%g\n",
-               //     *vi, colLB[*vi], colUB[*vi]);
-               m_osi->setColBounds(*vi, colLB[*vi], colUB[*vi]);
-            }
-         } else {
-            m_osi->setColLower(colLB);
-            m_osi->setColUpper(colUB);
-         }
-      }
-   }
+   /**
+    * Replace the branching rows in the subproblem by the column rows
+    * (DecompBranchRow_Column) of this block. Returns the number of rows
+    * added.
+    */
+   int setBranchRows(const std::vector<DecompBranchRow>& rows);
 
    void solveAsMIPSym(DecompSolverResult*  result,
 		      DecompParam&         param,
@@ -251,8 +217,8 @@ public:
       DecompModel(appModel),
       m_osi         (NULL),
       m_numCols     (0   ),
-      m_colIndices  (NULL),
-      m_counter     ( 0 )
+      m_counter     ( 0 ),
+      m_numBaseRows (-1)
    {};
 
    DecompSubModel& operator=(const DecompModel& rhs) {
@@ -264,8 +230,8 @@ public:
       DecompModel(utilParam),
       m_osi         (NULL),
       m_numCols     (0   ),
-      m_colIndices  (NULL),
-      m_counter     (0)
+      m_counter     (0),
+      m_numBaseRows (-1)
    {};
    DecompSubModel(DecompConstraintSet* model,
                   std::string          modelName,
@@ -274,17 +240,13 @@ public:
       DecompModel(model, modelName, blockId, utilParam),
       m_osi         (NULL),
       m_numCols     (0   ),
-      m_colIndices  (NULL),
-      m_counter     (0)
+      m_counter     (0),
+      m_numBaseRows (-1)
    {};
    ~DecompSubModel() {
       if (m_osi) {
          delete    m_osi;
       }
-
-      if (m_colIndices) {
-         delete [] m_colIndices;
-      }
    }
 };
 
@@ -0,0 +1,314 @@
+//===========================================================================//
+// This file is part of the DIP Solver Framework.                            //
+//                                                                           //
+// DIP is distributed under the Eclipse Public License as part of the        //
+// COIN-OR repository (http://www.coin-or.org).                              //
+//                                                                           //
+// Authors: Matthew Galati, SAS Institute Inc. (matthew.galati@sas.com)      //
+//          Ted Ralphs, Lehigh University (ted@lehigh.edu)                   //
+//          Jiadong Wang, Lehigh University (jiw408@lehigh.edu)              //
+//                                                                           //
+// Copyright (C) 2002-2019, Lehigh University, Matthew Galati, Ted Ralphs    //
+// All Rights Reserved.                                                      //
+//===========================================================================//
+
+//===========================================================================//
+#include "DecompModelCache.h"
+#include "UtilBinaryIO.h"
+#include "UtilMacrosDecomp.h"
+
+#ifndef _WIN32
+#include <sys/stat.h>
+#endif
+
+using namespace std;
+
+static const char* ModelCacheMagic = "DIPMODEL";
+
+//===========================================================================//
+static void putConstraintSet(UtilBinaryWriter&          out,
+                             const DecompConstraintSet* model)
+{
+   const CoinPackedMatrix* M = model->M;
+   out.put<char>(M ? 1 : 0);
+
+   if (M) {
+      //---
+      //--- store the matrix compactly (no gaps between vectors)
+      //---
+      const int           nMajor = M->getMajorDim();
+      const CoinBigIndex* starts = M->getVectorStarts();
+      const int*          lens   = M->getVectorLengths();
+      const int*          ind    = M->getIndices();
+      const double*       els    = M->getElements();
+      vector<int>         lengths(lens, lens + nMajor);
+      vector<int>         indices;
+      vector<double>      elements;
+      indices.reserve(M->getNumElements());
+      elements.reserve(M->getNumElements());
+
+      for (int i = 0; i < nMajor; i++) {
+         indices.insert(indices.end(), ind + starts[i],
+                        ind + starts[i] + lens[i]);
+         elements.insert(elements.end(), els + starts[i],
+                         els + starts[i] + lens[i]);
+      }
+
+      out.put<char>(M->isColOrdered() ? 1 : 0);
+      out.put<int32_t>(M->getMinorDim());
+      out.put<int32_t>(nMajor);
+      out.putVector(lengths);
+      out.putVector(indices);
+      out.putVector(elements);
+   }
+
+   out.put<int32_t>(model->nBaseRowsOrig);
+   out.put<int32_t>(model->nBaseRows);
+   out.putVector(model->rowSense);
+   out.putVector(model->rowRhs);
+   out.putVector(model->rowLB);
+   out.putVector(model->rowUB);
+   out.putVector(model->colLB);
+   out.putVector(model->colUB);
+   out.putVector(model->integerVars);
+   out.putStrings(model->colNames);
+   out.putStrings(model->rowNames);
+   out.putVector(model->activeColumns);
+   out.putVector(model->masterOnlyCols);
+   out.put<char>(model->m_isSparse ? 1 : 0);
+   out.put<int32_t>(model->m_numColsOrig);
+   out.put<double>(model->m_infinity);
+   //---
+   //--- the sparse maps are 1-1, store them as pairs of arrays
+   //---
+   vector<int> origIndex, sparseIndex;
+   map<int, int>::const_iterator mit;
+   origIndex.reserve(model->m_origToSparse.size());
+   sparseIndex.reserve(model->m_origToSparse.size());
+
+   for (mit  = model->m_origToSparse.begin();
+         mit != model->m_origToSparse.end(); mit++) {
+      origIndex.push_back(mit->first);
+      sparseIndex.push_back(mit->second);
+   }
+
+   out.putVector(origIndex);
+   out.putVector(sparseIndex);
+}
+
+//===========================================================================//
+static DecompConstraintSet* getConstraintSet(UtilBinaryReader& in)
+{
+   DecompConstraintSet* model = new DecompConstraintSet();
+   CoinAssertHint(model, "Error: Out of Memory");
+
+   try {
+      if (in.get<char>()) {
+         bool           isColOrdered = in.get<char>() != 0;
+         int            nMinor       = in.get<int32_t>();
+         int            nMajor       = in.get<int32_t>();
+         vector<int>    lengths;
+         vector<int>    indices;
+         vector<double> elements;
+         in.getVector(lengths);
+         in.getVector(indices);
+         in.getVector(elements);
+
+         if (static_cast<int>(lengths.size()) != nMajor ||
+               indices.size() != elements.size()) {
+            throw UtilException("Inconsistent matrix in model cache.",
+                                "getConstraintSet", "DecompModelCache");
+         }
+
+         vector<CoinBigIndex> starts(nMajor + 1, 0);
+
+         for (int i = 0; i < nMajor; i++) {
+            starts[i + 1] = starts[i] + lengths[i];
+         }
+
+         if (starts[nMajor] != static_cast<CoinBigIndex>(indices.size())) {
+            throw UtilException("Inconsistent matrix in model cache.",
+                                "getConstraintSet", "DecompModelCache");
+         }
+
+         model->M = new CoinPackedMatrix(isColOrdered, nMinor, nMajor,
+                                         starts[nMajor],
+                                         elements.empty() ? 0 : &elements[0],
+                                         indices.empty()  ? 0 : &indices[0],
+                                         &starts[0],
+                                         nMajor ? &lengths[0] : 0);
+         CoinAssertHint(model->M, "Error: Out of Memory");
+      }
+
+      model->nBaseRowsOrig = in.get<int32_t>();
+      model->nBaseRows     = in.get<int32_t>();
+      in.getVector(model->rowSense);
+      in.getVector(model->rowRhs);
+      in.getVector(model->rowLB);
+      in.getVector(model->rowUB);
+      in.getVector(model->colLB);
+      in.getVector(model->colUB);
+      in.getVector(model->integerVars);
+      in.getStrings(model->colNames);
+      in.getStrings(model->rowNames);
+      in.getVector(model->activeColumns);
+      in.getVector(model->masterOnlyCols);
+      model->m_isSparse    = in.get<char>() != 0;
+      model->m_numColsOrig = in.get<int32_t>();
+      model->m_infinity    = in.get<double>();
+      vector<int> origIndex, sparseIndex;
+      in.getVector(origIndex);
+      in.getVector(sparseIndex);
+
+      if (origIndex.size() != sparseIndex.size()) {
+         throw UtilException("Inconsistent sparse map in model cache.",
+                             "getConstraintSet", "DecompModelCache");
+      }
+
+      for (size_t i = 0; i < origIndex.size(); i++) {
+         model->m_origToSparse.insert(make_pair(origIndex[i], sparseIndex[i]));
+         model->m_sparseToOrig.insert(make_pair(sparseIndex[i], origIndex[i]));
+      }
+
+      model->createSparseIndex();
+   } catch (...) {
+      UTIL_DELPTR(model);
+      throw;
+   }
+
+   return model;
+}
+
+//===========================================================================//
+string DecompModelCache::sourceStamp(const vector<string>& files)
+{
+   ostringstream stamp;
+
+   for (size_t i = 0; i < files.size(); i++) {
+      stamp << files[i];
+#ifndef _WIN32
+      struct stat st;
+
+      if (!files[i].empty() && stat(files[i].c_str(), &st) == 0) {
+         stamp << ":" << static_cast<long long>(st.st_size)
+               << ":" << static_cast<long long>(st.st_mtime);
+      }
+
+#endif
+      stamp << ";";
+   }
+
+   return stamp.str();
+}
+
+//===========================================================================//
+void DecompModelCache::write(const string&                     fileName,
+                             const string&                     stamp,
+                             const double                      objOffset,
+                             const int                         nCols,
+                             const double*                     objective,
+                             const DecompConstraintSet*        modelCore,
+                             const map<int, DecompConstraintSet*>& modelRelax)
+const
+{
+   UtilPrintFuncBegin(m_osLog, m_classTag,
+                      "write()", m_logLevel, 2);
+   assert(modelCore);
+   UtilBinaryWriter out;
+   out.putString(stamp);
+   out.put<double>(objOffset);
+   out.putArray(objective, static_cast<uint64_t>(nCols));
+   putConstraintSet(out, modelCore);
+   out.put<int32_t>(static_cast<int32_t>(modelRelax.size()));
+   map<int, DecompConstraintSet*>::const_iterator mit;
+
+   for (mit = modelRelax.begin(); mit != modelRelax.end(); mit++) {
+      out.put<int32_t>(mit->first);
+      putConstraintSet(out, mit->second);
+   }
+
+   if (!UtilWriteBinaryFile(fileName, ModelCacheMagic, Version,
+                            out.getBuffer())) {
+      throw UtilException("Cannot write model cache " + fileName + ".",
+                          "write", "DecompModelCache");
+   }
+
+   UTIL_MSG(m_logLevel, 1,
+            (*m_osLog) << "Wrote model cache " << fileName << " ("
+            << out.getBuffer().size() << " bytes)." << endl;);
+   UtilPrintFuncEnd(m_osLog, m_classTag,
+                    "write()", m_logLevel, 2);
+}
+
+//===========================================================================//
+bool DecompModelCache::read(const string&                   fileName,
+                            const string&                   stamp,
+                            double&                         objOffset,
+                            vector<double>&                 objective,
+                            DecompConstraintSet*&           modelCore,
+                            map<int, DecompConstraintSet*>& modelRelax) const
+{
+   UtilPrintFuncBegin(m_osLog, m_classTag,
+                      "read()", m_logLevel, 2);
+   vector<char> payload;
+   string       errMsg;
+
+   if (!UtilReadBinaryFile(fileName, ModelCacheMagic, Version,
+                           payload, errMsg)) {
+      UTIL_MSG(m_logLevel, 1,
+               (*m_osLog) << "Model cache not used: " << errMsg << endl;);
+      return false;
+   }
+
+   UtilBinaryReader in(payload);
+
+   if (in.getString() != stamp) {
+      UTIL_MSG(m_logLevel, 1,
+               (*m_osLog) << "Model cache not used: source files changed."
+               << endl;);
+      return false;
+   }
+
+   DecompConstraintSet*           core = NULL;
+   map<int, DecompConstraintSet*> relax;
+   map<int, DecompConstraintSet*>::iterator mit;
+
+   try {
+      double         offset = in.get<double>();
+      vector<double> obj;
+      in.getVector(obj);
+      core = getConstraintSet(in);
+      int nBlocks = in.get<int32_t>();
+
+      for (int b = 0; b < nBlocks; b++) {
+         int blockId = in.get<int32_t>();
+         relax.insert(make_pair(blockId, getConstraintSet(in)));
+      }
+
+      if (!in.atEnd()) {
+         throw UtilException("Trailing data in model cache.",
+                             "read", "DecompModelCache");
+      }
+
+      objOffset = offset;
+      objective.swap(obj);
+   } catch (CoinError& e) {
+      UTIL_DELPTR(core);
+
+      for (mit = relax.begin(); mit != relax.end(); mit++) {
+         UTIL_DELPTR(mit->second);
+      }
+
+      (*m_osLog) << "Model cache not used: " << e.message() << endl;
+      return false;
+   }
+
+   modelCore = core;
+   modelRelax.swap(relax);
+   UTIL_MSG(m_logLevel, 1,
+            (*m_osLog) << "Read model cache " << fileName << " ("
+            << modelRelax.size() << " blocks)." << endl;);
+   UtilPrintFuncEnd(m_osLog, m_classTag,
+                    "read()", m_logLevel, 2);
+   return true;
+}
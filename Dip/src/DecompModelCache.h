@@ -0,0 +1,90 @@
+//===========================================================================//
+// This file is part of the DIP Solver Framework.                            //
+//                                                                           //
+// DIP is distributed under the Eclipse Public License as part of the        //
+// COIN-OR repository (http://www.coin-or.org).                              //
+//                                                                           //
+// Authors: Matthew Galati, SAS Institute Inc. (matthew.galati@sas.com)      //
+//          Ted Ralphs, Lehigh University (ted@lehigh.edu)                   //
+//          Jiadong Wang, Lehigh University (jiw408@lehigh.edu)              //
+//                                                                           //
+// Copyright (C) 2002-2019, Lehigh University, Matthew Galati, Ted Ralphs    //
+// All Rights Reserved.                                                      //
+//===========================================================================//
+
+//===========================================================================//
+#ifndef DecompModelCache_h_
+#define DecompModelCache_h_
+
+//===========================================================================//
+#include "Decomp.h"
+#include "DecompConstraintSet.h"
+
+//===========================================================================//
+/**
+ * Binary snapshot of a decomposed instance.
+ *
+ * Stores the objective, the core DecompConstraintSet and the block
+ * DecompConstraintSets exactly as DecompApp::createModels() builds them
+ * (before prepareModel()), so that a later run can skip reading the
+ * instance and block file and go straight to setModelCore() and
+ * setModelRelax().
+ *
+ * The file uses the header of UtilBinaryIO.h (magic "DIPMODEL").
+ *
+ * The payload starts with a fingerprint of the source files (see
+ * sourceStamp()). A cache whose fingerprint does not match is ignored.
+ */
+//===========================================================================//
+class DecompModelCache {
+
+public:
+   static const unsigned int Version = 1;
+
+private:
+   std::string   m_classTag;
+   std::ostream* m_osLog;
+   int           m_logLevel;
+
+public:
+   /**
+    * Build the fingerprint of the files the model was created from
+    * (name, size and modification time of each).
+    */
+   static std::string sourceStamp(const std::vector<std::string>& files);
+
+   /**
+    * Write the snapshot. Throws UtilException if the file cannot be
+    * written.
+    */
+   void write(const std::string&                          fileName,
+              const std::string&                          stamp,
+              const double                                objOffset,
+              const int                                   nCols,
+              const double*                               objective,
+              const DecompConstraintSet*                  modelCore,
+              const std::map<int, DecompConstraintSet*>& modelRelax) const;
+
+   /**
+    * Read the snapshot. Returns false (and leaves the output untouched)
+    * if the file does not exist, is corrupt, was written by another
+    * version or its stamp does not match. The caller owns the returned
+    * constraint sets.
+    */
+   bool read(const std::string&                    fileName,
+             const std::string&                    stamp,
+             double&                               objOffset,
+             std::vector<double>&                  objective,
+             DecompConstraintSet*&                 modelCore,
+             std::map<int, DecompConstraintSet*>& modelRelax) const;
+
+public:
+   DecompModelCache(std::ostream* osLog    = &std::cout,
+                    const int     logLevel = 0) :
+      m_classTag("D-CACHE"),
+      m_osLog   (osLog),
+      m_logLevel(logLevel) {
+   }
+};
+
+#endif
@@ -0,0 +1,1099 @@
+//===========================================================================//
+// This file is part of the DIP Solver Framework.                            //
+//                                                                           //
+// DIP is distributed under the Eclipse Public License as part of the        //
+// COIN-OR repository (http://www.coin-or.org).                              //
+//                                                                           //
+// Authors: Matthew Galati, SAS Institute Inc. (matthew.galati@sas.com)      //
+//          Ted Ralphs, Lehigh University (ted@lehigh.edu)                   //
+//          Jiadong Wang, Lehigh University (jiw408@lehigh.edu)              //
+//                                                                           //
+// Copyright (C) 2002-2019, Lehigh University, Matthew Galati, Ted Ralphs    //
+// All Rights Reserved.                                                      //
+//===========================================================================//
+
+//===========================================================================//
+#include "DecompMpsReader.h"
+#include "UtilMacros.h"
+#include "UtilMacrosDecomp.h"
+
+#include <cstring>
+#include <cstdlib>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#ifdef _OPENMP
+#include "omp.h"
+#endif
+
+using namespace std;
+
+//===========================================================================//
+// MPS sections, in the order they may appear
+enum DecompMpsSection {
+   MpsSecNone,
+   MpsSecName,
+   MpsSecObjSense,
+   MpsSecRows,
+   MpsSecColumns,
+   MpsSecRhs,
+   MpsSecRanges,
+   MpsSecBounds,
+   MpsSecEnd,
+   MpsSecUnknown
+};
+
+//---
+//--- values at or beyond this are treated as infinite (as in CoinMpsIO)
+//---
+static const double MpsInfinity      = 1.0e30;
+static const int    MpsMaxTokens     = 8;
+static const size_t MpsMinChunkBytes = 1 << 20;
+
+//===========================================================================//
+struct DecompMpsReader::ColumnChunk {
+   size_t              beg;
+   size_t              end;
+   vector<const char*> namePtr;
+   vector<int>         nameLen;
+   vector<int>         count;
+   vector<double>      obj;
+   vector<signed char> intState;  //-1 = inherit state at chunk start
+   vector<int>         rowInd;
+   vector<double>      elem;
+   signed char         endState;  //-1 = no marker in this chunk
+   string              error;
+};
+
+//===========================================================================//
+struct DecompMpsReader::ValueChunk {
+   size_t              beg;
+   size_t              end;
+   int                 section;
+   vector<const char*> setPtr;
+   vector<int>         setLen;
+   vector<char>        type;
+   vector<int>         index;
+   vector<double>      value;
+   string              error;
+};
+
+//===========================================================================//
+static inline bool MpsIsSpace(const char c)
+{
+   return c == ' ' || c == '\t' || c == '\r';
+}
+
+//===========================================================================//
+static inline const char* MpsLineEnd(const char* p,
+                                     const char* e)
+{
+   const char* nl = static_cast<const char*>(memchr(p, '\n', e - p));
+   return nl ? nl : e;
+}
+
+//===========================================================================//
+static int MpsTokenize(const char*  p,
+                       const char*  e,
+                       const char** tok,
+                       int*         len)
+{
+   int n = 0;
+
+   while (p < e) {
+      while (p < e && MpsIsSpace(*p)) {
+         p++;
+      }
+
+      if (p >= e) {
+         break;
+      }
+
+      const char* s = p;
+
+      while (p < e && !MpsIsSpace(*p)) {
+         p++;
+      }
+
+      if (n < MpsMaxTokens) {
+         tok[n] = s;
+         len[n] = static_cast<int>(p - s);
+      }
+
+      n++;
+   }
+
+   return n;
+}
+
+//===========================================================================//
+static inline bool MpsTokenIs(const char* tok,
+                              const int   len,
+                              const char* str)
+{
+   return static_cast<int>(strlen(str)) == len && strncmp(tok, str, len) == 0;
+}
+
+//===========================================================================//
+static inline int MpsNameCompare(const char* a,
+                                 const int   aLen,
+                                 const char* b,
+                                 const int   bLen)
+{
+   int cmp = memcmp(a, b, aLen < bLen ? aLen : bLen);
+
+   if (cmp) {
+      return cmp;
+   }
+
+   return aLen - bLen;
+}
+
+//===========================================================================//
+static bool MpsParseDouble(const char* tok,
+                           const int   len,
+                           double&     value)
+{
+   //---
+   //--- the mapped file is not NUL-terminated, so strtod works on a copy
+   //---   (a number may be the last bytes of the last page)
+   //---
+   char buf[64];
+
+   if (len <= 0 || len >= static_cast<int>(sizeof(buf))) {
+      return false;
+   }
+
+   memcpy(buf, tok, len);
+   buf[len] = '\0';
+   char* endp = 0;
+   value = strtod(buf, &endp);
+   return endp == buf + len;
+}
+
+//===========================================================================//
+static int MpsSectionType(const char* tok,
+                          const int   len)
+{
+   if (MpsTokenIs(tok, len, "NAME")) {
+      return MpsSecName;
+   } else if (MpsTokenIs(tok, len, "OBJSENSE")) {
+      return MpsSecObjSense;
+   } else if (MpsTokenIs(tok, len, "ROWS")) {
+      return MpsSecRows;
+   } else if (MpsTokenIs(tok, len, "COLUMNS")) {
+      return MpsSecColumns;
+   } else if (MpsTokenIs(tok, len, "RHS")) {
+      return MpsSecRhs;
+   } else if (MpsTokenIs(tok, len, "RANGES")) {
+      return MpsSecRanges;
+   } else if (MpsTokenIs(tok, len, "BOUNDS")) {
+      return MpsSecBounds;
+   } else if (MpsTokenIs(tok, len, "ENDATA")) {
+      return MpsSecEnd;
+   }
+
+   return MpsSecUnknown;
+}
+
+//===========================================================================//
+namespace {
+struct NameRefLess {
+   template <class T>
+   bool operator()(const T& a, const T& b) const {
+      return MpsNameCompare(a.ptr, a.len, b.ptr, b.len) < 0;
+   }
+};
+}
+
+//===========================================================================//
+DecompMpsReader::DecompMpsReader(const int     numThreads,
+                                 const double  infinity,
+                                 std::ostream* osLog,
+                                 const int     logLevel) :
+   m_classTag  ("D-MPS"),
+   m_osLog     (osLog),
+   m_logLevel  (logLevel),
+   m_numThreads(numThreads),
+   m_infinity  (infinity),
+   m_buf       (0),
+   m_len       (0),
+   m_isMapped  (false),
+   m_objSense  (1),
+   m_objOffset (0.0)
+{
+#ifdef _OPENMP
+
+   if (m_numThreads <= 0) {
+      m_numThreads = omp_get_num_procs();
+   }
+
+#endif
+
+   if (m_numThreads <= 0) {
+      m_numThreads = 1;
+   }
+}
+
+//===========================================================================//
+DecompMpsReader::~DecompMpsReader()
+{
+   unmapFile();
+}
+
+//===========================================================================//
+bool DecompMpsReader::mapFile(const char* fileName)
+{
+#ifndef _WIN32
+   int fd = open(fileName, O_RDONLY);
+
+   if (fd < 0) {
+      return false;
+   }
+
+   struct stat st;
+
+   if (fstat(fd, &st) != 0) {
+      close(fd);
+      return false;
+   }
+
+   m_len = static_cast<size_t>(st.st_size);
+
+   if (m_len > 0) {
+      void* addr = mmap(0, m_len, PROT_READ, MAP_PRIVATE, fd, 0);
+
+      if (addr != MAP_FAILED) {
+#ifdef MADV_SEQUENTIAL
+         madvise(addr, m_len, MADV_SEQUENTIAL);
+#endif
+         m_buf      = static_cast<const char*>(addr);
+         m_isMapped = true;
+         close(fd);
+         return true;
+      }
+   }
+
+   close(fd);
+#endif
+   //---
+   //--- fall back to reading the whole file into memory
+   //---
+   ifstream is(fileName, ios::in | ios::binary);
+
+   if (!is) {
+      return false;
+   }
+
+   is.seekg(0, ios::end);
+   m_len = static_cast<size_t>(is.tellg());
+   is.seekg(0, ios::beg);
+   m_copy.resize(m_len + 1);
+
+   if (m_len > 0) {
+      is.read(&m_copy[0], m_len);
+   }
+
+   m_copy[m_len] = '\n';
+   m_buf         = &m_copy[0];
+   m_isMapped    = false;
+   return true;
+}
+
+//===========================================================================//
+void DecompMpsReader::unmapFile()
+{
+#ifndef _WIN32
+
+   if (m_isMapped && m_buf) {
+      munmap(const_cast<char*>(m_buf), m_len);
+   }
+
+#endif
+   m_buf      = 0;
+   m_len      = 0;
+   m_isMapped = false;
+   m_copy.clear();
+}
+
+//===========================================================================//
+void DecompMpsReader::splitChunks(const size_t    beg,
+                                  const size_t    end,
+                                  vector<size_t>& bounds) const
+{
+   //---
+   //--- split [beg,end) into line-aligned pieces; a few more pieces than
+   //---   threads so that dynamic scheduling can balance uneven lines
+   //---
+   size_t nChunks = static_cast<size_t>(4 * m_numThreads);
+   size_t maxChunks = (end - beg) / MpsMinChunkBytes + 1;
+
+   if (nChunks > maxChunks) {
+      nChunks = maxChunks;
+   }
+
+   bounds.clear();
+   bounds.push_back(beg);
+
+   for (size_t k = 1; k < nChunks; k++) {
+      size_t pos = beg + k * ((end - beg) / nChunks);
+
+      if (pos <= bounds.back()) {
+         continue;
+      }
+
+      pos = MpsLineEnd(m_buf + pos, m_buf + end) - m_buf;
+
+      if (pos < end) {
+         pos++;
+      }
+
+      if (pos > bounds.back() && pos < end) {
+         bounds.push_back(pos);
+      }
+   }
+
+   bounds.push_back(end);
+}
+
+//===========================================================================//
+int DecompMpsReader::findName(const vector<NameRef>& index,
+                              const char*            ptr,
+                              const int              len) const
+{
+   size_t lo = 0;
+   size_t hi = index.size();
+
+   while (lo < hi) {
+      size_t mid = lo + (hi - lo) / 2;
+      int    cmp = MpsNameCompare(index[mid].ptr, index[mid].len, ptr, len);
+
+      if (cmp < 0) {
+         lo = mid + 1;
+      } else if (cmp > 0) {
+         hi = mid;
+      } else {
+         return index[mid].index;
+      }
+   }
+
+   return -1;
+}
+
+//===========================================================================//
+void DecompMpsReader::buildIndex(vector<NameRef>& index) const
+{
+   sort(index.begin(), index.end(), NameRefLess());
+
+   for (size_t i = 1; i < index.size(); i++) {
+      if (MpsNameCompare(index[i - 1].ptr, index[i - 1].len,
+                         index[i].ptr, index[i].len) == 0) {
+         throw UtilException("Duplicate name " +
+                             string(index[i].ptr, index[i].len) + ".",
+                             "buildIndex", "DecompMpsReader");
+      }
+   }
+}
+
+//===========================================================================//
+void DecompMpsReader::parseRows(const size_t beg,
+                                const size_t end)
+{
+   const char* p = m_buf + beg;
+   const char* e = m_buf + end;
+   const char* tok[MpsMaxTokens];
+   int         len[MpsMaxTokens];
+   bool        foundObj = false;
+
+   while (p < e) {
+      const char* le = MpsLineEnd(p, e);
+      int nTok = MpsTokenize(p, le, tok, len);
+      p = le + 1;
+
+      if (nTok == 0 || *tok[0] == '*') {
+         continue;
+      }
+
+      if (nTok < 2 || len[0] != 1) {
+         throw UtilException("Bad line in ROWS section.",
+                             "parseRows", "DecompMpsReader");
+      }
+
+      NameRef ref;
+      ref.ptr   = tok[1];
+      ref.len   = len[1];
+      ref.index = static_cast<int>(m_rowMap.size());
+      m_rowIndex.push_back(ref);
+
+      switch (*tok[0]) {
+      case 'N':
+      case 'n':
+
+         //---
+         //--- the first free row is the objective; others are dropped
+         //---
+         if (!foundObj) {
+            m_rowMap.push_back(-1);
+            foundObj = true;
+         } else {
+            m_rowMap.push_back(-2);
+         }
+
+         break;
+      case 'E':
+      case 'e':
+      case 'L':
+      case 'l':
+      case 'G':
+      case 'g':
+         m_rowMap.push_back(static_cast<int>(m_rowNames.size()));
+         m_rowType.push_back(static_cast<char>(toupper(*tok[0])));
+         m_rowNames.push_back(string(tok[1], len[1]));
+         break;
+      default:
+         throw UtilException("Unknown row type in ROWS section.",
+                             "parseRows", "DecompMpsReader");
+      }
+   }
+
+   buildIndex(m_rowIndex);
+}
+
+//===========================================================================//
+void DecompMpsReader::parseChunkColumns(ColumnChunk& chunk) const
+{
+   const char* p = m_buf + chunk.beg;
+   const char* e = m_buf + chunk.end;
+   const char* tok[MpsMaxTokens];
+   int         len[MpsMaxTokens];
+   signed char state = -1;
+   chunk.endState    = -1;
+
+   while (p < e) {
+      const char* le = MpsLineEnd(p, e);
+      int nTok = MpsTokenize(p, le, tok, len);
+      p = le + 1;
+
+      if (nTok == 0 || *tok[0] == '*') {
+         continue;
+      }
+
+      //---
+      //--- integer markers
+      //---
+      if (nTok >= 3 &&
+            (MpsTokenIs(tok[1], len[1], "'MARKER'") ||
+             MpsTokenIs(tok[1], len[1], "MARKER"))) {
+         if (MpsTokenIs(tok[2], len[2], "'INTORG'") ||
+               MpsTokenIs(tok[2], len[2], "INTORG")) {
+            state = 1;
+         } else if (MpsTokenIs(tok[2], len[2], "'INTEND'") ||
+                    MpsTokenIs(tok[2], len[2], "INTEND")) {
+            state = 0;
+         } else {
+            chunk.error = "Unknown marker in COLUMNS section.";
+            return;
+         }
+
+         chunk.endState = state;
+         continue;
+      }
+
+      if (nTok != 3 && nTok != 5) {
+         chunk.error = "Bad line in COLUMNS section: "
+                       + string(tok[0], le - tok[0]);
+         return;
+      }
+
+      //---
+      //--- a new column starts when the name changes
+      //---
+      int nCols = static_cast<int>(chunk.namePtr.size());
+
+      if (nCols == 0 ||
+            MpsNameCompare(chunk.namePtr[nCols - 1], chunk.nameLen[nCols - 1],
+                           tok[0], len[0]) != 0) {
+         chunk.namePtr.push_back(tok[0]);
+         chunk.nameLen.push_back(len[0]);
+         chunk.count.push_back(0);
+         chunk.obj.push_back(0.0);
+         chunk.intState.push_back(state);
+         nCols++;
+      }
+
+      for (int t = 1; t < nTok; t += 2) {
+         double value;
+         int    rowPos = findName(m_rowIndex, tok[t], len[t]);
+
+         if (rowPos < 0) {
+            chunk.error = "Unknown row " + string(tok[t], len[t])
+                          + " in COLUMNS section.";
+            return;
+         }
+
+         if (!MpsParseDouble(tok[t + 1], len[t + 1], value)) {
+            chunk.error = "Bad value " + string(tok[t + 1], len[t + 1])
+                          + " in COLUMNS section.";
+            return;
+         }
+
+         int row = m_rowMap[rowPos];
+
+         if (row == -1) {
+            chunk.obj[nCols - 1] += value;
+         } else if (row >= 0) {
+            chunk.rowInd.push_back(row);
+            chunk.elem.push_back(value);
+            chunk.count[nCols - 1]++;
+         }
+      }
+   }
+}
+
+//===========================================================================//
+void DecompMpsReader::parseColumns(const size_t beg,
+                                   const size_t end)
+{
+   vector<size_t> bounds;
+   splitChunks(beg, end, bounds);
+   const int nChunks = static_cast<int>(bounds.size()) - 1;
+   vector<ColumnChunk> chunks(nChunks);
+   int k;
+
+   for (k = 0; k < nChunks; k++) {
+      chunks[k].beg = bounds[k];
+      chunks[k].end = bounds[k + 1];
+   }
+
+#ifdef _OPENMP
+   #pragma omp parallel for schedule(dynamic, 1) num_threads(m_numThreads)
+#endif
+   for (k = 0; k < nChunks; k++) {
+      parseChunkColumns(chunks[k]);
+   }
+
+   for (k = 0; k < nChunks; k++) {
+      if (!chunks[k].error.empty()) {
+         throw UtilException(chunks[k].error,
+                             "parseColumns", "DecompMpsReader");
+      }
+   }
+
+   //---
+   //--- stitch the chunks together in file order; a column split across
+   //---   two chunks continues the last column of the previous chunk,
+   //---   and integer markers carry over chunk boundaries
+   //---
+   vector<CoinBigIndex> nzOffset(nChunks + 1, 0);
+   const char* lastPtr = 0;
+   int         lastLen = 0;
+   signed char state   = 0;
+   int         i;
+
+   m_colStart.push_back(0);
+
+   for (k = 0; k < nChunks; k++) {
+      ColumnChunk& chunk = chunks[k];
+      const int    nCols = static_cast<int>(chunk.namePtr.size());
+      nzOffset[k + 1] = nzOffset[k]
+                        + static_cast<CoinBigIndex>(chunk.elem.size());
+
+      for (i = 0; i < nCols; i++) {
+         bool isCont = (i == 0 && lastPtr &&
+                        MpsNameCompare(lastPtr, lastLen,
+                                       chunk.namePtr[0],
+                                       chunk.nameLen[0]) == 0);
+
+         if (isCont) {
+            m_colStart.back() += chunk.count[0];
+            m_obj.back()      += chunk.obj[0];
+            continue;
+         }
+
+         signed char colState = chunk.intState[i] < 0 ?
+                                state : chunk.intState[i];
+         NameRef ref;
+         ref.ptr   = chunk.namePtr[i];
+         ref.len   = chunk.nameLen[i];
+         ref.index = static_cast<int>(m_colNames.size());
+         m_colIndex.push_back(ref);
+         m_colNames.push_back(string(ref.ptr, ref.len));
+         m_obj.push_back(chunk.obj[i]);
+         m_integer.push_back(colState > 0 ? 1 : 0);
+         m_colStart.push_back(m_colStart.back() + chunk.count[i]);
+      }
+
+      if (nCols > 0) {
+         lastPtr = chunk.namePtr[nCols - 1];
+         lastLen = chunk.nameLen[nCols - 1];
+      }
+
+      if (chunk.endState >= 0) {
+         state = chunk.endState;
+      }
+   }
+
+   m_rowInd.resize(nzOffset[nChunks]);
+   m_elem.resize(nzOffset[nChunks]);
+#ifdef _OPENMP
+   #pragma omp parallel for schedule(dynamic, 1) num_threads(m_numThreads)
+#endif
+   for (k = 0; k < nChunks; k++) {
+      const size_t n = chunks[k].elem.size();
+
+      if (n > 0) {
+         memcpy(&m_rowInd[nzOffset[k]], &chunks[k].rowInd[0], n * sizeof(int));
+         memcpy(&m_elem[nzOffset[k]], &chunks[k].elem[0], n * sizeof(double));
+      }
+   }
+
+   buildIndex(m_colIndex);
+}
+
+//===========================================================================//
+void DecompMpsReader::parseChunkValues(ValueChunk& chunk) const
+{
+   const char* p = m_buf + chunk.beg;
+   const char* e = m_buf + chunk.end;
+   const char* tok[MpsMaxTokens];
+   int         len[MpsMaxTokens];
+   const bool  isBounds = chunk.section == MpsSecBounds;
+
+   while (p < e) {
+      const char* le = MpsLineEnd(p, e);
+      int nTok = MpsTokenize(p, le, tok, len);
+      p = le + 1;
+
+      if (nTok == 0 || *tok[0] == '*') {
+         continue;
+      }
+
+      if (isBounds) {
+         //---
+         //--- type [set] column [value]
+         //---
+         char type = 0;
+         bool hasValue = true;
+
+         if (MpsTokenIs(tok[0], len[0], "UP")) {
+            type = 'U';
+         } else if (MpsTokenIs(tok[0], len[0], "LO")) {
+            type = 'L';
+         } else if (MpsTokenIs(tok[0], len[0], "FX")) {
+            type = 'X';
+         } else if (MpsTokenIs(tok[0], len[0], "LI")) {
+            type = 'I';
+         } else if (MpsTokenIs(tok[0], len[0], "UI")) {
+            type = 'J';
+         } else if (MpsTokenIs(tok[0], len[0], "FR")) {
+            type = 'F', hasValue = false;
+         } else if (MpsTokenIs(tok[0], len[0], "MI")) {
+            type = 'M', hasValue = false;
+         } else if (MpsTokenIs(tok[0], len[0], "PL")) {
+            type = 'P', hasValue = false;
+         } else if (MpsTokenIs(tok[0], len[0], "BV")) {
+            type = 'B', hasValue = false;
+         } else {
+            chunk.error = "Unsupported bound type "
+                          + string(tok[0], len[0]) + ".";
+            return;
+         }
+
+         int setTok = -1, colTok, valTok = -1;
+
+         if (hasValue) {
+            if (nTok == 3) {
+               colTok = 1, valTok = 2;
+            } else if (nTok == 4) {
+               setTok = 1, colTok = 2, valTok = 3;
+            } else {
+               chunk.error = "Bad line in BOUNDS section.";
+               return;
+            }
+         } else {
+            if (nTok == 2) {
+               colTok = 1;
+            } else if (nTok == 3 || nTok == 4) {
+               setTok = 1, colTok = 2;
+            } else {
+               chunk.error = "Bad line in BOUNDS section.";
+               return;
+            }
+         }
+
+         int    col   = findName(m_colIndex, tok[colTok], len[colTok]);
+         double value = 0.0;
+
+         if (col < 0) {
+            chunk.error = "Unknown column " + string(tok[colTok], len[colTok])
+                          + " in BOUNDS section.";
+            return;
+         }
+
+         if (valTok >= 0 &&
+               !MpsParseDouble(tok[valTok], len[valTok], value)) {
+            chunk.error = "Bad value " + string(tok[valTok], len[valTok])
+                          + " in BOUNDS section.";
+            return;
+         }
+
+         chunk.setPtr.push_back(setTok >= 0 ? tok[setTok] : 0);
+         chunk.setLen.push_back(setTok >= 0 ? len[setTok] : 0);
+         chunk.type.push_back(type);
+         chunk.index.push_back(col);
+         chunk.value.push_back(value);
+      } else {
+         //---
+         //--- [set] row value [row value]
+         //---
+         int first = 0;
+
+         if (nTok == 3 || nTok == 5) {
+            first = 1;
+         } else if (nTok != 2 && nTok != 4) {
+            chunk.error = "Bad line in RHS/RANGES section.";
+            return;
+         }
+
+         for (int t = first; t < nTok; t += 2) {
+            double value;
+            int    rowPos = findName(m_rowIndex, tok[t], len[t]);
+
+            if (rowPos < 0) {
+               chunk.error = "Unknown row " + string(tok[t], len[t])
+                             + " in RHS/RANGES section.";
+               return;
+            }
+
+            if (!MpsParseDouble(tok[t + 1], len[t + 1], value)) {
+               chunk.error = "Bad value " + string(tok[t + 1], len[t + 1])
+                             + " in RHS/RANGES section.";
+               return;
+            }
+
+            chunk.setPtr.push_back(first ? tok[0] : 0);
+            chunk.setLen.push_back(first ? len[0] : 0);
+            chunk.type.push_back(0);
+            chunk.index.push_back(rowPos);
+            chunk.value.push_back(value);
+         }
+      }
+   }
+}
+
+//===========================================================================//
+void DecompMpsReader::parseValues(const size_t beg,
+                                  const size_t end,
+                                  const int    section)
+{
+   vector<size_t> bounds;
+   splitChunks(beg, end, bounds);
+   const int nChunks = static_cast<int>(bounds.size()) - 1;
+   vector<ValueChunk> chunks(nChunks);
+   int k;
+
+   for (k = 0; k < nChunks; k++) {
+      chunks[k].beg     = bounds[k];
+      chunks[k].end     = bounds[k + 1];
+      chunks[k].section = section;
+   }
+
+#ifdef _OPENMP
+   #pragma omp parallel for schedule(dynamic, 1) num_threads(m_numThreads)
+#endif
+   for (k = 0; k < nChunks; k++) {
+      parseChunkValues(chunks[k]);
+   }
+
+   //---
+   //--- apply in file order (bounds may override each other); like
+   //---   CoinMpsIO, only the first named set is used
+   //---
+   const char* setPtr = 0;
+   int         setLen = 0;
+
+   for (k = 0; k < nChunks; k++) {
+      ValueChunk& chunk = chunks[k];
+
+      if (!chunk.error.empty()) {
+         throw UtilException(chunk.error, "parseValues", "DecompMpsReader");
+      }
+
+      for (size_t i = 0; i < chunk.value.size(); i++) {
+         if (chunk.setPtr[i]) {
+            if (!setPtr) {
+               setPtr = chunk.setPtr[i];
+               setLen = chunk.setLen[i];
+            } else if (MpsNameCompare(setPtr, setLen,
+                                      chunk.setPtr[i], chunk.setLen[i])) {
+               continue;
+            }
+         }
+
+         double value = chunk.value[i];
+
+         if (value >= MpsInfinity) {
+            value = m_infinity;
+         } else if (value <= -MpsInfinity) {
+            value = -m_infinity;
+         }
+
+         if (section == MpsSecBounds) {
+            const int c = chunk.index[i];
+
+            switch (chunk.type[i]) {
+            case 'U':
+               m_colUB[c] = value;
+
+               if (value < 0.0 && m_colLB[c] == 0.0) {
+                  m_colLB[c] = -m_infinity;
+               }
+
+               break;
+            case 'L':
+               m_colLB[c] = value;
+               break;
+            case 'X':
+               m_colLB[c] = value;
+               m_colUB[c] = value;
+               break;
+            case 'I':
+               m_colLB[c]   = value;
+               m_integer[c] = 1;
+               break;
+            case 'J':
+               m_colUB[c]   = value;
+               m_integer[c] = 1;
+               break;
+            case 'F':
+               m_colLB[c] = -m_infinity;
+               m_colUB[c] =  m_infinity;
+               break;
+            case 'M':
+               m_colLB[c] = -m_infinity;
+               break;
+            case 'P':
+               m_colUB[c] =  m_infinity;
+               break;
+            case 'B':
+               m_colLB[c]   = 0.0;
+               m_colUB[c]   = 1.0;
+               m_integer[c] = 1;
+               break;
+            }
+         } else {
+            const int r = m_rowMap[chunk.index[i]];
+
+            if (r == -1 && section == MpsSecRhs) {
+               m_objOffset = -value;
+            } else if (r >= 0 && section == MpsSecRhs) {
+               m_rhs[r] = value;
+            } else if (r >= 0) {
+               m_range[r]    = value;
+               m_hasRange[r] = 1;
+            }
+         }
+      }
+   }
+}
+
+//===========================================================================//
+int DecompMpsReader::readMps(const char* fileName)
+{
+   UtilPrintFuncBegin(m_osLog, m_classTag,
+                      "readMps()", m_logLevel, 2);
+
+   if (!mapFile(fileName)) {
+      return -1;
+   }
+
+   //---
+   //--- locate the sections (headers start in column one)
+   //---
+   size_t secBeg[MpsSecUnknown];
+   size_t secEnd[MpsSecUnknown];
+   int    s, cur = MpsSecNone;
+   const char* tok[MpsMaxTokens];
+   int         len[MpsMaxTokens];
+   const char* p = m_buf;
+   const char* e = m_buf + m_len;
+
+   for (s = 0; s < MpsSecUnknown; s++) {
+      secBeg[s] = secEnd[s] = 0;
+   }
+
+   while (p < e && cur != MpsSecEnd) {
+      const char* le = MpsLineEnd(p, e);
+
+      if (p < le && !MpsIsSpace(*p) && *p != '*') {
+         int nTok = MpsTokenize(p, le, tok, len);
+         int sec  = MpsSectionType(tok[0], len[0]);
+
+         if (sec != MpsSecUnknown) {
+            secEnd[cur] = p - m_buf;
+            cur         = sec;
+            secBeg[cur] = le + 1 - m_buf;
+
+            if (sec == MpsSecName && nTok > 1) {
+               UTIL_MSG(m_logLevel, 2,
+                        (*m_osLog) << "Problem name: "
+                        << string(tok[1], len[1]) << endl;);
+            } else if (sec == MpsSecObjSense && nTok > 1) {
+               if (MpsTokenIs(tok[1], len[1], "MAX") ||
+                     MpsTokenIs(tok[1], len[1], "MAXIMIZE")) {
+                  m_objSense = -1;
+               }
+            }
+         } else if (cur != MpsSecColumns && cur != MpsSecRhs &&
+                    cur != MpsSecRanges  && cur != MpsSecBounds &&
+                    cur != MpsSecRows    && cur != MpsSecObjSense) {
+            throw UtilException("Unsupported MPS section "
+                                + string(tok[0], len[0]) + ".",
+                                "readMps", "DecompMpsReader");
+         }
+      }
+
+      p = le + 1;
+   }
+
+   if (cur != MpsSecEnd) {
+      secEnd[cur] = m_len;
+   }
+
+   if (secBeg[MpsSecRows] == 0 || secBeg[MpsSecColumns] == 0) {
+      throw UtilException("Missing ROWS or COLUMNS section.",
+                          "readMps", "DecompMpsReader");
+   }
+
+   //---
+   //--- OBJSENSE as a section of its own
+   //---
+   if (secBeg[MpsSecObjSense] && secEnd[MpsSecObjSense] >
+         secBeg[MpsSecObjSense]) {
+      p = m_buf + secBeg[MpsSecObjSense];
+      e = m_buf + secEnd[MpsSecObjSense];
+      int nTok = MpsTokenize(p, MpsLineEnd(p, e), tok, len);
+
+      if (nTok > 0 && (MpsTokenIs(tok[0], len[0], "MAX") ||
+                       MpsTokenIs(tok[0], len[0], "MAXIMIZE"))) {
+         m_objSense = -1;
+      }
+   }
+
+   parseRows   (secBeg[MpsSecRows],    secEnd[MpsSecRows]);
+   parseColumns(secBeg[MpsSecColumns], secEnd[MpsSecColumns]);
+   const int nRows = getNumRows();
+   const int nCols = getNumCols();
+   m_rhs.assign     (nRows, 0.0);
+   m_range.assign   (nRows, 0.0);
+   m_hasRange.assign(nRows, 0);
+   m_colLB.assign   (nCols, 0.0);
+   m_colUB.assign   (nCols, m_infinity);
+
+   if (secBeg[MpsSecRhs]) {
+      parseValues(secBeg[MpsSecRhs], secEnd[MpsSecRhs], MpsSecRhs);
+   }
+
+   if (secBeg[MpsSecRanges]) {
+      parseValues(secBeg[MpsSecRanges], secEnd[MpsSecRanges], MpsSecRanges);
+   }
+
+   if (secBeg[MpsSecBounds]) {
+      parseValues(secBeg[MpsSecBounds], secEnd[MpsSecBounds], MpsSecBounds);
+   }
+
+   //---
+   //--- row bounds from sense, rhs and range
+   //---
+   m_rowLB.resize(nRows);
+   m_rowUB.resize(nRows);
+
+   for (int r = 0; r < nRows; r++) {
+      const double rhs   = m_rhs[r];
+      const double range = fabs(m_range[r]);
+
+      switch (m_rowType[r]) {
+      case 'E':
+         m_rowLB[r] = rhs;
+         m_rowUB[r] = rhs;
+
+         if (m_hasRange[r]) {
+            if (m_range[r] > 0) {
+               m_rowUB[r] = rhs + range;
+            } else {
+               m_rowLB[r] = rhs - range;
+            }
+         }
+
+         break;
+      case 'L':
+         m_rowLB[r] = m_hasRange[r] ? rhs - range : -m_infinity;
+         m_rowUB[r] = rhs;
+         break;
+      case 'G':
+         m_rowLB[r] = rhs;
+         m_rowUB[r] = m_hasRange[r] ? rhs + range : m_infinity;
+         break;
+      }
+   }
+
+   //---
+   //--- DIP minimizes
+   //---
+   if (m_objSense < 0) {
+      UTIL_MSG(m_logLevel, 1,
+               (*m_osLog) << "OBJSENSE MAX: negating the objective." << endl;);
+
+      for (int c = 0; c < nCols; c++) {
+         m_obj[c] = -m_obj[c];
+      }
+
+      m_objOffset = -m_objOffset;
+   }
+
+   UTIL_MSG(m_logLevel, 2,
+            (*m_osLog) << "Read " << nRows << " rows, " << nCols
+            << " columns, " << getNumElements() << " elements using "
+            << m_numThreads << " threads." << endl;);
+   //---
+   //--- names have been copied out, the file is no longer needed
+   //---
+   m_rowIndex.clear();
+   m_colIndex.clear();
+   unmapFile();
+   UtilPrintFuncEnd(m_osLog, m_classTag,
+                    "readMps()", m_logLevel, 2);
+   return 0;
+}
+
+//===========================================================================//
+void DecompMpsReader::loadInto(CoinMpsIO& mpsIO) const
+{
+   const int          nRows = getNumRows();
+   const int          nCols = getNumCols();
+   const CoinBigIndex nElem = getNumElements();
+   vector<int>        colLen(nCols);
+
+   for (int c = 0; c < nCols; c++) {
+      colLen[c] = static_cast<int>(m_colStart[c + 1] - m_colStart[c]);
+   }
+
+   CoinPackedMatrix M(true, nRows, nCols, nElem,
+                      nElem ? &m_elem[0]   : 0,
+                      nElem ? &m_rowInd[0] : 0,
+                      &m_colStart[0],
+                      nCols ? &colLen[0] : 0);
+   mpsIO.setMpsData(M, m_infinity,
+                    nCols ? &m_colLB[0]   : 0,
+                    nCols ? &m_colUB[0]   : 0,
+                    nCols ? &m_obj[0]     : 0,
+                    nCols ? &m_integer[0] : 0,
+                    nRows ? &m_rowLB[0]   : 0,
+                    nRows ? &m_rowUB[0]   : 0,
+                    m_colNames, m_rowNames);
+}
@@ -0,0 +1,146 @@
+//===========================================================================//
+// This file is part of the DIP Solver Framework.                            //
+//                                                                           //
+// DIP is distributed under the Eclipse Public License as part of the        //
+// COIN-OR repository (http://www.coin-or.org).                              //
+//                                                                           //
+// Authors: Matthew Galati, SAS Institute Inc. (matthew.galati@sas.com)      //
+//          Ted Ralphs, Lehigh University (ted@lehigh.edu)                   //
+//          Jiadong Wang, Lehigh University (jiw408@lehigh.edu)              //
+//                                                                           //
+// Copyright (C) 2002-2019, Lehigh University, Matthew Galati, Ted Ralphs    //
+// All Rights Reserved.                                                      //
+//===========================================================================//
+
+//===========================================================================//
+#ifndef DecompMpsReader_h_
+#define DecompMpsReader_h_
+
+//===========================================================================//
+#include "Decomp.h"
+#include "CoinMpsIO.hpp"
+
+//===========================================================================//
+/**
+ * Multithreaded reader for (uncompressed) MPS files.
+ *
+ * The file is memory mapped and split into line-aligned chunks. The
+ * COLUMNS, RHS, RANGES and BOUNDS sections are tokenized in parallel
+ * (OpenMP); the per-chunk results are then stitched together in file
+ * order. The ROWS section is parsed serially since every other section
+ * needs the row index.
+ *
+ * Names are parsed as whitespace separated tokens (free MPS). Fixed
+ * format files without embedded blanks in names read the same way.
+ *
+ * The result is handed to a CoinMpsIO object through setMpsData() so
+ * that the rest of DecompApp can keep using the CoinMpsIO accessors.
+ */
+//===========================================================================//
+class DecompMpsReader {
+
+private:
+   /** Row or column name, pointing into the mapped file. */
+   struct NameRef {
+      const char* ptr;
+      int         len;
+      int         index;
+   };
+
+   /** Result of tokenizing one chunk of the COLUMNS section. */
+   struct ColumnChunk;
+
+   /** Result of tokenizing one chunk of RHS, RANGES or BOUNDS. */
+   struct ValueChunk;
+
+private:
+   std::string          m_classTag;
+   std::ostream*        m_osLog;
+   int                  m_logLevel;
+   int                  m_numThreads;
+   double               m_infinity;
+
+   //---
+   //--- the mapped file
+   //---
+   const char*          m_buf;
+   size_t               m_len;
+   bool                 m_isMapped;
+   std::vector<char>    m_copy;
+
+   //---
+   //--- the parsed model
+   //---
+   int                  m_objSense;
+   double               m_objOffset;
+   std::vector<NameRef> m_rowIndex;   //sorted by name
+   std::vector<NameRef> m_colIndex;   //sorted by name
+   std::vector<int>     m_rowMap;     //ROWS position -> row (-1=obj,-2=free)
+   std::vector<char>    m_rowType;
+   std::vector<std::string> m_rowNames;
+   std::vector<std::string> m_colNames;
+   std::vector<CoinBigIndex> m_colStart;
+   std::vector<int>     m_rowInd;
+   std::vector<double>  m_elem;
+   std::vector<double>  m_obj;
+   std::vector<char>    m_integer;
+   std::vector<double>  m_rhs;
+   std::vector<double>  m_range;
+   std::vector<char>    m_hasRange;
+   std::vector<double>  m_rowLB;
+   std::vector<double>  m_rowUB;
+   std::vector<double>  m_colLB;
+   std::vector<double>  m_colUB;
+
+public:
+   /**
+    * Read the file. Returns -1 if the file could not be opened.
+    * Throws UtilException on a malformed file.
+    */
+   int readMps(const char* fileName);
+
+   /** Load the model into a CoinMpsIO object. */
+   void loadInto(CoinMpsIO& mpsIO) const;
+
+   inline double objectiveOffset() const {
+      return m_objOffset;
+   }
+   inline int getNumRows() const {
+      return static_cast<int>(m_rowNames.size());
+   }
+   inline int getNumCols() const {
+      return static_cast<int>(m_colNames.size());
+   }
+   inline CoinBigIndex getNumElements() const {
+      return static_cast<CoinBigIndex>(m_elem.size());
+   }
+
+private:
+   bool mapFile(const char* fileName);
+   void unmapFile();
+   void splitChunks(const size_t beg,
+                    const size_t end,
+                    std::vector<size_t>& bounds) const;
+   void parseRows(const size_t beg,
+                  const size_t end);
+   void parseColumns(const size_t beg,
+                     const size_t end);
+   void parseValues(const size_t beg,
+                    const size_t end,
+                    const int    section);
+   void parseChunkColumns(ColumnChunk& chunk) const;
+   void parseChunkValues(ValueChunk& chunk) const;
+   int  findName(const std::vector<NameRef>& index,
+                 const char* ptr,
+                 const int   len) const;
+   void buildIndex(std::vector<NameRef>& index) const;
+
+public:
+   DecompMpsReader(const int     numThreads,
+                   const double  infinity,
+                   std::ostream* osLog    = &std::cout,
+                   const int     logLevel = 0);
+   ~DecompMpsReader();
+};
+
+#endif
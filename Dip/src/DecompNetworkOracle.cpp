@@ -0,0 +1,232 @@
+//===========================================================================//
+// This file is part of the DIP Solver Framework.                            //
+//                                                                           //
+// DIP is distributed under the Eclipse Public License as part of the        //
+// COIN-OR repository (http://www.coin-or.org).                              //
+//                                                                           //
+// Authors: Matthew Galati, SAS Institute Inc. (matthew.galati@sas.com)      //
+//          Ted Ralphs, Lehigh University (ted@lehigh.edu)                   //
+//          Jiadong Wang, Lehigh University (jiw408@lehigh.edu)              //
+//                                                                           //
+// Copyright (C) 2002-2019, Lehigh University, Matthew Galati, Ted Ralphs    //
+// All Rights Reserved.                                                      //
+//===========================================================================//
+
+//===========================================================================//
+#include "DecompNetworkOracle.h"
+#include "UtilMacrosDecomp.h"
+
+using namespace std;
+
+//===========================================================================//
+static bool isIntegralOrInf(const double x,
+                            const double infinity)
+{
+   return fabs(x) >= infinity || fabs(x - floor(x + 0.5)) <= DecompEpsilon;
+}
+
+//===========================================================================//
+DecompNetworkOracle* DecompNetworkOracle::create(const vector<DecompOracleRow>& rows,
+                                                 const vector<double>& colLB,
+                                                 const vector<double>& colUB,
+                                                 const vector<char>&   isInt,
+                                                 const double          infinity)
+{
+   const int nRows   = static_cast<int>(rows.size());
+   const int nCols   = static_cast<int>(colLB.size());
+   const int virtualNode = nRows;
+   bool      anyInt  = false;
+   int       r, k;
+
+   if (nRows == 0) {
+      return NULL;
+   }
+
+   //---
+   //--- node-arc incidence: +1 in the head row, -1 in the tail row
+   //---
+   vector<int> head(nCols, -1), tail(nCols, -1);
+   vector<char> inRow(nCols, 0);
+
+   for (r = 0; r < nRows; r++) {
+      const DecompOracleRow& row = rows[r];
+
+      for (size_t t = 0; t < row.ind.size(); t++) {
+         const int c = row.ind[t];
+         inRow[c] = 1;
+
+         if (fabs(row.els[t] - 1.0) <= DecompEpsilon && head[c] < 0) {
+            head[c] = r;
+         } else if (fabs(row.els[t] + 1.0) <= DecompEpsilon && tail[c] < 0) {
+            tail[c] = r;
+         } else {
+            return NULL;
+         }
+      }
+   }
+
+   for (k = 0; k < nCols; k++) {
+      if (!inRow[k]) {
+         continue;
+      }
+
+      //---
+      //--- the flow is shifted by the lower bound, which must be finite
+      //---
+      if (colLB[k] <= -infinity) {
+         return NULL;
+      }
+
+      anyInt = anyInt || isInt[k];
+   }
+
+   if (anyInt) {
+      for (k = 0; k < nCols; k++) {
+         if (inRow[k] && (!isIntegralOrInf(colLB[k], infinity) ||
+                          !isIntegralOrInf(colUB[k], infinity))) {
+            return NULL;
+         }
+      }
+
+      for (r = 0; r < nRows; r++) {
+         if (!isIntegralOrInf(rows[r].lb, infinity) ||
+               !isIntegralOrInf(rows[r].ub, infinity)) {
+            return NULL;
+         }
+      }
+   }
+
+   //---
+   //--- the graph: supply = outflow - inflow = -rhs, slack arcs for
+   //---   the rows that are not equalities
+   //---
+   DecompNetworkOracle* oracle = new DecompNetworkOracle();
+   oracle->m_flow     = new DecompMinCostFlow(nRows + 1);
+   oracle->m_arcOfCol.assign(nCols, -1);
+   oracle->m_isInt    = isInt;
+   oracle->m_infinity = infinity;
+   DecompMinCostFlow* flow = oracle->m_flow;
+
+   for (k = 0; k < nCols; k++) {
+      if (inRow[k]) {
+         oracle->m_arcOfCol[k]
+            = flow->addArc(tail[k] < 0 ? virtualNode : tail[k],
+                           head[k] < 0 ? virtualNode : head[k]);
+      }
+   }
+
+   oracle->m_numColArcs = flow->getNumArcs();
+   double sumRhs = 0.0;
+
+   for (r = 0; r < nRows; r++) {
+      const double lb = rows[r].lb;
+      const double ub = rows[r].ub;
+      double       rhs;
+
+      if (ub < infinity) {
+         //---
+         //--- inflow - outflow + s = ub, 0 <= s <= ub - lb
+         //---
+         rhs = ub;
+
+         if (lb < ub - DecompEpsilon) {
+            flow->addArc(virtualNode, r);
+            oracle->m_slackLB.push_back(0.0);
+            oracle->m_slackUB.push_back(lb > -infinity ? ub - lb : infinity);
+         }
+      } else if (lb > -infinity) {
+         //---
+         //--- inflow - outflow - s = lb, s >= 0
+         //---
+         rhs = lb;
+         flow->addArc(r, virtualNode);
+         oracle->m_slackLB.push_back(0.0);
+         oracle->m_slackUB.push_back(infinity);
+      } else {
+         rhs = 0.0;
+         flow->addArc(virtualNode, r);
+         flow->addArc(r, virtualNode);
+         oracle->m_slackLB.push_back(0.0);
+         oracle->m_slackUB.push_back(infinity);
+         oracle->m_slackLB.push_back(0.0);
+         oracle->m_slackUB.push_back(infinity);
+      }
+
+      flow->setSupply(r, -rhs);
+      sumRhs += rhs;
+   }
+
+   flow->setSupply(virtualNode, sumRhs);
+   return oracle;
+}
+
+//===========================================================================//
+bool DecompNetworkOracle::solve(const double*       redCostX,
+                                const double*       colLB,
+                                const double*       colUB,
+                                DecompSolverResult* result) const
+{
+   const int      n     = static_cast<int>(m_cols.size());
+   const int      nArcs = m_flow->getNumArcs();
+   vector<double> cost(n), x(n, 0.0);
+   vector<double> arcCost(nArcs, 0.0), arcLB(nArcs), arcUB(nArcs);
+   int            k, a;
+
+   for (k = 0; k < n; k++) {
+      const int    j  = m_cols[k];
+      const double lb = colLB ? colLB[j] : m_colLB[k];
+      const double ub = colUB ? colUB[j] : m_colUB[k];
+      cost[k] = redCostX[j];
+
+      if (lb > ub + DecompEpsilon) {
+         return false;
+      }
+
+      a = m_arcOfCol[k];
+
+      if (a >= 0) {
+         arcCost[a] = cost[k];
+         arcLB[a]   = lb;
+         arcUB[a]   = ub;
+         continue;
+      }
+
+      //---
+      //--- a column in no row goes to the bound its cost prefers
+      //---
+      if (cost[k] > 0.0) {
+         x[k] = lb;
+      } else if (cost[k] < 0.0) {
+         x[k] = ub;
+      } else {
+         x[k] = CoinMin(CoinMax(0.0, lb), ub);
+      }
+
+      if (fabs(x[k]) >= m_infinity) {
+         return false;
+      }
+   }
+
+   for (a = m_numColArcs; a < nArcs; a++) {
+      arcLB[a] = m_slackLB[a - m_numColArcs];
+      arcUB[a] = m_slackUB[a - m_numColArcs];
+   }
+
+   vector<double> arcFlow;
+
+   if (!m_flow->solve(&arcCost[0], &arcLB[0], &arcUB[0],
+                      m_infinity, arcFlow)) {
+      return false;
+   }
+
+   for (k = 0; k < n; k++) {
+      a = m_arcOfCol[k];
+
+      if (a >= 0) {
+         x[k] = m_isInt[k] ? floor(arcFlow[a] + 0.5) : arcFlow[a];
+      }
+   }
+
+   setResult(x, cost, result);
+   return true;
+}
@@ -0,0 +1,91 @@
+//===========================================================================//
+// This file is part of the DIP Solver Framework.                            //
+//                                                                           //
+// DIP is distributed under the Eclipse Public License as part of the        //
+// COIN-OR repository (http://www.coin-or.org).                              //
+//                                                                           //
+// Authors: Matthew Galati, SAS Institute Inc. (matthew.galati@sas.com)      //
+//          Ted Ralphs, Lehigh University (ted@lehigh.edu)                   //
+//          Jiadong Wang, Lehigh University (jiw408@lehigh.edu)              //
+//                                                                           //
+// Copyright (C) 2002-2019, Lehigh University, Matthew Galati, Ted Ralphs    //
+// All Rights Reserved.                                                      //
+//===========================================================================//
+
+//===========================================================================//
+#ifndef DecompNetworkOracle_h_
+#define DecompNetworkOracle_h_
+
+//===========================================================================//
+#include "DecompPricingOracle.h"
+#include "DecompMinCostFlow.h"
+
+//===========================================================================//
+/**
+ * Pricing oracle for a block with node-arc incidence structure, such as
+ * the commodity blocks of a multi-commodity flow:
+ *   every row is a node,  lb <= inflow - outflow <= ub,
+ *   every column is an arc with a +1 in the row of its head and a -1 in
+ *   the row of its tail (either may be missing: the arc then comes from
+ *   or goes to a virtual node that balances the supplies).
+ *
+ * Rows that are not equalities get a slack arc to or from the virtual
+ * node. The graph is extracted once; each call sets the arc costs to
+ * the reduced costs and the arc bounds to the node bounds and solves a
+ * min-cost flow (DecompMinCostFlow), warm started from the potentials
+ * of the previous call. If a column is integer, the data must be
+ * integral, so that the flow is too.
+ */
+//===========================================================================//
+class DecompNetworkOracle : public DecompPricingOracle {
+
+private:
+   DecompMinCostFlow*  m_flow;
+   /** Arc of each block column (-1 if in no row). */
+   std::vector<int>    m_arcOfCol;
+   /** Is each block column integer? */
+   std::vector<char>   m_isInt;
+   /** Bounds of the slack arcs (arcs m_numColArcs, ...). */
+   int                 m_numColArcs;
+   std::vector<double> m_slackLB;
+   std::vector<double> m_slackUB;
+   double              m_infinity;
+
+public:
+   /**
+    * Recognize a network in the rows of a block (see
+    * DecompPricingOracle::create). Returns NULL if it is not one.
+    */
+   static DecompNetworkOracle* create(const std::vector<DecompOracleRow>& rows,
+                                      const std::vector<double>&          colLB,
+                                      const std::vector<double>&          colUB,
+                                      const std::vector<char>&            isInt,
+                                      const double                        infinity);
+
+   const char* getName() const {
+      return "network flow";
+   }
+
+   bool solve(const double*       redCostX,
+              const double*       colLB,
+              const double*       colUB,
+              DecompSolverResult* result) const;
+
+public:
+   DecompNetworkOracle() :
+      DecompPricingOracle(),
+      m_flow      (NULL),
+      m_arcOfCol  (),
+      m_isInt     (),
+      m_numColArcs(0),
+      m_slackLB   (),
+      m_slackUB   (),
+      m_infinity  (COIN_DBL_MAX) {
+   }
+
+   ~DecompNetworkOracle() {
+      UTIL_DELPTR(m_flow);
+   }
+};
+
+#endif
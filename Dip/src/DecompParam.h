@@ -80,6 +80,23 @@ public:
    double TailoffPercent;
    double MasterGapLimit;
 
+   //---
+   //--- pruning a node on its bound, checked after every bound update
+   //---   in the node: stop (and fathom) when its Lagrangian bound LB is
+   //---   >= UB - NodeFathomAbsGap or within NodePruneRelGap of the
+   //---   incumbent UB (default 0, a node close to UB may still hold a
+   //---   better solution); the search stops when the best bound of the
+   //---   open nodes is within NodeFathomRelGap of UB (the optimality gap,
+   //---   default 1e-4); with NodeBoundRounding, LB is rounded up when
+   //---   every solution has an integral objective value (integral costs
+   //---   on the integer columns, no cost on the continuous ones)
+   //---
+
+   double NodeFathomAbsGap;
+   double NodeFathomRelGap;
+   double NodePruneRelGap;
+   bool   NodeBoundRounding;
+
    //---
    //--- Strategy for switching from cutting to pricing
    //--- 0 = Default
@@ -96,6 +113,9 @@ public:
    //do not start compression until master gap is within this limit
    double CompressColumnsMasterGapStart;
    int    CutDC;
+   /* Time limit (seconds) of a decompose-and-cut call; a call that
+      stops on it gives no cut. */
+   double CutDCTimeLimit;
    int    CutCGL;
 
    int    CutCglKnapC;
@@ -104,6 +124,18 @@ public:
    int    CutCglClique;
    int    CutCglOddHole;
    int    CutCglGomory;
+   /* Threads for the CGL generators (each gets its own copy of the
+      cut generation solver); 1 calls them one after the other. */
+   int    CutCglThreads;
+   /* Time budget (seconds) per call of a CGL generator, 0 = none. A
+      generator over budget is skipped for a while (with CutCglSchedule,
+      the same for a call that finds no violated cut). */
+   double CutCglTimeBudget;
+   int    CutCglSchedule;
+   /* Run DecompApp::generateCuts concurrently with the CGL generators
+      (when CutCglThreads > 1). It must not use the solvers of the
+      algorithm. */
+   int    CutUserParallel;
 
    int    SubProbUseCutoff;
 
@@ -152,7 +184,7 @@ public:
 
    // DecompDualSimplex = 0,
    // DecompPrimSimplex = 1,
-   // DecompBarrier     = 2
+   // DecompBarrier     = 2 (Cpx or Clp, see MasterBarrierCrossover)
 
    int    SolveMasterUpdateAlgo;
 
@@ -167,6 +199,16 @@ public:
 
    int    SolveRelaxAsIp;
 
+   /*
+    * Pricing oracles: when the built-in IP solve is used for a block whose
+    * columns are binary and whose rows form a 0-1 knapsack, a
+    * multiple-choice knapsack or an assignment, or whose rows are the
+    * nodes of a network (node-arc incidence), solve it with a
+    * combinatorial algorithm instead (see DecompPricingOracle). The MIP
+    * is still solved if the oracle gives up. On by default.
+    */
+   bool   PricingOracles;
+
    int    InitVarsWithCutDC;
    int    InitVarsWithIP;
    int    InitVarsWithIPTimeLimit;
@@ -190,6 +232,24 @@ public:
 
    bool    BranchEnforceInSubProb;
    bool    BranchEnforceInMaster;
+   /* With BranchEnforceInMaster, make the bound rows of a column only
+      when it is branched on (instead of two rows for every integer
+      column up front). */
+   bool    BranchEnforceLazy;
+   /* Branch on more than one variable at a time (price-and-cut), tried
+      before the branching on single variables:
+      0 = off
+      1 = integral sums of a core row over a block or over all blocks
+          (enforced in the master)
+      2 = Ryan-Foster pairs of set-partitioning core rows (enforced in
+          pricing, needs BranchEnforceInSubProb)
+      3 = Ryan-Foster pairs, then sums */
+   int     BranchGeneric;
+   /* Reduced-cost fixing (price-and-cut): at the end of a node, tighten
+      the node's bounds of the integer columns that cannot take other
+      values in a solution better than the incumbent (see
+      DecompAlgo::reducedCostFixing). The children inherit them. */
+   bool    RedCostFixing;
    int    MasterConvexityLessThan; //0='E', 1='L'
    double ParallelColsLimit;       //cosine of angle >, then consider parallel
 
@@ -228,7 +288,22 @@ public:
 
    std::string DataDir;
    std::string Instance;
+
+   /*
+    * "MPS", "LP" or "" (detect from the file extension). "MPSParallel"
+    * reads an uncompressed MPS file with the multithreaded reader,
+    * using NumThreadsRead threads (0 = all processors).
+    */
    std::string InstanceFormat;
+   int         NumThreadsRead;
+
+   /*
+    * Binary snapshot of the decomposed models (see DecompModelCache).
+    * If the file exists and matches Instance/BlockFile it is used in
+    * place of reading them; otherwise it is (re)written after the
+    * models are created.
+    */
+   std::string ModelCacheFile;
 
    /*
    * The file defining which rows are in which blocks.
@@ -264,10 +339,30 @@ public:
     */
    std::string BlockFileFormat;
 
+   /*
+    * Presolve of the instance once the blocks are known (see
+    * DecompPresolve): bound tightening, removal of empty, singleton,
+    * redundant and duplicate rows, removal of fixed and duplicate
+    * columns and coefficient tightening, all within the rows of a block
+    * or of the core. PresolvePasses bounds the number of passes.
+    * Solutions are mapped back to the instance before they are written.
+    */
+   bool        Presolve;
+   int         PresolvePasses;
+
    std::string PermuteFile;
 
    std::string InitSolutionFile;
 
+   /*
+    * Binary column files (see DecompColumnFile). The columns in
+    * InitColumnFile are validated against the current model and added
+    * to the initial master; at the end of the search, the master columns
+    * and the var pool are written to ColumnOutputFile.
+    */
+   std::string InitColumnFile;
+   std::string ColumnOutputFile;
+
    int UseNames; // col/row names for debugging
    int UseSparse; // create all blocks sparsely
    int FullModel; // create full model for CPM or direct
@@ -327,6 +422,67 @@ public:
    bool UseMultiRay;
    bool DoInteriorPoint;
 
+   /*
+    * Barrier master with Clp (SolveMasterUpdateAlgo = DecompBarrier or
+    * DoInteriorPoint): MasterBarrierCrossover = crossover to an optimal
+    * basis (default no, only the interior duals are needed);
+    * MasterBarrierMaxIter = stop the barrier after this many iterations
+    * (0 = solve to optimality); the point is used if it is primal and dual
+    * feasible (its centrality is not checked) and the bound is then the
+    * master value less the duality gap, else simplex finishes the solve.
+    */
+   bool MasterBarrierCrossover;
+   int  MasterBarrierMaxIter;
+
+   /*
+    * Farkas pricing: when the restricted master is infeasible, price
+    * against the infeasibility certificate (dual ray) of the master LP
+    * instead of switching to phase I with artificial columns. Falls back
+    * to phase I if the LP solver does not give a usable ray.
+    * Only used for price-and-cut.
+    */
+   bool FarkasPricing;
+
+   /*
+    * Checkpointing of the search (see DecompCheckpoint). If
+    * CheckpointFile is set, the columns, cuts, open nodes and incumbent
+    * are written to it every CheckpointInterval seconds (real time).
+    * Restart=1 (or just --Restart on the command line) resumes the search
+    * from that file.
+    */
+   std::string CheckpointFile;
+   double      CheckpointInterval;
+   bool        Restart;
+
+   /*
+    * Event trace (see DecompTrace): if TraceFile is set, the master
+    * solves, pricing of each block, cut generation, column adds and
+    * compressions and nodes are timed, per thread, and written to it at
+    * the end of the search. TraceFormat: 0 = JSON lines, 1 = Chrome
+    * trace format. TraceBufferSize: events kept per thread (the oldest
+    * are dropped).
+    */
+   std::string TraceFile;
+   int         TraceFormat;
+   int         TraceBufferSize;
+
+   /*
+    * If set, a JSON summary of the run (bounds, nodes, time to the root
+    * bound, total time, pricing and cutting calls, columns and cuts
+    * generated) is written to StatsFile at the end of the search.
+    */
+   std::string StatsFile;
+
+   /*
+    * Low-memory mode, for very large models: no default row and column
+    * names are made for the models, the master and the subproblems get no
+    * names (names are made when needed for a message), and the row,
+    * column and cut hashes are compact hash values instead of the text of
+    * the vectors. Names given by the application are kept. The memory
+    * used by each part of the solver is printed with the statistics.
+    */
+   bool        LowMemory;
+
    /**
     * @}
     */
@@ -362,6 +518,10 @@ public:
       PARAM_getSetting("TailoffLength",        TailoffLength);
       PARAM_getSetting("TailoffPercent",       TailoffPercent);
       PARAM_getSetting("MasterGapLimit",       MasterGapLimit);
+      PARAM_getSetting("NodeFathomAbsGap",     NodeFathomAbsGap);
+      PARAM_getSetting("NodeFathomRelGap",     NodeFathomRelGap);
+      PARAM_getSetting("NodePruneRelGap",      NodePruneRelGap);
+      PARAM_getSetting("NodeBoundRounding",    NodeBoundRounding);
       PARAM_getSetting("PCStrategy",           PCStrategy);
       PARAM_getSetting("CompressColumns",      CompressColumns);
       PARAM_getSetting("CompressColumnsIterFreq",       CompressColumnsIterFreq);
@@ -369,6 +529,7 @@ public:
       PARAM_getSetting("CompressColumnsMasterGapStart",
                        CompressColumnsMasterGapStart);
       PARAM_getSetting("CutDC",                CutDC);
+      PARAM_getSetting("CutDCTimeLimit",       CutDCTimeLimit);
       PARAM_getSetting("CutCGL",               CutCGL);
       PARAM_getSetting("CutCglKnapC",          CutCglKnapC);
       PARAM_getSetting("CutCglFlowC",          CutCglFlowC);
@@ -376,6 +537,10 @@ public:
       PARAM_getSetting("CutCglClique",         CutCglClique);
       PARAM_getSetting("CutCglOddHole",        CutCglOddHole);
       PARAM_getSetting("CutCglGomory",         CutCglGomory);
+      PARAM_getSetting("CutCglThreads",        CutCglThreads);
+      PARAM_getSetting("CutCglTimeBudget",     CutCglTimeBudget);
+      PARAM_getSetting("CutCglSchedule",       CutCglSchedule);
+      PARAM_getSetting("CutUserParallel",      CutUserParallel);
       PARAM_getSetting("SubProbUseCutoff",     SubProbUseCutoff);
       PARAM_getSetting("SubProbGapLimitExact", SubProbGapLimitExact);
       PARAM_getSetting("SubProbGapLimitInexact", SubProbGapLimitInexact);
@@ -394,6 +559,7 @@ public:
       PARAM_getSetting("SolveMasterAsMipLimitGap",  SolveMasterAsMipLimitGap);
       PARAM_getSetting("SolveMasterUpdateAlgo",    SolveMasterUpdateAlgo);
       PARAM_getSetting("SolveRelaxAsIp",       SolveRelaxAsIp);
+      PARAM_getSetting("PricingOracles",       PricingOracles);
       PARAM_getSetting("InitVarsWithCutDC",    InitVarsWithCutDC);
       PARAM_getSetting("InitVarsWithIP",       InitVarsWithIP);
       PARAM_getSetting("InitVarsWithIPTimeLimit", InitVarsWithIPTimeLimit);
@@ -403,6 +569,9 @@ public:
       PARAM_getSetting("BreakOutPartial",      BreakOutPartial);
       PARAM_getSetting("BranchEnforceInSubProb",  BranchEnforceInSubProb);
       PARAM_getSetting("BranchEnforceInMaster",   BranchEnforceInMaster);
+      PARAM_getSetting("BranchEnforceLazy",       BranchEnforceLazy);
+      PARAM_getSetting("BranchGeneric",           BranchGeneric);
+      PARAM_getSetting("RedCostFixing",           RedCostFixing);
       PARAM_getSetting("MasterConvexityLessThan", MasterConvexityLessThan);
       PARAM_getSetting("ParallelColsLimit",       ParallelColsLimit);
       PARAM_getSetting("BranchStrongIter",        BranchStrongIter);
@@ -410,10 +579,16 @@ public:
       PARAM_getSetting("DataDir",          DataDir);
       PARAM_getSetting("Instance",         Instance);
       PARAM_getSetting("InstanceFormat",   InstanceFormat);
+      PARAM_getSetting("NumThreadsRead",   NumThreadsRead);
+      PARAM_getSetting("ModelCacheFile",   ModelCacheFile);
       PARAM_getSetting("BlockFile",        BlockFile);
       PARAM_getSetting("PermuteFile",      PermuteFile);
       PARAM_getSetting("BlockFileFormat",  BlockFileFormat);
+      PARAM_getSetting("Presolve",         Presolve);
+      PARAM_getSetting("PresolvePasses",   PresolvePasses);
       PARAM_getSetting("InitSolutionFile", InitSolutionFile);
+      PARAM_getSetting("InitColumnFile",   InitColumnFile);
+      PARAM_getSetting("ColumnOutputFile", ColumnOutputFile);
       PARAM_getSetting("LogLevel", LogLevel);
       PARAM_getSetting("UseNames", UseNames);
       PARAM_getSetting("UseSparse", UseSparse);
@@ -444,6 +619,25 @@ public:
       PARAM_getSetting("DecompLPSolver", DecompLPSolver);
       PARAM_getSetting("UseMultiRay", UseMultiRay);
       PARAM_getSetting("DoInteriorPoint", DoInteriorPoint);
+      PARAM_getSetting("MasterBarrierCrossover", MasterBarrierCrossover);
+      PARAM_getSetting("MasterBarrierMaxIter", MasterBarrierMaxIter);
+      PARAM_getSetting("FarkasPricing", FarkasPricing);
+      PARAM_getSetting("CheckpointFile", CheckpointFile);
+      PARAM_getSetting("CheckpointInterval", CheckpointInterval);
+      PARAM_getSetting("Restart", Restart);
+      PARAM_getSetting("TraceFile", TraceFile);
+      PARAM_getSetting("TraceFormat", TraceFormat);
+      PARAM_getSetting("TraceBufferSize", TraceBufferSize);
+      PARAM_getSetting("StatsFile", StatsFile);
+      PARAM_getSetting("LowMemory", LowMemory);
+
+      //---
+      //--- a bare --Restart flag is stored with an empty value
+      //---
+      if (param.GetSetting("Restart", std::string("0"), sec) == "") {
+         Restart = true;
+      }
+
       //---
       //--- store the original setting for DualStabAlpha
       //---
@@ -492,6 +686,10 @@ public:
       UtilPrintParameter(os, sec, "TailoffLength",       TailoffLength);
       UtilPrintParameter(os, sec, "TailoffPercent",      TailoffPercent);
       UtilPrintParameter(os, sec, "MasterGapLimit",      MasterGapLimit);
+      UtilPrintParameter(os, sec, "NodeFathomAbsGap",    NodeFathomAbsGap);
+      UtilPrintParameter(os, sec, "NodeFathomRelGap",    NodeFathomRelGap);
+      UtilPrintParameter(os, sec, "NodePruneRelGap",     NodePruneRelGap);
+      UtilPrintParameter(os, sec, "NodeBoundRounding",   NodeBoundRounding);
       UtilPrintParameter(os, sec, "PCStrategy",          PCStrategy);
       UtilPrintParameter(os, sec, "CompressColumns",     CompressColumns);
       UtilPrintParameter(os, sec, "CompressColumnsIterFreq",
@@ -501,6 +699,7 @@ public:
       UtilPrintParameter(os, sec, "CompressColumnsMasterGapStart",
                          CompressColumnsMasterGapStart);
       UtilPrintParameter(os, sec, "CutDC",               CutDC);
+      UtilPrintParameter(os, sec, "CutDCTimeLimit",      CutDCTimeLimit);
       UtilPrintParameter(os, sec, "CutCGL",              CutCGL);
       UtilPrintParameter(os, sec, "CutCglKnapC",         CutCglKnapC);
       UtilPrintParameter(os, sec, "CutCglFlowC",         CutCglFlowC);
@@ -508,6 +707,10 @@ public:
       UtilPrintParameter(os, sec, "CutCglClique",        CutCglClique);
       UtilPrintParameter(os, sec, "CutCglOddHole",       CutCglOddHole);
       UtilPrintParameter(os, sec, "CutCglGomory",        CutCglGomory);
+      UtilPrintParameter(os, sec, "CutCglThreads",       CutCglThreads);
+      UtilPrintParameter(os, sec, "CutCglTimeBudget",    CutCglTimeBudget);
+      UtilPrintParameter(os, sec, "CutCglSchedule",      CutCglSchedule);
+      UtilPrintParameter(os, sec, "CutUserParallel",     CutUserParallel);
       UtilPrintParameter(os, sec, "SubProbUseCutoff",    SubProbUseCutoff);
       UtilPrintParameter(os, sec, "SubProbGapLimitExact",
                          SubProbGapLimitExact);
@@ -537,6 +740,7 @@ public:
       UtilPrintParameter(os, sec, "SolveMasterUpdateAlgo",
                          SolveMasterUpdateAlgo);
       UtilPrintParameter(os, sec, "SolveRelaxAsIp",     SolveRelaxAsIp);
+      UtilPrintParameter(os, sec, "PricingOracles",     PricingOracles);
       UtilPrintParameter(os, sec, "InitVarsWithCutDC",   InitVarsWithCutDC);
       UtilPrintParameter(os, sec, "InitVarsWithIP",   InitVarsWithIP);
       UtilPrintParameter(os, sec, "InitVarsWithIPTimeLimit",
@@ -549,6 +753,12 @@ public:
                          BranchEnforceInSubProb);
       UtilPrintParameter(os, sec, "BranchEnforceInMaster",
                          BranchEnforceInMaster);
+      UtilPrintParameter(os, sec, "BranchEnforceLazy",
+                         BranchEnforceLazy);
+      UtilPrintParameter(os, sec, "BranchGeneric",
+                         BranchGeneric);
+      UtilPrintParameter(os, sec, "RedCostFixing",
+                         RedCostFixing);
       UtilPrintParameter(os, sec, "MasterConvexityLessThan",
                          MasterConvexityLessThan);
       UtilPrintParameter(os, sec, "ParallelColsLimit", ParallelColsLimit);
@@ -559,10 +769,16 @@ public:
       UtilPrintParameter(os, sec, "DataDir",  DataDir);
       UtilPrintParameter(os, sec, "Instance",  Instance);
       UtilPrintParameter(os, sec, "InstanceFormat",  InstanceFormat);
+      UtilPrintParameter(os, sec, "NumThreadsRead",  NumThreadsRead);
+      UtilPrintParameter(os, sec, "ModelCacheFile",  ModelCacheFile);
       UtilPrintParameter(os, sec, "BlockFile",  BlockFile);
       UtilPrintParameter(os, sec, "PermuteFile",  PermuteFile);
       UtilPrintParameter(os, sec, "BlockFileFormat",  BlockFileFormat);
+      UtilPrintParameter(os, sec, "Presolve",  Presolve);
+      UtilPrintParameter(os, sec, "PresolvePasses",  PresolvePasses);
       UtilPrintParameter(os, sec, "InitSolutionFile",  InitSolutionFile);
+      UtilPrintParameter(os, sec, "InitColumnFile",  InitColumnFile);
+      UtilPrintParameter(os, sec, "ColumnOutputFile",  ColumnOutputFile);
       UtilPrintParameter(os, sec, "UseNames",  UseNames);
       UtilPrintParameter(os, sec, "UseSparse",  UseSparse);
       UtilPrintParameter(os, sec, "FullModel",  FullModel);
@@ -593,6 +809,18 @@ public:
       UtilPrintParameter(os, sec, "DecompLPSplver", DecompLPSolver);
       UtilPrintParameter(os, sec, "UseMultiRay", UseMultiRay);
       UtilPrintParameter(os, sec, "DoInteriorPoint", DoInteriorPoint);
+      UtilPrintParameter(os, sec, "MasterBarrierCrossover",
+                         MasterBarrierCrossover);
+      UtilPrintParameter(os, sec, "MasterBarrierMaxIter", MasterBarrierMaxIter);
+      UtilPrintParameter(os, sec, "FarkasPricing", FarkasPricing);
+      UtilPrintParameter(os, sec, "CheckpointFile", CheckpointFile);
+      UtilPrintParameter(os, sec, "CheckpointInterval", CheckpointInterval);
+      UtilPrintParameter(os, sec, "Restart", Restart);
+      UtilPrintParameter(os, sec, "TraceFile", TraceFile);
+      UtilPrintParameter(os, sec, "TraceFormat", TraceFormat);
+      UtilPrintParameter(os, sec, "TraceBufferSize", TraceBufferSize);
+      UtilPrintParameter(os, sec, "StatsFile", StatsFile);
+      UtilPrintParameter(os, sec, "LowMemory", LowMemory);
       (*os) << "========================================================\n";
    }
 
@@ -615,12 +843,17 @@ public:
       TailoffLength        = 10;
       TailoffPercent       = 0.10;
       MasterGapLimit       = 1.0e-6;
+      NodeFathomAbsGap     = 0.0;
+      NodeFathomRelGap     = 1.0e-4;
+      NodePruneRelGap      = 0.0;
+      NodeBoundRounding    = true;
       PCStrategy           = 0;
       CompressColumns      = 1;
       CompressColumnsIterFreq       = 2;
       CompressColumnsSizeMultLimit  = 1.20;
       CompressColumnsMasterGapStart = 0.20;
       CutDC                = 0;
+      CutDCTimeLimit       = 10.0;
       CutCGL               = 0;
       CutCglKnapC          = 1;
       CutCglFlowC          = 1;
@@ -628,6 +861,10 @@ public:
       CutCglClique         = 1;
       CutCglOddHole        = 1;
       CutCglGomory         = 1;
+      CutCglThreads        = 1;
+      CutCglTimeBudget     = 0.0;
+      CutCglSchedule       = 0;
+      CutUserParallel      = 0;
       SubProbUseCutoff     = 0;
       SubProbGapLimitExact   = 0.0001; // 0.01% gap
       SubProbGapLimitInexact = 0.1;    //10.00% gap
@@ -645,6 +882,7 @@ public:
       SolveMasterAsMipTimeLimit = 30;
       SolveMasterAsMipLimitGap  = 0.05; //5% gap
       SolveRelaxAsIp           = 0;
+      PricingOracles           = true;
       SolveMasterUpdateAlgo    = DecompDualSimplex;
       InitVarsWithCutDC        = 0;
       InitVarsWithIP           = 0;
@@ -655,6 +893,9 @@ public:
       BreakOutPartial          = 0;
       BranchEnforceInSubProb   = 1;//usually much better if can
       BranchEnforceInMaster    = 0;
+      BranchEnforceLazy        = 0;
+      BranchGeneric            = 0;
+      RedCostFixing            = false;
       MasterConvexityLessThan  = 0;
       ParallelColsLimit        = 1.0;
       BranchStrongIter         = 0;
@@ -666,10 +907,16 @@ public:
       DataDir                  = "";
       Instance                 = "";
       InstanceFormat           = "";
+      NumThreadsRead           = 0;
+      ModelCacheFile           = "";
       BlockFile                = "";
       BlockFileFormat          = "";
+      Presolve                 = false;
+      PresolvePasses           = 10;
       PermuteFile              = "";
       InitSolutionFile         = "";
+      InitColumnFile           = "";
+      ColumnOutputFile         = "";
       UseNames                 = 1 ;
       UseSparse                = 1 ;
       FullModel                = 0 ;
@@ -699,6 +946,17 @@ public:
       DecompLPSolver           = "Clp";
       UseMultiRay              = false;
       DoInteriorPoint          = false;
+      MasterBarrierCrossover   = false;
+      MasterBarrierMaxIter     = 0;
+      FarkasPricing            = false;
+      CheckpointFile           = "";
+      CheckpointInterval       = 600;
+      Restart                  = false;
+      TraceFile                = "";
+      TraceFormat              = 0;
+      TraceBufferSize          = 65536;
+      StatsFile                = "";
+      LowMemory                = false;
    }
 
    void dumpSettings(std::ostream* os = &std::cout) {
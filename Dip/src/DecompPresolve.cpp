@@ -0,0 +1,905 @@
+//===========================================================================//
+// This file is part of the DIP Solver Framework.                            //
+//                                                                           //
+// DIP is distributed under the Eclipse Public License as part of the        //
+// COIN-OR repository (http://www.coin-or.org).                              //
+//                                                                           //
+// Authors: Matthew Galati, SAS Institute Inc. (matthew.galati@sas.com)      //
+//          Ted Ralphs, Lehigh University (ted@lehigh.edu)                   //
+//          Jiadong Wang, Lehigh University (jiw408@lehigh.edu)              //
+//                                                                           //
+// Copyright (C) 2002-2019, Lehigh University, Matthew Galati, Ted Ralphs    //
+// All Rights Reserved.                                                      //
+//===========================================================================//
+
+//===========================================================================//
+#include "DecompPresolve.h"
+#include "UtilMacros.h"
+#include "UtilMacrosDecomp.h"
+#include "UtilHash.h"
+
+#include <algorithm>
+
+using namespace std;
+
+//===========================================================================//
+DecompPresolve::DecompPresolve(const double  infinity,
+                               std::ostream* osLog,
+                               const int     logLevel) :
+   m_classTag        ("D-PRE"),
+   m_osLog           (osLog),
+   m_logLevel        (logLevel),
+   m_infinity        (infinity),
+   m_infBound        (CoinMin(infinity, 1.0e20)),
+   m_feasTol         (1.0e-6),
+   m_nRowsOrig       (0),
+   m_nColsOrig       (0),
+   m_objSense        (1),
+   m_objOffset       (0.0),
+   m_nBoundsTightened(0),
+   m_nCoefsTightened (0),
+   m_nRowsEmpty      (0),
+   m_nRowsSingleton  (0),
+   m_nRowsRedundant  (0),
+   m_nRowsDuplicate  (0),
+   m_nColsFixed      (0),
+   m_nColsDuplicate  (0)
+{
+}
+
+//===========================================================================//
+bool DecompPresolve::presolve(const CoinPackedMatrix& matrix,
+                              const double*           colLB,
+                              const double*           colUB,
+                              const double*           obj,
+                              const char*             integerVars,
+                              const double*           rowLB,
+                              const double*           rowUB,
+                              const vector<int>&      rowBlock,
+                              const int               objSense,
+                              const int               maxPasses)
+{
+   UtilPrintFuncBegin(m_osLog, m_classTag,
+                      "presolve()", m_logLevel, 2);
+   m_nRowsOrig = matrix.getNumRows();
+   m_nColsOrig = matrix.getNumCols();
+
+   if (matrix.isColOrdered()) {
+      m_colM = matrix;
+      m_rowM.reverseOrderedCopyOf(matrix);
+   } else {
+      m_rowM = matrix;
+      m_colM.reverseOrderedCopyOf(matrix);
+   }
+
+   m_rowM.removeGaps();
+   m_colM.removeGaps();
+   m_rowLB.assign(rowLB, rowLB + m_nRowsOrig);
+   m_rowUB.assign(rowUB, rowUB + m_nRowsOrig);
+   m_colLB.assign(colLB, colLB + m_nColsOrig);
+   m_colUB.assign(colUB, colUB + m_nColsOrig);
+   m_obj  .assign(obj,   obj   + m_nColsOrig);
+   m_isInt.assign(m_nColsOrig, 0);
+
+   if (integerVars) {
+      for (int j = 0; j < m_nColsOrig; j++) {
+         m_isInt[j] = integerVars[j] ? 1 : 0;
+      }
+   }
+
+   m_rowBlock = rowBlock;
+   m_rowDel.assign(m_nRowsOrig, 0);
+   m_colDel.assign(m_nColsOrig, 0);
+   m_colFixed.assign(m_nColsOrig, 0.0);
+   m_merged.clear();
+   m_objSense  = objSense;
+   m_objOffset = 0.0;
+   //---
+   //--- the reductions feed each other (a tighter bound makes a row
+   //---   redundant or a column fixed, ...), repeat them until nothing
+   //---   changes
+   //---
+   bool feasible = true;
+   int  pass;
+
+   for (pass = 0; pass < maxPasses; pass++) {
+      int nChanges = removeFixedCols();
+      int nRows    = presolveRows();
+
+      if (nRows < 0) {
+         feasible = false;
+         break;
+      }
+
+      nChanges += nRows;
+      nChanges += tightenCoefs();
+      UTIL_MSG(m_logLevel, 3,
+               (*m_osLog) << "Presolve pass " << pass
+               << ": " << nChanges << " changes." << endl;);
+
+      if (!nChanges) {
+         break;
+      }
+   }
+
+   if (feasible) {
+      removeFixedCols();
+      feasible = removeDuplicateRows() >= 0;
+   }
+
+   if (!feasible) {
+      UTIL_MSG(m_logLevel, 1,
+               (*m_osLog) << "Presolve found the model infeasible." << endl;);
+      UtilPrintFuncEnd(m_osLog, m_classTag,
+                       "presolve()", m_logLevel, 2);
+      return false;
+   }
+
+   removeDuplicateCols();
+   buildReduced();
+   //---
+   //--- the working copies are no longer needed
+   //---
+   m_rowM = CoinPackedMatrix();
+   m_colM = CoinPackedMatrix();
+   UtilPrintFuncEnd(m_osLog, m_classTag,
+                    "presolve()", m_logLevel, 2);
+   return true;
+}
+
+//===========================================================================//
+void DecompPresolve::rowActivity(const int r,
+                                 double&   minAct,
+                                 double&   maxAct,
+                                 int&      minInf,
+                                 int&      maxInf,
+                                 int&      nLive) const
+{
+   const int*          ind = m_rowM.getIndices();
+   const double*       els = m_rowM.getElements();
+   const CoinBigIndex  beg = m_rowM.getVectorFirst(r);
+   const CoinBigIndex  end = m_rowM.getVectorLast(r);
+   minAct = maxAct = 0.0;
+   minInf = maxInf = nLive = 0;
+
+   for (CoinBigIndex k = beg; k < end; k++) {
+      const int    j = ind[k];
+      const double a = els[k];
+
+      if (m_colDel[j] || a == 0.0) {
+         continue;
+      }
+
+      nLive++;
+      const double lo = a > 0 ? m_colLB[j] : m_colUB[j];
+      const double hi = a > 0 ? m_colUB[j] : m_colLB[j];
+
+      if (isInf(lo)) {
+         minInf++;
+      } else {
+         minAct += a * lo;
+      }
+
+      if (isInf(hi)) {
+         maxInf++;
+      } else {
+         maxAct += a * hi;
+      }
+   }
+}
+
+//===========================================================================//
+int DecompPresolve::tightenBounds(const int  j,
+                                  double     newLB,
+                                  double     newUB,
+                                  const bool exact)
+{
+   double& lb      = m_colLB[j];
+   double& ub      = m_colUB[j];
+   int     changed = 0;
+
+   if (m_isInt[j]) {
+      if (!isInf(newLB)) {
+         newLB = ceil(newLB - m_feasTol);
+      }
+
+      if (!isInf(newUB)) {
+         newUB = floor(newUB + m_feasTol);
+      }
+   }
+
+   //---
+   //--- small changes of continuous bounds only slow the LPs down, the
+   //---   bounds of a removed row have to be kept whatever they are
+   //---
+   const double minLBChange = m_isInt[j] || exact ? 0.0 :
+                              1.0e-3 * CoinMax(1.0, fabs(lb));
+   const double minUBChange = m_isInt[j] || exact ? 0.0 :
+                              1.0e-3 * CoinMax(1.0, fabs(ub));
+
+   if (!isInf(newLB) && (exact || fabs(newLB) < 1.0e9) &&
+         (isInf(lb) || newLB > lb + minLBChange)) {
+      lb = newLB;
+      changed++;
+   }
+
+   if (!isInf(newUB) && (exact || fabs(newUB) < 1.0e9) &&
+         (isInf(ub) || newUB < ub - minUBChange)) {
+      ub = newUB;
+      changed++;
+   }
+
+   if (lb > ub + m_feasTol) {
+      return -1;
+   }
+
+   if (lb > ub) {
+      ub = lb;
+   }
+
+   m_nBoundsTightened += changed;
+   return changed ? 1 : 0;
+}
+
+//===========================================================================//
+int DecompPresolve::presolveRows()
+{
+   const int*    ind      = m_rowM.getIndices();
+   const double* els      = m_rowM.getElements();
+   int           nChanges = 0;
+
+   for (int r = 0; r < m_nRowsOrig; r++) {
+      if (m_rowDel[r]) {
+         continue;
+      }
+
+      double       minAct, maxAct;
+      int          minInf, maxInf, nLive;
+      const double L    = m_rowLB[r];
+      const double U    = m_rowUB[r];
+      const bool   hasL = !isInf(L);
+      const bool   hasU = !isInf(U);
+      rowActivity(r, minAct, maxAct, minInf, maxInf, nLive);
+
+      if ((hasL && !maxInf && maxAct < L - m_feasTol * CoinMax(1.0, fabs(L))) ||
+            (hasU && !minInf && minAct > U + m_feasTol * CoinMax(1.0, fabs(U)))) {
+         UTIL_MSG(m_logLevel, 2,
+                  (*m_osLog) << "Presolve: row " << r
+                  << " cannot be satisfied." << endl;);
+         return -1;
+      }
+
+      const CoinBigIndex beg = m_rowM.getVectorFirst(r);
+      const CoinBigIndex end = m_rowM.getVectorLast(r);
+
+      if (nLive == 0) {
+         m_rowDel[r] = 1;
+         m_nRowsEmpty++;
+         nChanges++;
+         continue;
+      }
+
+      if (nLive == 1) {
+         //---
+         //--- L <= a x_j <= U is a bound on x_j
+         //---
+         for (CoinBigIndex k = beg; k < end; k++) {
+            const int    j = ind[k];
+            const double a = els[k];
+
+            if (m_colDel[j] || a == 0.0) {
+               continue;
+            }
+
+            double lo = -m_infinity;
+            double hi =  m_infinity;
+
+            if (a > 0) {
+               lo = hasL ? L / a : lo;
+               hi = hasU ? U / a : hi;
+            } else {
+               lo = hasU ? U / a : lo;
+               hi = hasL ? L / a : hi;
+            }
+
+            if (tightenBounds(j, lo, hi, true) < 0) {
+               return -1;
+            }
+
+            break;
+         }
+
+         m_rowDel[r] = 1;
+         m_nRowsSingleton++;
+         nChanges++;
+         continue;
+      }
+
+      if ((!hasL || (!minInf && minAct >= L - m_feasTol)) &&
+            (!hasU || (!maxInf && maxAct <= U + m_feasTol))) {
+         m_rowDel[r] = 1;
+         m_nRowsRedundant++;
+         nChanges++;
+         continue;
+      }
+
+      //---
+      //--- bounds implied by the row: a_j x_j <= U - (min of the rest),
+      //---   a_j x_j >= L - (max of the rest); the activities are not
+      //---   updated as bounds change, which only makes them weaker
+      //---
+      if ((!hasU || minInf > 1) && (!hasL || maxInf > 1)) {
+         continue;
+      }
+
+      for (CoinBigIndex k = beg; k < end; k++) {
+         const int    j = ind[k];
+         const double a = els[k];
+
+         if (m_colDel[j] || a == 0.0) {
+            continue;
+         }
+
+         const double lo    = a > 0 ? m_colLB[j] : m_colUB[j];
+         const double hi    = a > 0 ? m_colUB[j] : m_colLB[j];
+         bool         hasMin = false;
+         bool         hasMax = false;
+         double       restMin = 0.0;
+         double       restMax = 0.0;
+
+         if (!minInf) {
+            hasMin  = true;
+            restMin = minAct - a * lo;
+         } else if (minInf == 1 && isInf(lo)) {
+            hasMin  = true;
+            restMin = minAct;
+         }
+
+         if (!maxInf) {
+            hasMax  = true;
+            restMax = maxAct - a * hi;
+         } else if (maxInf == 1 && isInf(hi)) {
+            hasMax  = true;
+            restMax = maxAct;
+         }
+
+         double newLB = -m_infinity;
+         double newUB =  m_infinity;
+
+         if (hasU && hasMin) {
+            (a > 0 ? newUB : newLB) = (U - restMin) / a;
+         }
+
+         if (hasL && hasMax) {
+            (a > 0 ? newLB : newUB) = (L - restMax) / a;
+         }
+
+         const int status = tightenBounds(j, newLB, newUB, false);
+
+         if (status < 0) {
+            return -1;
+         }
+
+         nChanges += status;
+      }
+   }
+
+   return nChanges;
+}
+
+//===========================================================================//
+int DecompPresolve::removeFixedCols()
+{
+   const int*    ind      = m_colM.getIndices();
+   const double* els      = m_colM.getElements();
+   int           nChanges = 0;
+
+   for (int j = 0; j < m_nColsOrig; j++) {
+      if (m_colDel[j]) {
+         continue;
+      }
+
+      const double       lb  = m_colLB[j];
+      const double       ub  = m_colUB[j];
+      const CoinBigIndex beg = m_colM.getVectorFirst(j);
+      const CoinBigIndex end = m_colM.getVectorLast(j);
+      double             value;
+
+      if (!isInf(lb) && !isInf(ub) && ub - lb <= m_feasTol) {
+         value = m_isInt[j] ? floor(lb + 0.5) : lb;
+      } else {
+         //---
+         //--- a column in no row is fixed at its best bound
+         //---
+         bool empty = true;
+
+         for (CoinBigIndex k = beg; k < end && empty; k++) {
+            empty = m_rowDel[ind[k]] || els[k] == 0.0;
+         }
+
+         if (!empty) {
+            continue;
+         }
+
+         const double cost = m_objSense * m_obj[j];
+
+         if (cost > 0) {
+            value = lb;
+         } else if (cost < 0) {
+            value = ub;
+         } else {
+            value = !isInf(lb) ? lb : (!isInf(ub) ? ub : 0.0);
+         }
+
+         if (isInf(value)) {
+            //unbounded, leave it to the solver
+            continue;
+         }
+      }
+
+      for (CoinBigIndex k = beg; k < end; k++) {
+         const int r = ind[k];
+
+         if (m_rowDel[r]) {
+            continue;
+         }
+
+         if (!isInf(m_rowLB[r])) {
+            m_rowLB[r] -= els[k] * value;
+         }
+
+         if (!isInf(m_rowUB[r])) {
+            m_rowUB[r] -= els[k] * value;
+         }
+      }
+
+      m_objOffset  += m_obj[j] * value;
+      m_colFixed[j] = value;
+      m_colDel[j]   = 1;
+      m_nColsFixed++;
+      nChanges++;
+   }
+
+   return nChanges;
+}
+
+//===========================================================================//
+void DecompPresolve::setCoef(const int          r,
+                             const CoinBigIndex k,
+                             const double       value)
+{
+   const int j = m_rowM.getIndices()[k];
+   m_rowM.getMutableElements()[k] = value;
+   //---
+   //--- and the same element of the column copy
+   //---
+   const int*         ind = m_colM.getIndices();
+   const CoinBigIndex end = m_colM.getVectorLast(j);
+
+   for (CoinBigIndex kc = m_colM.getVectorFirst(j); kc < end; kc++) {
+      if (ind[kc] == r) {
+         m_colM.getMutableElements()[kc] = value;
+         break;
+      }
+   }
+}
+
+//===========================================================================//
+int DecompPresolve::tightenCoefs()
+{
+   const int*    ind      = m_rowM.getIndices();
+   const double* els      = m_rowM.getElements();
+   int           nChanges = 0;
+
+   for (int r = 0; r < m_nRowsOrig; r++) {
+      const bool hasL = !isInf(m_rowLB[r]);
+      const bool hasU = !isInf(m_rowUB[r]);
+
+      if (m_rowDel[r] || hasL == hasU) {
+         continue;
+      }
+
+      //---
+      //--- work on s a x <= rhs, s = -1 for a >= row
+      //---
+      double     minAct, maxAct;
+      int        minInf, maxInf, nLive;
+      const int  s = hasU ? 1 : -1;
+      rowActivity(r, minAct, maxAct, minInf, maxInf, nLive);
+      double     rhs  = hasU ? m_rowUB[r] : -m_rowLB[r];
+      double     maxA = hasU ? maxAct : -minAct;
+
+      if ((hasU ? maxInf : minInf) || maxA <= rhs + m_feasTol) {
+         continue;
+      }
+
+      const CoinBigIndex end = m_rowM.getVectorLast(r);
+
+      for (CoinBigIndex k = m_rowM.getVectorFirst(r); k < end; k++) {
+         const int    j  = ind[k];
+         const double sa = s * els[k];
+
+         if (m_colDel[j] || sa == 0.0 || !isBinary(j)) {
+            continue;
+         }
+
+         //---
+         //--- if the row is always satisfied for one value of the binary,
+         //---   the coefficient can move toward zero by the slack d
+         //---
+         if (sa > 0 && maxA - sa < rhs - m_feasTol) {
+            const double d = rhs - (maxA - sa);
+            rhs  -= d;
+            maxA -= d;
+            setCoef(r, k, s * (sa - d));
+         } else if (sa < 0 && maxA + sa < rhs - m_feasTol) {
+            const double d = rhs - (maxA + sa);
+            setCoef(r, k, s * (sa + d));
+         } else {
+            continue;
+         }
+
+         m_nCoefsTightened++;
+         nChanges++;
+      }
+
+      if (hasU) {
+         m_rowUB[r] = rhs;
+      } else {
+         m_rowLB[r] = -rhs;
+      }
+   }
+
+   return nChanges;
+}
+
+//===========================================================================//
+int DecompPresolve::removeDuplicateRows()
+{
+   //---
+   //--- rows scaled so that their first element is 1, bucketed by hash
+   //---
+   const int*                     ind = m_rowM.getIndices();
+   const double*                  els = m_rowM.getElements();
+   vector< vector<int> >          rowInd(m_nRowsOrig);
+   vector< vector<double> >       rowEls(m_nRowsOrig);
+   vector<double>                 rowScale(m_nRowsOrig, 1.0);
+   map<string, vector<int> >           buckets;
+   map<string, vector<int> >::iterator bit;
+   int                            nChanges = 0;
+
+   for (int r = 0; r < m_nRowsOrig; r++) {
+      if (m_rowDel[r]) {
+         continue;
+      }
+
+      vector< pair<int, double> > row;
+      const CoinBigIndex end = m_rowM.getVectorLast(r);
+
+      for (CoinBigIndex k = m_rowM.getVectorFirst(r); k < end; k++) {
+         if (!m_colDel[ind[k]] && els[k] != 0.0) {
+            row.push_back(make_pair(ind[k], els[k]));
+         }
+      }
+
+      if (row.empty()) {
+         continue;
+      }
+
+      sort(row.begin(), row.end());
+      rowScale[r] = 1.0 / row[0].second;
+
+      for (size_t k = 0; k < row.size(); k++) {
+         rowInd[r].push_back(row[k].first);
+         rowEls[r].push_back(row[k].second * rowScale[r]);
+      }
+
+      buckets[UtilCreateStringHash(static_cast<int>(row.size()),
+                                   &rowInd[r][0], &rowEls[r][0], 10)]
+         .push_back(r);
+   }
+
+   for (bit = buckets.begin(); bit != buckets.end(); bit++) {
+      vector<int>& rows = bit->second;
+      vector<int>  kept;
+
+      for (size_t i = 0; i < rows.size(); i++) {
+         int r = rows[i];
+
+         for (size_t q = 0; q < kept.size(); q++) {
+            int t = kept[q];
+
+            if (rowInd[t] != rowInd[r]) {
+               continue;
+            }
+
+            bool same = true;
+
+            for (size_t k = 0; k < rowEls[t].size() && same; k++) {
+               same = fabs(rowEls[t][k] - rowEls[r][k]) <=
+                      1.0e-9 * CoinMax(1.0, fabs(rowEls[t][k]));
+            }
+
+            //---
+            //--- a core row may go into a block row, not the other way
+            //---
+            if (!same || (m_rowBlock[t] != m_rowBlock[r] &&
+                          m_rowBlock[t] != -1 && m_rowBlock[r] != -1)) {
+               continue;
+            }
+
+            int o = r;
+
+            if (m_rowBlock[t] == -1 && m_rowBlock[r] != -1) {
+               o = t;
+               t = r;
+               kept[q] = t;
+            }
+
+            //---
+            //--- row o is lambda times row t, move its bounds to t
+            //---
+            const double lambda = rowScale[o] / rowScale[t];
+            double       lo     = m_rowLB[o];
+            double       hi     = m_rowUB[o];
+            lo = isInf(lo) ? -m_infinity : lambda * lo;
+            hi = isInf(hi) ?  m_infinity : lambda * hi;
+
+            if (lambda < 0) {
+               swap(lo, hi);
+               lo = isInf(lo) ? -m_infinity : lo;
+               hi = isInf(hi) ?  m_infinity : hi;
+            }
+
+            m_rowLB[t] = CoinMax(m_rowLB[t], lo);
+            m_rowUB[t] = CoinMin(m_rowUB[t], hi);
+
+            if (m_rowLB[t] > m_rowUB[t] +
+                  m_feasTol * CoinMax(1.0, fabs(m_rowUB[t]))) {
+               return -1;
+            }
+
+            m_rowDel[o] = 1;
+            m_nRowsDuplicate++;
+            nChanges++;
+            r = -1;
+            break;
+         }
+
+         if (r >= 0) {
+            kept.push_back(r);
+         }
+      }
+   }
+
+   return nChanges;
+}
+
+//===========================================================================//
+int DecompPresolve::removeDuplicateCols()
+{
+   const int*                ind = m_rowM.getIndices();
+   const double*             els = m_rowM.getElements();
+   vector< vector<int> >     colInd(m_nColsOrig);
+   vector< vector<double> >  colEls(m_nColsOrig);
+   map<string, vector<int> >           buckets;
+   map<string, vector<int> >::iterator bit;
+   int                       nChanges = 0;
+
+   //---
+   //--- the live columns, their rows in increasing order
+   //---
+   for (int r = 0; r < m_nRowsOrig; r++) {
+      if (m_rowDel[r]) {
+         continue;
+      }
+
+      const CoinBigIndex end = m_rowM.getVectorLast(r);
+
+      for (CoinBigIndex k = m_rowM.getVectorFirst(r); k < end; k++) {
+         if (!m_colDel[ind[k]] && els[k] != 0.0) {
+            colInd[ind[k]].push_back(r);
+            colEls[ind[k]].push_back(els[k]);
+         }
+      }
+   }
+
+   for (int j = 0; j < m_nColsOrig; j++) {
+      if (m_colDel[j] || colInd[j].empty()) {
+         continue;
+      }
+
+      string key = UtilDblToStr(m_obj[j], 12) + (m_isInt[j] ? "I" : "C")
+                   + UtilCreateStringHash(static_cast<int>(colInd[j].size()),
+                                          &colInd[j][0], &colEls[j][0], 12);
+      buckets[key].push_back(j);
+   }
+
+   for (bit = buckets.begin(); bit != buckets.end(); bit++) {
+      vector<int>& cols = bit->second;
+
+      for (size_t a = 0; a < cols.size(); a++) {
+         const int j = cols[a];
+
+         if (m_colDel[j]) {
+            continue;
+         }
+
+         for (size_t b = a + 1; b < cols.size(); b++) {
+            const int k = cols[b];
+
+            if (m_colDel[k] || m_obj[j] != m_obj[k] ||
+                  m_isInt[j] != m_isInt[k] ||
+                  colInd[j] != colInd[k] || colEls[j] != colEls[k]) {
+               continue;
+            }
+
+            //---
+            //--- x_j + x_k becomes x_j, split again by postsolve
+            //---
+            MergedCol merged;
+            merged.keep      = j;
+            merged.removed   = k;
+            merged.keepLB    = m_colLB[j];
+            merged.keepUB    = m_colUB[j];
+            merged.removedLB = m_colLB[k];
+            merged.removedUB = m_colUB[k];
+            m_merged.push_back(merged);
+            m_colLB[j] = isInf(m_colLB[j]) || isInf(m_colLB[k]) ?
+                         -m_infinity : m_colLB[j] + m_colLB[k];
+            m_colUB[j] = isInf(m_colUB[j]) || isInf(m_colUB[k]) ?
+                         m_infinity : m_colUB[j] + m_colUB[k];
+            m_colDel[k] = 1;
+            m_nColsDuplicate++;
+            nChanges++;
+         }
+      }
+   }
+
+   return nChanges;
+}
+
+//===========================================================================//
+void DecompPresolve::buildReduced()
+{
+   vector<int> colNew(m_nColsOrig, -1);
+   m_rowNew.assign(m_nRowsOrig, -1);
+   m_rowsKept.clear();
+   m_colsKept.clear();
+
+   for (int r = 0; r < m_nRowsOrig; r++) {
+      if (!m_rowDel[r]) {
+         m_rowNew[r] = static_cast<int>(m_rowsKept.size());
+         m_rowsKept.push_back(r);
+      }
+   }
+
+   for (int j = 0; j < m_nColsOrig; j++) {
+      if (!m_colDel[j]) {
+         colNew[j] = static_cast<int>(m_colsKept.size());
+         m_colsKept.push_back(j);
+      }
+   }
+
+   const int*           ind = m_rowM.getIndices();
+   const double*        els = m_rowM.getElements();
+   const int            nRows = getNumRows();
+   vector<CoinBigIndex> start(nRows + 1, 0);
+   vector<int>          len(nRows, 0);
+   vector<int>          newInd;
+   vector<double>       newEls;
+
+   for (int i = 0; i < nRows; i++) {
+      const int          r   = m_rowsKept[i];
+      const CoinBigIndex end = m_rowM.getVectorLast(r);
+      start[i] = static_cast<CoinBigIndex>(newInd.size());
+
+      for (CoinBigIndex k = m_rowM.getVectorFirst(r); k < end; k++) {
+         if (colNew[ind[k]] >= 0 && els[k] != 0.0) {
+            newInd.push_back(colNew[ind[k]]);
+            newEls.push_back(els[k]);
+         }
+      }
+
+      len[i] = static_cast<int>(newInd.size() - start[i]);
+   }
+
+   const CoinBigIndex nElem = static_cast<CoinBigIndex>(newInd.size());
+   start[nRows] = nElem;
+   m_matrix = CoinPackedMatrix(false, getNumCols(), nRows, nElem,
+                               nElem ? &newEls[0] : 0,
+                               nElem ? &newInd[0] : 0,
+                               &start[0],
+                               nRows ? &len[0] : 0);
+}
+
+//===========================================================================//
+void DecompPresolve::getColumnData(vector<double>& colLB,
+                                   vector<double>& colUB,
+                                   vector<double>& obj,
+                                   vector<char>&   integerVars) const
+{
+   colLB.clear();
+   colUB.clear();
+   obj.clear();
+   integerVars.clear();
+
+   for (size_t i = 0; i < m_colsKept.size(); i++) {
+      const int j = m_colsKept[i];
+      colLB.push_back(m_colLB[j]);
+      colUB.push_back(m_colUB[j]);
+      obj.push_back(m_obj[j]);
+      integerVars.push_back(m_isInt[j]);
+   }
+}
+
+//===========================================================================//
+void DecompPresolve::getRowData(vector<double>& rowLB,
+                                vector<double>& rowUB) const
+{
+   rowLB.clear();
+   rowUB.clear();
+
+   for (size_t i = 0; i < m_rowsKept.size(); i++) {
+      rowLB.push_back(m_rowLB[m_rowsKept[i]]);
+      rowUB.push_back(m_rowUB[m_rowsKept[i]]);
+   }
+}
+
+//===========================================================================//
+void DecompPresolve::postsolve(const double*   x,
+                               vector<double>& xOrig) const
+{
+   xOrig = m_colFixed;
+
+   for (size_t i = 0; i < m_colsKept.size(); i++) {
+      xOrig[m_colsKept[i]] = x[i];
+   }
+
+   //---
+   //--- split the merged columns, last merge first: the kept column
+   //---   takes what the removed one (at a bound) leaves
+   //---
+   for (int m = static_cast<int>(m_merged.size()) - 1; m >= 0; m--) {
+      const MergedCol& merged = m_merged[m];
+      const double     value  = xOrig[merged.keep];
+      double           ref    = 0.0;
+
+      if (!isInf(merged.removedLB)) {
+         ref = merged.removedLB;
+      } else if (!isInf(merged.removedUB)) {
+         ref = merged.removedUB;
+      }
+
+      double keep = value - ref;
+
+      if (!isInf(merged.keepLB)) {
+         keep = CoinMax(keep, merged.keepLB);
+      }
+
+      if (!isInf(merged.keepUB)) {
+         keep = CoinMin(keep, merged.keepUB);
+      }
+
+      xOrig[merged.keep]    = keep;
+      xOrig[merged.removed] = value - keep;
+   }
+}
+
+//===========================================================================//
+void DecompPresolve::printStats() const
+{
+   (*m_osLog)
+         << "Presolve: rows " << m_nRowsOrig << " -> " << getNumRows()
+         << ", columns " << m_nColsOrig << " -> " << getNumCols()
+         << ", elements " << m_matrix.getNumElements() << endl
+         << "  rows removed: " << m_nRowsEmpty << " empty, "
+         << m_nRowsSingleton << " singleton, "
+         << m_nRowsRedundant << " redundant, "
+         << m_nRowsDuplicate << " duplicate" << endl
+         << "  columns removed: " << m_nColsFixed << " fixed, "
+         << m_nColsDuplicate << " duplicate" << endl
+         << "  bounds tightened: " << m_nBoundsTightened
+         << ", coefficients tightened: " << m_nCoefsTightened
+         << ", objective offset: " << UtilDblToStr(m_objOffset) << endl;
+}
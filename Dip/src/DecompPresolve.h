@@ -0,0 +1,223 @@
+//===========================================================================//
+// This file is part of the DIP Solver Framework.                            //
+//                                                                           //
+// DIP is distributed under the Eclipse Public License as part of the        //
+// COIN-OR repository (http://www.coin-or.org).                              //
+//                                                                           //
+// Authors: Matthew Galati, SAS Institute Inc. (matthew.galati@sas.com)      //
+//          Ted Ralphs, Lehigh University (ted@lehigh.edu)                   //
+//          Jiadong Wang, Lehigh University (jiw408@lehigh.edu)              //
+//                                                                           //
+// Copyright (C) 2002-2019, Lehigh University, Matthew Galati, Ted Ralphs    //
+// All Rights Reserved.                                                      //
+//===========================================================================//
+
+//===========================================================================//
+#ifndef DecompPresolve_h_
+#define DecompPresolve_h_
+
+//===========================================================================//
+#include "Decomp.h"
+#include "CoinPackedMatrix.hpp"
+
+//===========================================================================//
+/**
+ * Presolve of a MILP whose rows are split into blocks and a core.
+ *
+ * Every reduction works on one row at a time, or on rows of the same
+ * block, so the block structure is kept (or made smaller, when all the
+ * rows of a block are removed):
+ *  - bound tightening from the row activities (rounded for integers),
+ *  - removal of empty rows, redundant rows and singleton rows (which
+ *    become column bounds),
+ *  - removal of fixed columns (moved to the row bounds and objective
+ *    offset) and of empty columns (fixed at their best bound),
+ *  - coefficient tightening of binary columns in one-sided rows,
+ *  - duplicate rows (in the same block, or a core row that duplicates a
+ *    block row) and duplicate columns (same column, cost and type; they
+ *    are merged into one column with the sum of the bounds).
+ *
+ * postsolve() maps a solution of the reduced model back to the original
+ * columns.
+ */
+//===========================================================================//
+class DecompPresolve {
+
+private:
+   /** A column merged into a duplicate, undone by postsolve. */
+   struct MergedCol {
+      int    keep;
+      int    removed;
+      double keepLB;
+      double keepUB;
+      double removedLB;
+      double removedUB;
+   };
+
+private:
+   std::string           m_classTag;
+   std::ostream*         m_osLog;
+   int                   m_logLevel;
+   double                m_infinity;
+   double                m_infBound;   //|x| >= m_infBound is infinite
+   double                m_feasTol;
+
+   //---
+   //--- the model being reduced (original indices)
+   //---
+   int                   m_nRowsOrig;
+   int                   m_nColsOrig;
+   CoinPackedMatrix      m_rowM;       //row ordered, coefficients updated
+   CoinPackedMatrix      m_colM;       //column ordered, same coefficients
+   std::vector<double>   m_rowLB;
+   std::vector<double>   m_rowUB;
+   std::vector<double>   m_colLB;
+   std::vector<double>   m_colUB;
+   std::vector<double>   m_obj;
+   std::vector<char>     m_isInt;
+   std::vector<int>      m_rowBlock;   //-1 = core
+   std::vector<char>     m_rowDel;
+   std::vector<char>     m_colDel;
+   int                   m_objSense;
+
+   //---
+   //--- postsolve
+   //---
+   std::vector<double>   m_colFixed;   //value of the removed fixed columns
+   std::vector<MergedCol> m_merged;
+   double                m_objOffset;
+
+   //---
+   //--- the reduced model
+   //---
+   std::vector<int>      m_rowsKept;   //reduced -> original
+   std::vector<int>      m_colsKept;
+   std::vector<int>      m_rowNew;     //original -> reduced (-1 = removed)
+   CoinPackedMatrix      m_matrix;     //row ordered
+
+   //---
+   //--- statistics
+   //---
+   int                   m_nBoundsTightened;
+   int                   m_nCoefsTightened;
+   int                   m_nRowsEmpty;
+   int                   m_nRowsSingleton;
+   int                   m_nRowsRedundant;
+   int                   m_nRowsDuplicate;
+   int                   m_nColsFixed;
+   int                   m_nColsDuplicate;
+
+public:
+   /**
+    * Presolve the model. matrix is row or column ordered, rowBlock gives
+    * the block of each row (-1 for the core rows) and objSense is 1 for
+    * minimization, -1 for maximization. Returns false if the model was
+    * found infeasible, in which case the reduced model is not built.
+    */
+   bool presolve(const CoinPackedMatrix& matrix,
+                 const double*           colLB,
+                 const double*           colUB,
+                 const double*           obj,
+                 const char*             integerVars,
+                 const double*           rowLB,
+                 const double*           rowUB,
+                 const std::vector<int>& rowBlock,
+                 const int               objSense,
+                 const int               maxPasses);
+
+   /** Original values from the values of the reduced columns. */
+   void postsolve(const double*        x,
+                  std::vector<double>& xOrig) const;
+
+   /** Print what was removed. */
+   void printStats() const;
+
+   //---
+   //--- the reduced model
+   //---
+   inline int getNumRows() const {
+      return static_cast<int>(m_rowsKept.size());
+   }
+   inline int getNumCols() const {
+      return static_cast<int>(m_colsKept.size());
+   }
+   inline int getNumRowsOrig() const {
+      return m_nRowsOrig;
+   }
+   inline int getNumColsOrig() const {
+      return m_nColsOrig;
+   }
+   inline const CoinPackedMatrix& getMatrix() const {
+      return m_matrix;
+   }
+   /** Reduced row/column -> original row/column. */
+   inline const std::vector<int>& getRowsKept() const {
+      return m_rowsKept;
+   }
+   inline const std::vector<int>& getColsKept() const {
+      return m_colsKept;
+   }
+   /** Original row -> reduced row (-1 if it was removed). */
+   inline int getNewRow(const int r) const {
+      return m_rowNew[r];
+   }
+   /**
+    * Objective (in the sense of the instance) of the removed columns:
+    * obj x = obj' x' + getObjOffset() for a reduced solution x'.
+    */
+   inline double getObjOffset() const {
+      return m_objOffset;
+   }
+
+   /** Bounds, costs and integrality of the reduced model. */
+   void getColumnData(std::vector<double>& colLB,
+                      std::vector<double>& colUB,
+                      std::vector<double>& obj,
+                      std::vector<char>&   integerVars) const;
+   void getRowData(std::vector<double>& rowLB,
+                   std::vector<double>& rowUB) const;
+
+private:
+   inline bool isInf(const double x) const {
+      return fabs(x) >= m_infBound;
+   }
+   inline bool isBinary(const int j) const {
+      return m_isInt[j] && m_colLB[j] == 0.0 && m_colUB[j] == 1.0;
+   }
+
+   /** Min/max activity of a row, counting the infinite terms apart. */
+   void rowActivity(const int r,
+                    double&   minAct,
+                    double&   maxAct,
+                    int&      minInf,
+                    int&      maxInf,
+                    int&      nLive) const;
+
+   /**
+    * Returns 1 if a bound changed, -1 if the bounds cross. Unless exact,
+    * bounds of continuous columns only change by a significant amount.
+    */
+   int  tightenBounds(const int    j,
+                      double       newLB,
+                      double       newUB,
+                      const bool   exact);
+
+   /** One pass over the rows, returns -1 if infeasible, else #changes. */
+   int  presolveRows();
+   int  removeFixedCols();
+   int  tightenCoefs();
+   int  removeDuplicateRows();
+   int  removeDuplicateCols();
+   void setCoef(const int          r,
+                const CoinBigIndex k,
+                const double       value);
+   void buildReduced();
+
+public:
+   DecompPresolve(const double  infinity,
+                  std::ostream* osLog    = &std::cout,
+                  const int     logLevel = 0);
+   ~DecompPresolve() {}
+};
+
+#endif
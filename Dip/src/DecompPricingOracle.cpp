@@ -0,0 +1,978 @@
+//===========================================================================//
+// This file is part of the DIP Solver Framework.                            //
+//                                                                           //
+// DIP is distributed under the Eclipse Public License as part of the        //
+// COIN-OR repository (http://www.coin-or.org).                              //
+//                                                                           //
+// Authors: Matthew Galati, SAS Institute Inc. (matthew.galati@sas.com)      //
+//          Ted Ralphs, Lehigh University (ted@lehigh.edu)                   //
+//          Jiadong Wang, Lehigh University (jiw408@lehigh.edu)              //
+//                                                                           //
+// Copyright (C) 2002-2019, Lehigh University, Matthew Galati, Ted Ralphs    //
+// All Rights Reserved.                                                      //
+//===========================================================================//
+
+//===========================================================================//
+#include "DecompPricingOracle.h"
+#include "DecompNetworkOracle.h"
+#include "UtilMacrosDecomp.h"
+
+using namespace std;
+
+//---
+//--- limits beyond which the oracles give up (and the MIP is solved)
+//---
+static const double OracleTol           = 1.0e-9;
+static const int    KnapsackNodeLimit   = 5000000;
+static const double MCKnapsackDPLimit   = 2.0e7;
+static const int    AssignmentSizeLimit = 1000;
+
+//===========================================================================//
+static bool isChoiceRow(const DecompOracleRow& row,
+                        bool&                  isEq)
+{
+   //---
+   //--- sum{j in S} x[j] <= 1 or = 1
+   //---
+   if (fabs(row.ub - 1.0) > DecompEpsilon) {
+      return false;
+   }
+
+   if (fabs(row.lb - 1.0) <= DecompEpsilon) {
+      isEq = true;
+   } else if (row.lb <= DecompEpsilon) {
+      isEq = false;
+   } else {
+      return false;
+   }
+
+   for (size_t i = 0; i < row.els.size(); i++) {
+      if (fabs(row.els[i] - 1.0) > DecompEpsilon) {
+         return false;
+      }
+   }
+
+   return true;
+}
+
+//===========================================================================//
+static bool isCapacityRow(const DecompOracleRow& row,
+                          const double           infinity)
+{
+   //---
+   //--- a.x <= b, a > 0 (the lower bound is not binding)
+   //---
+   if (row.ub >= infinity || row.lb > DecompEpsilon) {
+      return false;
+   }
+
+   for (size_t i = 0; i < row.els.size(); i++) {
+      if (row.els[i] <= DecompEpsilon) {
+         return false;
+      }
+   }
+
+   return true;
+}
+
+//===========================================================================//
+static bool isIntegral(const double x)
+{
+   return fabs(x - floor(x + 0.5)) <= DecompEpsilon;
+}
+
+//===========================================================================//
+//---
+//--- 0-1 knapsack: max p.x, w.x <= c, x binary (p, w > 0)
+//---
+//--- Depth-first branch and bound of Horowitz-Sahni with the Dantzig
+//--- bound. Unlike KnapsackOptimizeHS (UtilKnapsack.cpp), the profits
+//--- are reduced costs, so the bound is not rounded down. Returns false
+//--- if the node limit is hit.
+//---
+static bool knapsackBranchAndBound(const vector<double>& p,
+                                   const vector<double>& w,
+                                   const double          c,
+                                   vector<char>&         x)
+{
+   const int n = static_cast<int>(p.size());
+   x.assign(n, 0);
+
+   if (n == 0) {
+      return true;
+   }
+
+   //---
+   //--- sort by p/w non-increasing, prefix sums for the bound
+   //---
+   vector< pair<double, int> > ratio(n);
+   int j;
+
+   for (j = 0; j < n; j++) {
+      ratio[j] = make_pair(-p[j] / w[j], j);
+   }
+
+   sort(ratio.begin(), ratio.end());
+   vector<double> ps(n), ws(n);
+   vector<double> pSum(n + 1, 0.0), wSum(n + 1, 0.0);
+
+   for (j = 0; j < n; j++) {
+      ps[j]       = p[ratio[j].second];
+      ws[j]       = w[ratio[j].second];
+      pSum[j + 1] = pSum[j] + ps[j];
+      wSum[j + 1] = wSum[j] + ws[j];
+   }
+
+   vector<char> xs(n, 0), best(n, 0);
+   vector<int>  ones;
+   double       cap     = c;
+   double       val     = 0.0;
+   double       bestVal = 0.0;
+   int          nodes   = 0;
+   j = 0;
+
+   while (true) {
+      if (++nodes > KnapsackNodeLimit) {
+         return false;
+      }
+
+      if (val > bestVal + OracleTol) {
+         bestVal = val;
+         best    = xs;
+      }
+
+      bool prune = j == n;
+
+      if (!prune) {
+         //---
+         //--- Dantzig bound: items j..r-1 fit, fraction of item r
+         //---
+         int r = static_cast<int>(upper_bound(wSum.begin() + j, wSum.end(),
+                                              wSum[j] + cap + OracleTol)
+                                  - wSum.begin()) - 1;
+         double bound = val + pSum[r] - pSum[j];
+
+         if (r < n) {
+            bound += (cap - (wSum[r] - wSum[j])) * ps[r] / ws[r];
+         }
+
+         prune = bound <= bestVal + OracleTol;
+      }
+
+      if (!prune) {
+         if (ws[j] <= cap + OracleTol) {
+            xs[j] = 1;
+            cap  -= ws[j];
+            val  += ps[j];
+            ones.push_back(j);
+         }
+
+         j++;
+         continue;
+      }
+
+      //---
+      //--- backtrack: the last item set to 1 is set to 0
+      //---
+      if (ones.empty()) {
+         break;
+      }
+
+      int k = ones.back();
+      ones.pop_back();
+      xs[k] = 0;
+      cap  += ws[k];
+      val  -= ps[k];
+      j     = k + 1;
+   }
+
+   for (j = 0; j < n; j++) {
+      x[ratio[j].second] = best[j];
+   }
+
+   return true;
+}
+
+//===========================================================================//
+//---
+//--- Hungarian algorithm (shortest augmenting paths with potentials) for
+//--- a square n x n cost matrix a (row-major). Returns the column
+//--- assigned to each row.
+//---
+static void hungarian(const int             n,
+                      const vector<double>& a,
+                      vector<int>&          rowToCol)
+{
+   const double   inf = COIN_DBL_MAX;
+   vector<double> u(n + 1, 0.0), v(n + 1, 0.0), minv(n + 1);
+   vector<int>    p(n + 1, 0), way(n + 1, 0);
+   vector<char>   used(n + 1);
+   int            i, j;
+
+   for (i = 1; i <= n; i++) {
+      p[0]   = i;
+      int j0 = 0;
+      minv.assign(n + 1, inf);
+      used.assign(n + 1, 0);
+
+      do {
+         used[j0]     = 1;
+         int    i0    = p[j0];
+         int    j1    = 0;
+         double delta = inf;
+
+         for (j = 1; j <= n; j++) {
+            if (used[j]) {
+               continue;
+            }
+
+            double cur = a[(i0 - 1) * n + (j - 1)] - u[i0] - v[j];
+
+            if (cur < minv[j]) {
+               minv[j] = cur;
+               way[j]  = j0;
+            }
+
+            if (minv[j] < delta) {
+               delta = minv[j];
+               j1    = j;
+            }
+         }
+
+         for (j = 0; j <= n; j++) {
+            if (used[j]) {
+               u[p[j]] += delta;
+               v[j]    -= delta;
+            } else {
+               minv[j] -= delta;
+            }
+         }
+
+         j0 = j1;
+      } while (p[j0] != 0);
+
+      do {
+         int j1 = way[j0];
+         p[j0]  = p[j1];
+         j0     = j1;
+      } while (j0);
+   }
+
+   rowToCol.assign(n, -1);
+
+   for (j = 1; j <= n; j++) {
+      if (p[j]) {
+         rowToCol[p[j] - 1] = j - 1;
+      }
+   }
+}
+
+//===========================================================================//
+class DecompKnapsackOracle : public DecompPricingOracle {
+public:
+   vector<int>    m_items;  //block positions in the row
+   vector<double> m_weight; //per item
+   double         m_capacity;
+
+public:
+   const char* getName() const {
+      return "knapsack";
+   }
+
+protected:
+   bool solveFixed(const vector<double>& cost,
+                   const vector<int>&    fixed,
+                   vector<char>&         x) const {
+      double         cap = m_capacity;
+      vector<int>    cand;
+      vector<double> p, w;
+
+      for (size_t t = 0; t < m_items.size(); t++) {
+         const int k = m_items[t];
+
+         if (fixed[k] == 1) {
+            x[k] = 1;
+            cap -= m_weight[t];
+         } else if (fixed[k] == -1 && cost[k] < -OracleTol) {
+            cand.push_back(k);
+            p.push_back(-cost[k]);
+            w.push_back(m_weight[t]);
+         }
+      }
+
+      if (cap < -DecompEpsilon) {
+         return false;
+      }
+
+      vector<char> xk;
+
+      if (!knapsackBranchAndBound(p, w, max(cap, 0.0), xk)) {
+         return false;
+      }
+
+      for (size_t t = 0; t < cand.size(); t++) {
+         x[cand[t]] = xk[t];
+      }
+
+      return true;
+   }
+};
+
+//===========================================================================//
+class DecompMCKnapsackOracle : public DecompPricingOracle {
+public:
+   vector< vector<int> > m_groups;   //block positions per choice row
+   vector<char>          m_groupEq;  //= 1 (else <= 1)
+   bool                  m_hasCapacity;
+   vector<double>        m_weight;   //per block position (0 if not in row)
+   vector<int>           m_loose;    //in the capacity row, in no group
+   double                m_capacity;
+
+public:
+   const char* getName() const {
+      return m_hasCapacity ? "multiple-choice knapsack" : "multiple-choice";
+   }
+
+protected:
+   bool solveFixed(const vector<double>& cost,
+                   const vector<int>&    fixed,
+                   vector<char>&         x) const {
+      vector< vector<int> > groups;
+      vector<char>          groupEq;
+      double                cap = m_capacity;
+      size_t                g, t;
+
+      for (g = 0; g < m_groups.size(); g++) {
+         const vector<int>& group = m_groups[g];
+         vector<int>        items;
+         int                nForced = 0;
+
+         for (t = 0; t < group.size(); t++) {
+            if (fixed[group[t]] == 1) {
+               nForced++;
+               items.assign(1, group[t]);
+            }
+         }
+
+         if (nForced > 1) {
+            return false;
+         }
+
+         if (nForced == 1) {
+            groups.push_back(items);
+            groupEq.push_back(1);
+            continue;
+         }
+
+         for (t = 0; t < group.size(); t++) {
+            const int k = group[t];
+
+            //---
+            //--- in a <= 1 group, an item with cost >= 0 never helps
+            //---
+            if (fixed[k] == 0 || (!m_groupEq[g] && cost[k] >= -OracleTol)) {
+               continue;
+            }
+
+            items.push_back(k);
+         }
+
+         if (m_groupEq[g] && items.empty()) {
+            return false;
+         }
+
+         if (!items.empty()) {
+            groups.push_back(items);
+            groupEq.push_back(m_groupEq[g]);
+         }
+      }
+
+      for (t = 0; t < m_loose.size(); t++) {
+         const int k = m_loose[t];
+
+         if (fixed[k] == 1) {
+            x[k] = 1;
+            cap -= m_weight[k];
+         } else if (fixed[k] == -1 && cost[k] < -OracleTol) {
+            groups.push_back(vector<int>(1, k));
+            groupEq.push_back(0);
+         }
+      }
+
+      const int nGroups = static_cast<int>(groups.size());
+
+      if (!m_hasCapacity) {
+         //---
+         //--- no capacity: pick the cheapest item of each group
+         //---
+         for (g = 0; g < groups.size(); g++) {
+            int best = groups[g][0];
+
+            for (t = 1; t < groups[g].size(); t++) {
+               if (cost[groups[g][t]] < cost[best]) {
+                  best = groups[g][t];
+               }
+            }
+
+            x[best] = 1;
+         }
+
+         return true;
+      }
+
+      //---
+      //--- dynamic program over the (integral) capacity
+      //---   best[c] = min cost of the groups so far with weight <= c
+      //---
+      if (cap < -DecompEpsilon) {
+         return false;
+      }
+
+      const int C = static_cast<int>(floor(cap + DecompEpsilon));
+
+      if (static_cast<double>(nGroups) * (C + 1) > MCKnapsackDPLimit) {
+         return false;
+      }
+
+      const double   inf = COIN_DBL_MAX;
+      vector<double> best(C + 1, 0.0), next(C + 1);
+      vector<int>    choice(static_cast<size_t>(nGroups) * (C + 1), -1);
+      int            c;
+
+      for (g = 0; g < groups.size(); g++) {
+         int* choiceG = &choice[g * (C + 1)];
+
+         for (c = 0; c <= C; c++) {
+            next[c] = groupEq[g] ? inf : best[c];
+         }
+
+         for (t = 0; t < groups[g].size(); t++) {
+            const int k  = groups[g][t];
+            const int wk = static_cast<int>(floor(m_weight[k] + 0.5));
+
+            for (c = wk; c <= C; c++) {
+               if (best[c - wk] < inf && best[c - wk] + cost[k] < next[c]) {
+                  next[c]    = best[c - wk] + cost[k];
+                  choiceG[c] = k;
+               }
+            }
+         }
+
+         best.swap(next);
+      }
+
+      if (best[C] >= inf) {
+         return false;
+      }
+
+      c = C;
+
+      for (g = groups.size(); g-- > 0;) {
+         const int k = choice[g * (C + 1) + c];
+
+         if (k >= 0) {
+            x[k] = 1;
+            c   -= static_cast<int>(floor(m_weight[k] + 0.5));
+         }
+      }
+
+      return true;
+   }
+};
+
+//===========================================================================//
+class DecompAssignmentOracle : public DecompPricingOracle {
+public:
+   int                    m_numRows;
+   vector<char>           m_rowEq;   //= 1 (else <= 1)
+   vector<char>           m_rowSide; //0 or 1
+   vector< pair<int, int> > m_colRows; //(side 0 row, side 1 row), -1 if free
+
+public:
+   const char* getName() const {
+      return "assignment";
+   }
+
+protected:
+   bool solveFixed(const vector<double>& cost,
+                   const vector<int>&    fixed,
+                   vector<char>&         x) const {
+      const int    nCols = static_cast<int>(m_colRows.size());
+      vector<char> matched(m_numRows, 0);
+      int          k, r, i, j;
+
+      for (k = 0; k < nCols; k++) {
+         if (m_colRows[k].first < 0 || fixed[k] != 1) {
+            continue;
+         }
+
+         if (matched[m_colRows[k].first] || matched[m_colRows[k].second]) {
+            return false;
+         }
+
+         matched[m_colRows[k].first]  = 1;
+         matched[m_colRows[k].second] = 1;
+         x[k] = 1;
+      }
+
+      //---
+      //--- the open rows of each side
+      //---
+      vector<int> pos(m_numRows, -1), rowsA, rowsB;
+
+      for (r = 0; r < m_numRows; r++) {
+         if (matched[r]) {
+            continue;
+         }
+
+         vector<int>& rows = m_rowSide[r] ? rowsB : rowsA;
+         pos[r] = static_cast<int>(rows.size());
+         rows.push_back(r);
+      }
+
+      const int L = static_cast<int>(rowsA.size());
+      const int R = static_cast<int>(rowsB.size());
+      const int n = L + R;
+
+      if (n == 0) {
+         return true;
+      }
+
+      if (n > AssignmentSizeLimit) {
+         return false;
+      }
+
+      //---
+      //--- square matrix: rows = side A + a dummy for each side B row,
+      //---   cols = side B + a dummy for each side A row; a dummy match
+      //---   leaves the row unassigned (forbidden for = 1 rows)
+      //---
+      double sumAbs = 0.0;
+
+      for (k = 0; k < nCols; k++) {
+         sumAbs += fabs(cost[k]);
+      }
+
+      const double   forbid = 4.0 * (sumAbs + 1.0);
+      vector<double> a(static_cast<size_t>(n) * n, forbid);
+      vector<int>    edge(static_cast<size_t>(L) * max(R, 1), -1);
+
+      for (k = 0; k < nCols; k++) {
+         if (m_colRows[k].first < 0 || fixed[k] != -1) {
+            continue;
+         }
+
+         i = pos[m_colRows[k].first];
+         j = pos[m_colRows[k].second];
+
+         if (matched[m_colRows[k].first] || matched[m_colRows[k].second]) {
+            continue;
+         }
+
+         if (edge[i * R + j] < 0 || cost[k] < a[i * n + j]) {
+            a[i * n + j]    = cost[k];
+            edge[i * R + j] = k;
+         }
+      }
+
+      for (i = 0; i < L; i++) {
+         a[i * n + R + i] = m_rowEq[rowsA[i]] ? forbid : 0.0;
+      }
+
+      for (j = 0; j < R; j++) {
+         a[(L + j) * n + j] = m_rowEq[rowsB[j]] ? forbid : 0.0;
+
+         for (i = 0; i < L; i++) {
+            a[(L + j) * n + R + i] = 0.0;
+         }
+      }
+
+      vector<int> rowToCol;
+      hungarian(n, a, rowToCol);
+
+      for (i = 0; i < n; i++) {
+         j = rowToCol[i];
+
+         if (j < 0 || a[i * n + j] >= forbid) {
+            return false;
+         }
+
+         if (i < L && j < R) {
+            x[edge[i * R + j]] = 1;
+         }
+      }
+
+      return true;
+   }
+};
+
+//===========================================================================//
+DecompPricingOracle* DecompPricingOracle::create(const DecompConstraintSet* model,
+                                                 const char*  integerMark,
+                                                 const double infinity)
+{
+   if (!model || !model->getMatrix() || !integerMark) {
+      return NULL;
+   }
+
+   const vector<int>& activeCols = model->getActiveColumns();
+   const int          nCols      = static_cast<int>(activeCols.size());
+   const int          nColsOrig  = model->getNumColsOrig();
+   const double*      colLB      = model->getColLB();
+   const double*      colUB      = model->getColUB();
+   const bool         isSparse   = model->isSparse();
+
+   if (nCols == 0) {
+      return NULL;
+   }
+
+   //---
+   //--- the structures other than a network need binary columns
+   //---
+   vector<int>    modelIndex(nCols);
+   vector<int>    origToPos(nColsOrig, -1);
+   vector<double> lb(nCols), ub(nCols);
+   vector<char>   isInt(nCols);
+   bool           isBinary = true;
+   int            k, r;
+
+   for (k = 0; k < nCols; k++) {
+      const int j = activeCols[k];
+
+      if (isSparse) {
+         map<int, int>::const_iterator mit = model->getMapOrigToSparse().find(j);
+
+         if (mit == model->getMapOrigToSparse().end()) {
+            return NULL;
+         }
+
+         modelIndex[k] = mit->second;
+      } else {
+         modelIndex[k] = j;
+      }
+
+      lb[k] = colLB[modelIndex[k]];
+      ub[k] = colUB[modelIndex[k]];
+
+      isInt[k] = integerMark[j] == 'I';
+
+      if (!isInt[k] ||
+            lb[k] < -DecompEpsilon || ub[k] > 1.0 + DecompEpsilon) {
+         isBinary = false;
+      }
+
+      origToPos[j] = k;
+   }
+
+   //---
+   //--- the rows in terms of block positions
+   //---
+   const CoinPackedMatrix* M = model->getMatrix();
+   CoinPackedMatrix        MRow;
+
+   if (M->isColOrdered()) {
+      MRow.reverseOrderedCopyOf(*M);
+      M = &MRow;
+   }
+
+   const int                  nRows = M->getNumRows();
+   const double*              rowLB = model->getRowLB();
+   const double*              rowUB = model->getRowUB();
+   vector<DecompOracleRow>    rows;
+   vector<char>               inRow(nCols, 0);
+
+   for (r = 0; r < nRows; r++) {
+      CoinShallowPackedVector row = M->getVector(r);
+      DecompOracleRow         oRow;
+      oRow.lb = rowLB[r];
+      oRow.ub = rowUB[r];
+
+      for (int e = 0; e < row.getNumElements(); e++) {
+         int c = row.getIndices()[e];
+
+         if (isSparse) {
+            map<int, int>::const_iterator mit
+               = model->getMapSparseToOrig().find(c);
+            c = mit == model->getMapSparseToOrig().end() ? -1 : mit->second;
+         }
+
+         //---
+         //--- non-active columns are fixed to 0 in the block model
+         //---
+         if (c < 0 || c >= nColsOrig || origToPos[c] < 0 ||
+               fabs(row.getElements()[e]) <= OracleTol) {
+            continue;
+         }
+
+         oRow.ind.push_back(origToPos[c]);
+         oRow.els.push_back(row.getElements()[e]);
+      }
+
+      if (oRow.ind.empty()) {
+         if (oRow.lb > DecompEpsilon || oRow.ub < -DecompEpsilon) {
+            return NULL;
+         }
+
+         continue;
+      }
+
+      for (size_t t = 0; t < oRow.ind.size(); t++) {
+         inRow[oRow.ind[t]] = 1;
+      }
+
+      rows.push_back(oRow);
+   }
+
+   //---
+   //--- classify the rows
+   //---
+   const int    nORows = static_cast<int>(rows.size());
+   vector<char> isChoice(nORows, 0), isEq(nORows, 0);
+   int          nChoice  = 0;
+   int          capRow   = -1;
+   bool         isOther  = false;
+
+   for (r = 0; r < nORows; r++) {
+      bool eq = false;
+
+      if (isChoiceRow(rows[r], eq)) {
+         isChoice[r] = 1;
+         isEq[r]     = eq;
+         nChoice++;
+      } else if (capRow < 0 && isCapacityRow(rows[r], infinity)) {
+         capRow = r;
+      } else {
+         isOther = true;
+      }
+   }
+
+   DecompPricingOracle* oracle = NULL;
+
+   //---
+   //--- how many choice rows is each column in?
+   //---
+   vector<int> nChoiceOf(nCols, 0);
+
+   for (r = 0; r < nORows; r++) {
+      if (!isChoice[r]) {
+         continue;
+      }
+
+      for (size_t t = 0; t < rows[r].ind.size(); t++) {
+         nChoiceOf[rows[r].ind[t]]++;
+      }
+   }
+
+   bool disjoint = true;
+
+   for (k = 0; k < nCols; k++) {
+      disjoint = disjoint && nChoiceOf[k] <= 1;
+   }
+
+   if (!isBinary || isOther) {
+      //---
+      //--- general rows: only a network is recognized
+      //---
+      oracle = DecompNetworkOracle::create(rows, lb, ub, isInt, infinity);
+   } else if (nChoice == 0 && capRow >= 0) {
+      //---
+      //--- 0-1 knapsack
+      //---
+      DecompKnapsackOracle* kp = new DecompKnapsackOracle();
+      kp->m_items    = rows[capRow].ind;
+      kp->m_weight   = rows[capRow].els;
+      kp->m_capacity = rows[capRow].ub;
+      oracle         = kp;
+   } else if (nChoice > 0 && disjoint) {
+      //---
+      //--- multiple-choice (knapsack), the weights must be integral
+      //---
+      bool ok = true;
+
+      if (capRow >= 0) {
+         ok = isIntegral(rows[capRow].ub);
+
+         for (size_t t = 0; ok && t < rows[capRow].els.size(); t++) {
+            ok = isIntegral(rows[capRow].els[t]);
+         }
+      }
+
+      if (ok) {
+         DecompMCKnapsackOracle* mck = new DecompMCKnapsackOracle();
+         mck->m_hasCapacity = capRow >= 0;
+         mck->m_weight.assign(nCols, 0.0);
+         mck->m_capacity    = capRow >= 0 ? rows[capRow].ub : 0.0;
+
+         for (r = 0; r < nORows; r++) {
+            if (isChoice[r]) {
+               mck->m_groups.push_back(rows[r].ind);
+               mck->m_groupEq.push_back(isEq[r]);
+            }
+         }
+
+         if (capRow >= 0) {
+            for (size_t t = 0; t < rows[capRow].ind.size(); t++) {
+               const int kk = rows[capRow].ind[t];
+               mck->m_weight[kk] = rows[capRow].els[t];
+
+               if (nChoiceOf[kk] == 0) {
+                  mck->m_loose.push_back(kk);
+               }
+            }
+         }
+
+         oracle = mck;
+      }
+   } else if (capRow < 0 && nChoice == nORows && nORows <= AssignmentSizeLimit) {
+      //---
+      //--- assignment: each column in two rows, the rows bipartite
+      //---
+      vector< pair<int, int> > colRows(nCols, make_pair(-1, -1));
+      vector< vector<int> >    adj(nORows);
+      bool                     ok = true;
+
+      for (r = 0; r < nORows; r++) {
+         for (size_t t = 0; t < rows[r].ind.size(); t++) {
+            pair<int, int>& cr = colRows[rows[r].ind[t]];
+
+            if (cr.first < 0) {
+               cr.first = r;
+            } else {
+               cr.second = r;
+            }
+         }
+      }
+
+      for (k = 0; ok && k < nCols; k++) {
+         if (!inRow[k]) {
+            continue;
+         }
+
+         ok = nChoiceOf[k] == 2;
+
+         if (ok) {
+            adj[colRows[k].first].push_back(colRows[k].second);
+            adj[colRows[k].second].push_back(colRows[k].first);
+         }
+      }
+
+      vector<char> side(nORows, -1);
+
+      for (r = 0; ok && r < nORows; r++) {
+         if (side[r] >= 0) {
+            continue;
+         }
+
+         vector<int> stack(1, r);
+         side[r] = 0;
+
+         while (ok && !stack.empty()) {
+            const int s = stack.back();
+            stack.pop_back();
+
+            for (size_t t = 0; t < adj[s].size(); t++) {
+               const int o = adj[s][t];
+
+               if (side[o] < 0) {
+                  side[o] = 1 - side[s];
+                  stack.push_back(o);
+               } else if (side[o] == side[s]) {
+                  ok = false;
+               }
+            }
+         }
+      }
+
+      if (ok) {
+         DecompAssignmentOracle* ap = new DecompAssignmentOracle();
+         ap->m_numRows = nORows;
+         ap->m_rowEq   = isEq;
+         ap->m_rowSide = side;
+
+         for (k = 0; k < nCols; k++) {
+            if (inRow[k] && side[colRows[k].first] == 1) {
+               swap(colRows[k].first, colRows[k].second);
+            }
+         }
+
+         ap->m_colRows = colRows;
+         oracle        = ap;
+      }
+   }
+
+   if (!oracle) {
+      return NULL;
+   }
+
+   oracle->m_cols         = activeCols;
+   oracle->m_modelIndex   = modelIndex;
+   oracle->m_colLB        = lb;
+   oracle->m_colUB        = ub;
+   oracle->m_inRow        = inRow;
+   oracle->m_modelNumCols = model->getNumCols();
+   return oracle;
+}
+
+//===========================================================================//
+bool DecompPricingOracle::solve(const double*       redCostX,
+                                const double*       colLB,
+                                const double*       colUB,
+                                DecompSolverResult* result) const
+{
+   const int      n = static_cast<int>(m_cols.size());
+   vector<double> cost(n);
+   vector<int>    fixed(n, -1);
+   vector<char>   x(n, 0);
+   int            k;
+
+   for (k = 0; k < n; k++) {
+      const int    j  = m_cols[k];
+      const double lb = colLB ? colLB[j] : m_colLB[k];
+      const double ub = colUB ? colUB[j] : m_colUB[k];
+      cost[k] = redCostX[j];
+
+      if (lb > 0.5) {
+         if (ub < 0.5) {
+            return false;
+         }
+
+         fixed[k] = 1;
+      } else if (ub < 0.5) {
+         fixed[k] = 0;
+      }
+
+      if (!m_inRow[k]) {
+         x[k] = fixed[k] == 1 || (fixed[k] == -1 && cost[k] < 0.0);
+      }
+   }
+
+   if (!solveFixed(cost, fixed, x)) {
+      return false;
+   }
+
+   setResult(vector<double>(x.begin(), x.end()), cost, result);
+   return true;
+}
+
+//===========================================================================//
+void DecompPricingOracle::setResult(const vector<double>& x,
+                                    const vector<double>& cost,
+                                    DecompSolverResult*   result) const
+{
+   vector<double> solution(m_modelNumCols, 0.0);
+   double         obj = 0.0;
+
+   for (size_t k = 0; k < x.size(); k++) {
+      solution[m_modelIndex[k]] = x[k];
+      obj += cost[k] * x[k];
+   }
+
+   result->m_solution.clear();
+   result->m_solution.push_back(solution);
+   result->m_nSolutions  = 1;
+   result->m_isOptimal   = true;
+   result->m_isUnbounded = false;
+   result->m_isCutoff    = false;
+   result->m_objLB       = obj;
+   result->m_objUB       = obj;
+}
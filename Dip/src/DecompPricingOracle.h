@@ -0,0 +1,127 @@
+//===========================================================================//
+// This file is part of the DIP Solver Framework.                            //
+//                                                                           //
+// DIP is distributed under the Eclipse Public License as part of the        //
+// COIN-OR repository (http://www.coin-or.org).                              //
+//                                                                           //
+// Authors: Matthew Galati, SAS Institute Inc. (matthew.galati@sas.com)      //
+//          Ted Ralphs, Lehigh University (ted@lehigh.edu)                   //
+//          Jiadong Wang, Lehigh University (jiw408@lehigh.edu)              //
+//                                                                           //
+// Copyright (C) 2002-2019, Lehigh University, Matthew Galati, Ted Ralphs    //
+// All Rights Reserved.                                                      //
+//===========================================================================//
+
+//===========================================================================//
+#ifndef DecompPricingOracle_h_
+#define DecompPricingOracle_h_
+
+//===========================================================================//
+#include "Decomp.h"
+#include "DecompConstraintSet.h"
+#include "DecompSolverResult.h"
+
+//===========================================================================//
+/** A row of a block in terms of block column positions. */
+struct DecompOracleRow {
+   std::vector<int>    ind;
+   std::vector<double> els;
+   double              lb;
+   double              ub;
+};
+
+//===========================================================================//
+/**
+ * Combinatorial pricing oracle for a block with a recognized structure.
+ *
+ * At setup, create() looks at the constraints of a block. If all of its
+ * columns are binary and the rows form one of
+ *   - a 0-1 knapsack (one row a.x <= b, a > 0),
+ *   - a multiple-choice knapsack (disjoint rows sum x <= 1 or = 1, plus
+ *     at most one knapsack row with integral weights),
+ *   - an assignment (every column in exactly two rows sum x <= 1 or = 1,
+ *     the rows forming a bipartite graph),
+ * an oracle for that structure is returned. Columns of the block that
+ * appear in no row are set to 1 iff their reduced cost is negative.
+ *
+ * Otherwise, if the block is a network (node-arc incidence: every column
+ * has at most one +1 and one -1, see DecompNetworkOracle), the columns
+ * may be general (integer) flows and the block is solved as a min-cost
+ * flow on the graph extracted here.
+ *
+ * The oracle solves min{ redCost.x : x in block } exactly. If it cannot
+ * (the bounds conflict, a limit is hit), solve() returns false and the
+ * caller solves the block as a MIP.
+ */
+//===========================================================================//
+class DecompPricingOracle {
+
+protected:
+   /** Original index of each column of the block. */
+   std::vector<int>    m_cols;
+   /** Index of each column of the block in the block model. */
+   std::vector<int>    m_modelIndex;
+   /** Bounds of each column in the block model. */
+   std::vector<double> m_colLB;
+   std::vector<double> m_colUB;
+   /** Is the column in some row of the block? */
+   std::vector<char>   m_inRow;
+   /** Number of columns of the block model (size of a solution). */
+   int                 m_modelNumCols;
+
+public:
+   /**
+    * Recognize the structure of a block model. Returns NULL if the block
+    * has none of the supported structures.
+    */
+   static DecompPricingOracle* create(const DecompConstraintSet* model,
+                                      const char*                integerMark,
+                                      const double               infinity);
+
+   /** Name of the structure (for the log). */
+   virtual const char* getName() const = 0;
+
+   /**
+    * Solve min{ redCostX.x : x in block } with the given column bounds
+    * (original indexing, NULL to use the bounds of the block model). On
+    * success the solution (block model indexing) is stored in result.
+    * The default is for 0-1 blocks and calls solveFixed().
+    */
+   virtual bool solve(const double*       redCostX,
+                      const double*       colLB,
+                      const double*       colUB,
+                      DecompSolverResult* result) const;
+
+protected:
+   /**
+    * Solve over the block columns k with cost[k], where fixed[k] is
+    * -1 (free), 0 or 1. Free columns in no row are already handled.
+    */
+   virtual bool solveFixed(const std::vector<double>& cost,
+                           const std::vector<int>&    fixed,
+                           std::vector<char>&         x) const {
+      return false;
+   }
+
+   /**
+    * Store the solution x (block positions) with reduced cost cost.x
+    * in result.
+    */
+   void setResult(const std::vector<double>& x,
+                  const std::vector<double>& cost,
+                  DecompSolverResult*        result) const;
+
+public:
+   DecompPricingOracle() :
+      m_cols        (),
+      m_modelIndex  (),
+      m_colLB       (),
+      m_colUB       (),
+      m_inRow       (),
+      m_modelNumCols(0) {
+   }
+
+   virtual ~DecompPricingOracle() {}
+};
+
+#endif
@@ -0,0 +1,631 @@
+//===========================================================================//
+// This file is part of the DIP Solver Framework.                            //
+//                                                                           //
+// DIP is distributed under the Eclipse Public License as part of the        //
+// COIN-OR repository (http://www.coin-or.org).                              //
+//                                                                           //
+// Authors: Matthew Galati, SAS Institute Inc. (matthew.galati@sas.com)      //
+//          Ted Ralphs, Lehigh University (ted@lehigh.edu)                   //
+//          Jiadong Wang, Lehigh University (jiw408@lehigh.edu)              //
+//                                                                           //
+// Copyright (C) 2002-2019, Lehigh University, Matthew Galati, Ted Ralphs    //
+// All Rights Reserved.                                                      //
+//===========================================================================//
+
+//===========================================================================//
+#include "DecompRCSPP.h"
+#include "UtilMacrosDecomp.h"
+
+#include <set>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+using namespace std;
+
+static const double LabelTol = 1.0e-9;
+
+//===========================================================================//
+//--- a path found: a forward label, joined over an arc (-1 if the
+//---   forward label is at the sink) with a backward label
+struct RCSPPJoin {
+   double cost;
+   int    f;
+   int    a;
+   int    b;
+   bool operator<(const RCSPPJoin& other) const {
+      return cost < other.cost;
+   }
+};
+
+//===========================================================================//
+static inline bool memHas(const vector<uint64_t>& mem,
+                          const int               node)
+{
+   return (mem[node >> 6] >> (node & 63)) & 1;
+}
+
+//===========================================================================//
+static inline void memAdd(vector<uint64_t>& mem,
+                          const int         node)
+{
+   mem[node >> 6] |= static_cast<uint64_t>(1) << (node & 63);
+}
+
+//===========================================================================//
+DecompRCSPP::DecompRCSPP(const int numNodes,
+                         const int numResources,
+                         const int source,
+                         const int sink) :
+   m_numNodes           (numNodes),
+   m_numRes             (numResources),
+   m_source             (source),
+   m_sink               (sink),
+   m_memWords           ((numNodes + 63) / 64),
+   m_tail               (),
+   m_head               (),
+   m_consume            (),
+   m_arcCost            (),
+   m_resLB              (numNodes * numResources, 0.0),
+   m_resUB              (numNodes * numResources, COIN_DBL_MAX),
+   m_resLBNeg           (numNodes * numResources, -COIN_DBL_MAX),
+   m_resUBNeg           (numNodes * numResources, 0.0),
+   m_ngMask             (numNodes),
+   m_outArcs            (numNodes),
+   m_inArcs             (numNodes),
+   m_bidirectional      (true),
+   m_numBuckets         (100),
+   m_heuristicLabelLimit(5),
+   m_maxLabels          (1000000),
+   m_numThreads         (1)
+{
+   if (numResources < 1 || source == sink ||
+         source < 0 || source >= numNodes || sink < 0 || sink >= numNodes) {
+      throw UtilException("Bad graph or number of resources.",
+                          "DecompRCSPP", "DecompRCSPP");
+   }
+
+   for (int v = 0; v < numNodes; v++) {
+      m_ngMask[v].assign(m_memWords, 0);
+      memAdd(m_ngMask[v], v);
+   }
+}
+
+//===========================================================================//
+int DecompRCSPP::addArc(const int     tail,
+                        const int     head,
+                        const double* consumption)
+{
+   assert(tail >= 0 && tail < m_numNodes);
+   assert(head >= 0 && head < m_numNodes);
+
+   for (int r = 0; r < m_numRes; r++) {
+      if (consumption[r] < 0.0) {
+         throw UtilException("Resource consumption must be nonnegative.",
+                             "addArc", "DecompRCSPP");
+      }
+   }
+
+   const int arc = getNumArcs();
+   m_tail.push_back(tail);
+   m_head.push_back(head);
+   m_consume.insert(m_consume.end(), consumption, consumption + m_numRes);
+   m_arcCost.push_back(0.0);
+
+   //---
+   //--- paths start at the source and end at the sink
+   //---
+   if (head != m_source && tail != m_sink) {
+      m_outArcs[tail].push_back(arc);
+      m_inArcs[head].push_back(arc);
+   }
+
+   return arc;
+}
+
+//===========================================================================//
+void DecompRCSPP::setResourceWindow(const int    node,
+                                    const int    r,
+                                    const double lb,
+                                    const double ub)
+{
+   const int i = node * m_numRes + r;
+   m_resLB[i]    = lb;
+   m_resUB[i]    = ub;
+   m_resLBNeg[i] = -ub;
+   m_resUBNeg[i] = -lb;
+}
+
+//===========================================================================//
+void DecompRCSPP::setNgNeighborhood(const int          node,
+                                    const vector<int>& ngNodes)
+{
+   m_ngMask[node].assign(m_memWords, 0);
+   memAdd(m_ngMask[node], node);
+
+   for (size_t i = 0; i < ngNodes.size(); i++) {
+      memAdd(m_ngMask[node], ngNodes[i]);
+   }
+}
+
+//===========================================================================//
+void DecompRCSPP::setElementary()
+{
+   for (int v = 0; v < m_numNodes; v++) {
+      m_ngMask[v].assign(m_memWords, 0);
+
+      for (int u = 0; u < m_numNodes; u++) {
+         memAdd(m_ngMask[v], u);
+      }
+   }
+}
+
+//===========================================================================//
+int DecompRCSPP::bucketOf(const double key,
+                          const double keyMin,
+                          const double step) const
+{
+   if (step <= 0.0) {
+      return 0;
+   }
+
+   int b = static_cast<int>((key - keyMin) / step);
+   return std::min(std::max(b, 0), m_numBuckets - 1);
+}
+
+//===========================================================================//
+bool DecompRCSPP::isMemSubset(const vector<uint64_t>& a,
+                              const vector<uint64_t>& b) const
+{
+   for (int w = 0; w < m_memWords; w++) {
+      if (a[w] & ~b[w]) {
+         return false;
+      }
+   }
+
+   return true;
+}
+
+//===========================================================================//
+bool DecompRCSPP::dominates(const Label& a,
+                            const Label& b,
+                            const bool   heuristic) const
+{
+   if (a.cost > b.cost + LabelTol) {
+      return false;
+   }
+
+   for (int r = 0; r < m_numRes; r++) {
+      if (a.res[r] > b.res[r] + LabelTol) {
+         return false;
+      }
+   }
+
+   return heuristic || isMemSubset(a.mem, b.mem);
+}
+
+//===========================================================================//
+void DecompRCSPP::extendLabel(const Label&      label,
+                              const Direction&  dir,
+                              vector<Label>&    out) const
+{
+   const vector<int>&    arcs = (*dir.arcs)[label.node];
+   const vector<double>& lb   = *dir.lb;
+   const vector<double>& ub   = *dir.ub;
+
+   for (size_t i = 0; i < arcs.size(); i++) {
+      const int a = arcs[i];
+      const int j = dir.forward ? m_head[a] : m_tail[a];
+
+      if (memHas(label.mem, j)) {
+         continue;
+      }
+
+      Label next;
+      next.node      = j;
+      next.parent    = -1;
+      next.arc       = a;
+      next.deleted   = false;
+      next.processed = false;
+      next.cost      = label.cost + m_arcCost[a];
+      next.res.resize(m_numRes);
+      bool feasible  = true;
+
+      for (int r = 0; feasible && r < m_numRes; r++) {
+         const int    jr  = j * m_numRes + r;
+         const double val = std::max(lb[jr],
+                                     label.res[r] + m_consume[a * m_numRes + r]);
+         next.res[r] = val;
+         feasible    = val <= ub[jr] + LabelTol;
+      }
+
+      if (!feasible) {
+         continue;
+      }
+
+      next.mem.resize(m_memWords);
+
+      for (int w = 0; w < m_memWords; w++) {
+         next.mem[w] = label.mem[w] & m_ngMask[j][w];
+      }
+
+      memAdd(next.mem, j);
+      out.push_back(next);
+   }
+}
+
+//===========================================================================//
+bool DecompRCSPP::runLabeling(const Direction& dir,
+                              const bool       heuristic,
+                              vector<Label>&   pool) const
+{
+   const vector<double>& lb  = *dir.lb;
+   const vector<double>& ub  = *dir.ub;
+   const int             end = dir.forward ? m_sink : m_source;
+   int                   v, b;
+
+   //---
+   //--- buckets of resource 0 between the start value and the largest
+   //---   upper bound (one bucket if resource 0 is not bounded)
+   //---
+   const double keyMin = lb[dir.start * m_numRes];
+   double       keyMax = -COIN_DBL_MAX;
+
+   for (v = 0; v < m_numNodes; v++) {
+      keyMax = std::max(keyMax, ub[v * m_numRes]);
+   }
+
+   const int    nBuckets = keyMax < COIN_DBL_MAX / 2 ? m_numBuckets : 1;
+   const double step     = (keyMax - keyMin) / nBuckets;
+   vector< vector< vector<int> > > buckets(m_numNodes,
+                                           vector< vector<int> >(nBuckets));
+   vector<int> nActive(m_numNodes, 0);
+
+   Label start;
+   start.node      = dir.start;
+   start.parent    = -1;
+   start.arc       = -1;
+   start.deleted   = false;
+   start.processed = false;
+   start.cost      = 0.0;
+   start.res.assign(lb.begin() + dir.start * m_numRes,
+                    lb.begin() + (dir.start + 1) * m_numRes);
+   start.mem.assign(m_memWords, 0);
+   memAdd(start.mem, dir.start);
+   pool.clear();
+   pool.push_back(start);
+   buckets[dir.start][0].push_back(0);
+   nActive[dir.start]++;
+
+   for (b = 0; b < nBuckets; b++) {
+      while (true) {
+         //---
+         //--- the labels of this bucket not extended yet
+         //---
+         vector<int> batch;
+
+         for (v = 0; v < m_numNodes; v++) {
+            const vector<int>& bucket = buckets[v][b];
+
+            for (size_t i = 0; i < bucket.size(); i++) {
+               Label& label = pool[bucket[i]];
+
+               if (label.deleted || label.processed) {
+                  continue;
+               }
+
+               label.processed = true;
+               const double key = label.res[0];
+
+               if (label.node != end &&
+                     (dir.strict ? key < dir.limit : key <= dir.limit)) {
+                  batch.push_back(bucket[i]);
+               }
+            }
+         }
+
+         if (batch.empty()) {
+            break;
+         }
+
+         const int nBatch = static_cast<int>(batch.size());
+         vector< vector<Label> > out(nBatch);
+         int i;
+
+#ifdef _OPENMP
+         #pragma omp parallel for schedule(dynamic, 16) num_threads(m_numThreads) if (m_numThreads > 1 && nBatch > 32)
+#endif
+         for (i = 0; i < nBatch; i++) {
+            extendLabel(pool[batch[i]], dir, out[i]);
+         }
+
+         //---
+         //--- insert the new labels, with dominance
+         //---
+         for (i = 0; i < nBatch; i++) {
+            for (size_t k = 0; k < out[i].size(); k++) {
+               Label& cand = out[i][k];
+               cand.parent = batch[i];
+               const int j  = cand.node;
+               const int cb = bucketOf(cand.res[0], keyMin, step);
+               bool      dominated = heuristic &&
+                                     nActive[j] >= m_heuristicLabelLimit;
+               int       bb;
+
+               for (bb = 0; !dominated && bb <= cb; bb++) {
+                  const vector<int>& bucket = buckets[j][bb];
+
+                  for (size_t t = 0; t < bucket.size(); t++) {
+                     const Label& other = pool[bucket[t]];
+
+                     if (!other.deleted && dominates(other, cand, heuristic)) {
+                        dominated = true;
+                        break;
+                     }
+                  }
+               }
+
+               if (dominated) {
+                  continue;
+               }
+
+               for (bb = cb; bb < nBuckets; bb++) {
+                  vector<int>& bucket = buckets[j][bb];
+                  size_t       keep   = 0;
+
+                  for (size_t t = 0; t < bucket.size(); t++) {
+                     Label& other = pool[bucket[t]];
+
+                     if (!other.deleted && dominates(cand, other, heuristic)) {
+                        other.deleted = true;
+                        nActive[j]--;
+                     }
+
+                     if (!other.deleted) {
+                        bucket[keep++] = bucket[t];
+                     }
+                  }
+
+                  bucket.resize(keep);
+               }
+
+               if (static_cast<int>(pool.size()) >= m_maxLabels) {
+                  return false;
+               }
+
+               buckets[j][cb].push_back(static_cast<int>(pool.size()));
+               nActive[j]++;
+               pool.push_back(cand);
+            }
+         }
+      }
+   }
+
+   return true;
+}
+
+//===========================================================================//
+void DecompRCSPP::tracePath(const vector<Label>& pool,
+                            int                  id,
+                            vector<int>&         nodes,
+                            vector<int>&         arcs) const
+{
+   nodes.clear();
+   arcs.clear();
+
+   while (id >= 0) {
+      nodes.push_back(pool[id].node);
+
+      if (pool[id].arc >= 0) {
+         arcs.push_back(pool[id].arc);
+      }
+
+      id = pool[id].parent;
+   }
+}
+
+//===========================================================================//
+bool DecompRCSPP::solve(const bool     heuristic,
+                        const int      maxPaths,
+                        const double   convexDual,
+                        vector<Path>&  paths) const
+{
+   paths.clear();
+   const double maxCost = convexDual - DecompEpsilon;
+   const double ubSink = m_resUB[m_sink * m_numRes];
+   const bool   bidir  = m_bidirectional && ubSink < COIN_DBL_MAX / 2;
+   const double half   = bidir ?
+                         0.5 * (m_resLB[m_source * m_numRes] + ubSink) :
+                         COIN_DBL_MAX;
+   bool         complete = !heuristic;
+   int          a, r;
+
+   //---
+   //--- forward labels up to the middle of resource 0
+   //---
+   Direction fwd;
+   fwd.forward = true;
+   fwd.start   = m_source;
+   fwd.lb      = &m_resLB;
+   fwd.ub      = &m_resUB;
+   fwd.arcs    = &m_outArcs;
+   fwd.limit   = half;
+   fwd.strict  = false;
+   vector<Label> fwdPool;
+
+   if (!runLabeling(fwd, heuristic, fwdPool)) {
+      complete = false;
+   }
+
+   vector<RCSPPJoin> cands;
+   size_t        i;
+
+   for (i = 0; i < fwdPool.size(); i++) {
+      const Label& f = fwdPool[i];
+
+      if (!f.deleted && f.node == m_sink && f.res[0] <= half &&
+            f.cost < maxCost) {
+         RCSPPJoin c = { f.cost, static_cast<int>(i), -1, -1 };
+         cands.push_back(c);
+      }
+   }
+
+   vector<Label> bwdPool;
+
+   if (bidir) {
+      //---
+      //--- backward labels (on negated resources) from the sink down to
+      //---   the middle, then join over the arc where the forward path
+      //---   crosses the middle (so each path is found once)
+      //---
+      Direction bwd;
+      bwd.forward = false;
+      bwd.start   = m_sink;
+      bwd.lb      = &m_resLBNeg;
+      bwd.ub      = &m_resUBNeg;
+      bwd.arcs    = &m_inArcs;
+      bwd.limit   = -half;
+      bwd.strict  = true;
+
+      if (!runLabeling(bwd, heuristic, bwdPool)) {
+         complete = false;
+      }
+
+      vector< vector< pair<double, int> > > bwdAt(m_numNodes);
+
+      for (i = 0; i < bwdPool.size(); i++) {
+         if (!bwdPool[i].deleted) {
+            bwdAt[bwdPool[i].node].push_back(make_pair(bwdPool[i].cost,
+                                                       static_cast<int>(i)));
+         }
+      }
+
+      for (int v = 0; v < m_numNodes; v++) {
+         sort(bwdAt[v].begin(), bwdAt[v].end());
+      }
+
+      vector<double> t(m_numRes);
+
+      for (i = 0; i < fwdPool.size(); i++) {
+         const Label& f = fwdPool[i];
+
+         if (f.deleted || f.node == m_sink || f.res[0] > half) {
+            continue;
+         }
+
+         const vector<int>& arcs = m_outArcs[f.node];
+
+         for (size_t k = 0; k < arcs.size(); k++) {
+            a = arcs[k];
+            const int j = m_head[a];
+            bool      ok = !memHas(f.mem, j);
+
+            for (r = 0; ok && r < m_numRes; r++) {
+               const int jr = j * m_numRes + r;
+               t[r] = std::max(m_resLB[jr], f.res[r] + m_consume[a * m_numRes + r]);
+               ok   = t[r] <= m_resUB[jr] + LabelTol;
+            }
+
+            if (!ok || t[0] <= half) {
+               continue;
+            }
+
+            const double base = f.cost + m_arcCost[a];
+
+            for (size_t q = 0; q < bwdAt[j].size(); q++) {
+               if (base + bwdAt[j][q].first >= maxCost) {
+                  break;
+               }
+
+               const Label& bl   = bwdPool[bwdAt[j][q].second];
+               bool         join = true;
+
+               for (r = 0; join && r < m_numRes; r++) {
+                  join = t[r] <= -bl.res[r] + LabelTol;
+               }
+
+               for (int w = 0; join && w < m_memWords; w++) {
+                  join = (f.mem[w] & bl.mem[w]) == 0;
+               }
+
+               if (join) {
+                  RCSPPJoin c = { base + bl.cost, static_cast<int>(i), a,
+                             bwdAt[j][q].second
+                           };
+                  cands.push_back(c);
+               }
+            }
+         }
+      }
+   }
+
+   //---
+   //--- the best distinct paths
+   //---
+   sort(cands.begin(), cands.end());
+   set< vector<int> > seen;
+   vector<int>        nodes, arcs;
+
+   for (i = 0; i < cands.size() &&
+         static_cast<int>(paths.size()) < maxPaths; i++) {
+      const RCSPPJoin& c = cands[i];
+      Path        path;
+      tracePath(fwdPool, c.f, nodes, arcs);
+      path.nodes.assign(nodes.rbegin(), nodes.rend());
+      path.arcs.assign(arcs.rbegin(), arcs.rend());
+
+      if (c.a >= 0) {
+         tracePath(bwdPool, c.b, nodes, arcs);
+         path.arcs.push_back(c.a);
+         path.nodes.insert(path.nodes.end(), nodes.begin(), nodes.end());
+         path.arcs.insert(path.arcs.end(), arcs.begin(), arcs.end());
+      }
+
+      path.cost = c.cost;
+
+      if (seen.insert(path.nodes).second) {
+         paths.push_back(path);
+      }
+   }
+
+   return complete;
+}
+
+//===========================================================================//
+void DecompRCSPP::appendVars(const vector<Path>& paths,
+                             const vector<int>&  arcColumn,
+                             const double*       origCost,
+                             const double        convexDual,
+                             const int           blockId,
+                             DecompVarList&      vars) const
+{
+   for (size_t p = 0; p < paths.size(); p++) {
+      const Path&     path = paths[p];
+      map<int, double> coef;
+
+      for (size_t k = 0; k < path.arcs.size(); k++) {
+         const int col = arcColumn[path.arcs[k]];
+
+         if (col >= 0) {
+            coef[col] += 1.0;
+         }
+      }
+
+      vector<int>    ind;
+      vector<double> els;
+      double         varOrigCost = 0.0;
+      map<int, double>::const_iterator mit;
+
+      for (mit = coef.begin(); mit != coef.end(); mit++) {
+         ind.push_back(mit->first);
+         els.push_back(mit->second);
+         varOrigCost += origCost[mit->first] * mit->second;
+      }
+
+      DecompVar* var = new DecompVar(ind, els, path.cost - convexDual,
+                                     varOrigCost);
+      var->setBlockId(blockId);
+      vars.push_back(var);
+   }
+}
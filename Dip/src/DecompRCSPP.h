@@ -0,0 +1,232 @@
+//===========================================================================//
+// This file is part of the DIP Solver Framework.                            //
+//                                                                           //
+// DIP is distributed under the Eclipse Public License as part of the        //
+// COIN-OR repository (http://www.coin-or.org).                              //
+//                                                                           //
+// Authors: Matthew Galati, SAS Institute Inc. (matthew.galati@sas.com)      //
+//          Ted Ralphs, Lehigh University (ted@lehigh.edu)                   //
+//          Jiadong Wang, Lehigh University (jiw408@lehigh.edu)              //
+//                                                                           //
+// Copyright (C) 2002-2019, Lehigh University, Matthew Galati, Ted Ralphs    //
+// All Rights Reserved.                                                      //
+//===========================================================================//
+
+//===========================================================================//
+#ifndef DecompRCSPP_h_
+#define DecompRCSPP_h_
+
+//===========================================================================//
+#include "Decomp.h"
+#include "DecompVar.h"
+
+#include <stdint.h>
+
+//===========================================================================//
+/**
+ * Resource-constrained shortest path (labeling) pricing, for applications
+ * whose columns are paths (vehicle routes, crew pairings, ...). It is
+ * meant to be called from DecompApp::solveRelaxed.
+ *
+ * The graph (arcs, resource consumption, resource windows) is given once;
+ * before each call the application sets the arc costs to the reduced
+ * costs. A path from the source to the sink is feasible if, for every
+ * resource r, the value at each node v (arrival = max(lb[v], value at
+ * the previous node + consumption of the arc)) is at most ub[v]. The
+ * consumption must be nonnegative.
+ *
+ * Features:
+ *  - bidirectional labeling: forward labels are extended up to the middle
+ *    of resource 0, backward labels from the sink down to it, and the two
+ *    are joined over an arc;
+ *  - dominance (cost, resources, ng-memory) with the labels of each node
+ *    stored in buckets of resource 0, so a new label is only compared to
+ *    the buckets that can dominate it or that it can dominate;
+ *  - ng-route relaxation: a path may not revisit a node still in its
+ *    memory; the memory after visiting j is (memory & N(j)) + j. With
+ *    N(j) = all nodes (setElementary) the paths are elementary. A forward
+ *    and a backward label are joined if their memories are disjoint;
+ *  - heuristic pricing: dominance ignores the memory and each node keeps
+ *    at most a few labels, to find improving paths quickly;
+ *  - the labels of a bucket are extended in parallel (OpenMP).
+ *
+ * solve() returns up to maxPaths distinct paths of negative reduced cost,
+ * that is, of cost below the dual of the convexity constraint.
+ */
+//===========================================================================//
+class DecompRCSPP {
+
+public:
+   /** A source-sink path. */
+   struct Path {
+      std::vector<int> nodes;
+      std::vector<int> arcs;
+      double           cost;
+   };
+
+private:
+   /** A (forward or backward) label. */
+   struct Label {
+      int                   node;
+      int                   parent;
+      int                   arc;
+      bool                  deleted;
+      bool                  processed;
+      double                cost;
+      std::vector<double>   res;
+      std::vector<uint64_t> mem;
+   };
+
+   /** A search direction (the backward one works on negated resources). */
+   struct Direction {
+      bool                             forward;
+      int                              start;
+      const std::vector<double>*       lb;
+      const std::vector<double>*       ub;
+      const std::vector< std::vector<int> >* arcs;
+      double                           limit;
+      bool                             strict;
+   };
+
+private:
+   int                               m_numNodes;
+   int                               m_numRes;
+   int                               m_source;
+   int                               m_sink;
+   int                               m_memWords;
+
+   std::vector<int>                  m_tail;
+   std::vector<int>                  m_head;
+   std::vector<double>               m_consume;  //arc * m_numRes
+   std::vector<double>               m_arcCost;
+
+   /** Windows, node * m_numRes, and the negated ones for backward. */
+   std::vector<double>               m_resLB;
+   std::vector<double>               m_resUB;
+   std::vector<double>               m_resLBNeg;
+   std::vector<double>               m_resUBNeg;
+
+   /** ng-neighborhood of each node (a bit set over the nodes). */
+   std::vector< std::vector<uint64_t> > m_ngMask;
+
+   std::vector< std::vector<int> >   m_outArcs;
+   std::vector< std::vector<int> >   m_inArcs;
+
+   //---
+   //--- settings
+   //---
+   bool                              m_bidirectional;
+   int                               m_numBuckets;
+   int                               m_heuristicLabelLimit;
+   int                               m_maxLabels;
+   int                               m_numThreads;
+
+private:
+   int bucketOf(const double key, const double keyMin,
+                const double step) const;
+   bool isMemSubset(const std::vector<uint64_t>& a,
+                    const std::vector<uint64_t>& b) const;
+   bool dominates(const Label& a,
+                  const Label& b,
+                  const bool   heuristic) const;
+   void extendLabel(const Label&       label,
+                    const Direction&   dir,
+                    std::vector<Label>& out) const;
+   bool runLabeling(const Direction&    dir,
+                    const bool          heuristic,
+                    std::vector<Label>& pool) const;
+   void tracePath(const std::vector<Label>& pool,
+                  int                       id,
+                  std::vector<int>&         nodes,
+                  std::vector<int>&         arcs) const;
+
+public:
+   /** Add an arc with the consumption of each resource, returns its index. */
+   int addArc(const int     tail,
+              const int     head,
+              const double* consumption);
+
+   /** Window of resource r at a node (default [0, infinity)). */
+   void setResourceWindow(const int    node,
+                          const int    r,
+                          const double lb,
+                          const double ub);
+
+   /** ng-neighborhood of a node (the node itself is always in it). */
+   void setNgNeighborhood(const int               node,
+                          const std::vector<int>& ngNodes);
+
+   /** Make all paths elementary (every neighborhood is all nodes). */
+   void setElementary();
+
+   /** Arc costs (reduced costs), size getNumArcs(). */
+   void setArcCost(const double* cost) {
+      m_arcCost.assign(cost, cost + getNumArcs());
+   }
+   void setArcCost(const int    arc,
+                   const double cost) {
+      m_arcCost[arc] = cost;
+   }
+
+   inline void setBidirectional(const bool bidirectional) {
+      m_bidirectional = bidirectional;
+   }
+   inline void setNumBuckets(const int numBuckets) {
+      m_numBuckets = std::max(numBuckets, 1);
+   }
+   inline void setHeuristicLabelLimit(const int limit) {
+      m_heuristicLabelLimit = std::max(limit, 1);
+   }
+   inline void setMaxLabels(const int maxLabels) {
+      m_maxLabels = maxLabels;
+   }
+   inline void setNumThreads(const int numThreads) {
+      m_numThreads = std::max(numThreads, 1);
+   }
+
+   inline int getNumArcs() const {
+      return static_cast<int>(m_tail.size());
+   }
+   inline int getTail(const int arc) const {
+      return m_tail[arc];
+   }
+   inline int getHead(const int arc) const {
+      return m_head[arc];
+   }
+   inline double getArcCost(const int arc) const {
+      return m_arcCost[arc];
+   }
+
+   /**
+    * Find up to maxPaths distinct paths with negative reduced cost (path
+    * cost - convexDual), sorted by cost. Returns false if the search was
+    * cut short by the label limit (so, even when no path is found, none
+    * was proven not to exist). A heuristic search is never exact either.
+    */
+   bool solve(const bool         heuristic,
+              const int          maxPaths,
+              const double       convexDual,
+              std::vector<Path>& paths) const;
+
+   /**
+    * Append a DecompVar for each path: arc a adds 1 to the original
+    * column arcColumn[a] (-1 for none). The reduced cost of the variable
+    * is the cost of the path minus convexDual.
+    */
+   void appendVars(const std::vector<Path>& paths,
+                   const std::vector<int>&  arcColumn,
+                   const double*            origCost,
+                   const double             convexDual,
+                   const int                blockId,
+                   DecompVarList&           vars) const;
+
+public:
+   DecompRCSPP(const int numNodes,
+               const int numResources,
+               const int source,
+               const int sink);
+
+   ~DecompRCSPP() {}
+};
+
+#endif
@@ -170,7 +170,65 @@ void DecompStats::printOverallStats (ostream* os)
          << setw(6)  << thisCompressCols.size()
          << setw(6)  << maxCompressCols
          ;
+   (*os) << setw(40) << "\nMaster Iterations     = "
+         << setw(10) << numMasterIters
+         << setw(10) << maxNodeMasterIters;
+   (*os) << setw(40) << "\nDive Nodes            = "
+         << setw(10) << numDiveNodes
+         << setw(10) << numDiveMasterIters;
    (*os) << "\n================ DECOMP Statistics [END  ]: =============== \n";
+
+   if (memCalculated) {
+      printMemoryStats(os);
+   }
+}
+
+// --------------------------------------------------------------------- //
+void DecompStats::printMemoryStats (ostream* os)
+{
+   const double total = memTotal() > 0.0 ? memTotal() : 1.0;
+   const double MB    = 1024.0 * 1024.0;
+   (*os) << setiosflags(ios::fixed | ios::showpoint);
+   (*os).precision(2);
+   (*os) << "\n================ DECOMP Memory (MB) [BEGIN]: ============== ";
+   (*os) << setw(40) << "\nNames                 = "
+         << setw(10) << memNames / MB
+         << setw(10) << 100.0 * memNames / total;
+   (*os) << setw(40) << "\nHashes                = "
+         << setw(10) << memHashes / MB
+         << setw(10) << 100.0 * memHashes / total;
+   (*os) << setw(40) << "\nCore Model            = "
+         << setw(10) << memCoreModel / MB
+         << setw(10) << 100.0 * memCoreModel / total;
+   (*os) << setw(40) << "\nBlock Models          = "
+         << setw(10) << memBlockModels / MB
+         << setw(10) << 100.0 * memBlockModels / total;
+   (*os) << setw(40) << "\nMaster                = "
+         << setw(10) << memMaster / MB
+         << setw(10) << 100.0 * memMaster / total;
+   (*os) << setw(40) << "\nColumns (Master)      = "
+         << setw(10) << memVars / MB
+         << setw(10) << 100.0 * memVars / total;
+   (*os) << setw(40) << "\nColumns (Pool)        = "
+         << setw(10) << memVarPool / MB
+         << setw(10) << 100.0 * memVarPool / total;
+   (*os) << setw(40) << "\nCuts (Master)         = "
+         << setw(10) << memCuts / MB
+         << setw(10) << 100.0 * memCuts / total;
+   (*os) << setw(40) << "\nCuts (Pool)           = "
+         << setw(10) << memCutPool / MB
+         << setw(10) << 100.0 * memCutPool / total;
+   (*os) << setw(40) << "\nScratch Arenas        = "
+         << setw(10) << memScratch / MB
+         << setw(10) << 100.0 * memScratch / total;
+   (*os) << setw(40) << "\nTotal                 = "
+         << setw(10) << total / MB;
+   (*os) << setw(40) << "\nScratch Requests      = "
+         << setw(10) << scratchRequests;
+   (*os) << setw(40) << "\nScratch Allocations   = "
+         << setw(10) << scratchAllocs
+         << setw(10) << scratchBytes / MB;
+   (*os) << "\n================ DECOMP Memory (MB) [END  ]: ============== \n";
 }
 
 
@@ -163,6 +163,11 @@ public:
     */
    int    priceCallsRound;
 
+   /**
+    * Number of master LP iterations in this node.
+    */
+   int    masterIters;
+
    /**
     * Value of infinity
     */
@@ -182,6 +187,7 @@ public:
       priceCallsTotal =  0;
       cutCallsRound   =  0;
       priceCallsRound =  0;
+      masterIters     =  0;
    }
 
 public:
@@ -256,6 +262,57 @@ public:
    double maxGenVars;
    double maxCompressCols;
 
+   /**
+    * Counters for benchmarking (see StatsFile): real time at which the
+    * root node was done (-1 until then) and its bound, the number of
+    * pricing and cutting calls and of columns and cuts generated.
+    */
+   double timeRootBound;
+   double rootBound;
+   int    numPriceCalls;
+   int    numCutCalls;
+   int    numColsGenerated;
+   int    numCutsGenerated;
+
+   /**
+    * Master LP iterations over all nodes and the most at one node, and
+    * the nodes processed right after their parent (dives, see
+    * AlpsDecompModel::startNode) with the master iterations they took.
+    */
+   long long numMasterIters;
+   int       maxNodeMasterIters;
+   int       numDiveNodes;
+   long long numDiveMasterIters;
+
+   /**
+    * Approximate memory (in bytes) used by each part of the solver, see
+    * DecompAlgo::calculateMemoryStats: row and column names (models and
+    * solvers), hashes (rows, columns and cuts), the core model, the block
+    * models and their solvers, the master LP, the columns and cuts in the
+    * master and those waiting in the pools, the scratch arenas (see
+    * DecompMemPool) of all threads.
+    */
+   bool   memCalculated;
+   double memNames;
+   double memHashes;
+   double memCoreModel;
+   double memBlockModels;
+   double memMaster;
+   double memVars;
+   double memVarPool;
+   double memCuts;
+   double memCutPool;
+   double memScratch;
+
+   /**
+    * Use of the scratch arenas (all threads): the number of buffers asked
+    * for and the number and volume (bytes) of the allocations made to get
+    * them. Once the master stops growing, the requests no longer allocate.
+    */
+   long long scratchRequests;
+   long long scratchAllocs;
+   double    scratchBytes;
+
 public:
    std::vector<double> thisDecomp;
    std::vector<double> thisSolveRelax;
@@ -270,6 +327,12 @@ public:
    void calculateStats();
    void printOverallStats (std::ostream* os = &std::cout); //ostream?
    void printDetailedStats(std::ostream* os = &std::cout); //ostream?
+   void printMemoryStats  (std::ostream* os = &std::cout);
+   inline double memTotal() const {
+      return memNames + memHashes + memCoreModel + memBlockModels
+             + memMaster + memVars + memVarPool + memCuts + memCutPool
+             + memScratch;
+   }
 
 public:
    DecompStats() :
@@ -291,7 +354,34 @@ public:
       maxSolUpdate      (0.0),
       maxGenCuts        (0.0),
       maxGenVars        (0.0),
-      maxCompressCols   (0.0)
+      maxCompressCols   (0.0),
+
+      timeRootBound     (-1.0),
+      rootBound         (0.0),
+      numPriceCalls     (0),
+      numCutCalls       (0),
+      numColsGenerated  (0),
+      numCutsGenerated  (0),
+      numMasterIters    (0),
+      maxNodeMasterIters(0),
+      numDiveNodes      (0),
+      numDiveMasterIters(0),
+
+      memCalculated     (false),
+      memNames          (0.0),
+      memHashes         (0.0),
+      memCoreModel      (0.0),
+      memBlockModels    (0.0),
+      memMaster         (0.0),
+      memVars           (0.0),
+      memVarPool        (0.0),
+      memCuts           (0.0),
+      memCutPool        (0.0),
+      memScratch        (0.0),
+
+      scratchRequests   (0),
+      scratchAllocs     (0),
+      scratchBytes      (0.0)
 
    {
    }
@@ -0,0 +1,157 @@
+//===========================================================================//
+// This file is part of the DIP Solver Framework.                            //
+//                                                                           //
+// DIP is distributed under the Eclipse Public License as part of the        //
+// COIN-OR repository (http://www.coin-or.org).                              //
+//                                                                           //
+// Authors: Matthew Galati, SAS Institute Inc. (matthew.galati@sas.com)      //
+//          Ted Ralphs, Lehigh University (ted@lehigh.edu)                   //
+//          Jiadong Wang, Lehigh University (jiw408@lehigh.edu)              //
+//                                                                           //
+// Copyright (C) 2002-2019, Lehigh University, Matthew Galati, Ted Ralphs    //
+// All Rights Reserved.                                                      //
+//===========================================================================//
+
+//===========================================================================//
+#include "DecompTrace.h"
+#include "CoinTime.hpp"
+
+#include <fstream>
+#include <algorithm>
+
+#ifdef _OPENMP
+#include "omp.h"
+#endif
+
+using namespace std;
+
+//===========================================================================//
+static bool eventStartLess(const pair<int, DecompTraceEvent>& a,
+                           const pair<int, DecompTraceEvent>& b)
+{
+   return a.second.start < b.second.start;
+}
+
+//===========================================================================//
+void DecompTrace::init(const int numThreads,
+                       const int capacity)
+{
+   m_rings.clear();
+   m_rings.resize(max(numThreads, 1));
+
+   for (size_t t = 0; t < m_rings.size(); t++) {
+      m_rings[t].events.resize(max(capacity, 1));
+      m_rings[t].numRecorded = 0;
+   }
+
+   m_origin  = CoinGetTimeOfDay();
+   m_enabled = true;
+}
+
+//===========================================================================//
+double DecompTrace::now() const
+{
+   return CoinGetTimeOfDay() - m_origin;
+}
+
+//===========================================================================//
+void DecompTrace::record(const int    type,
+                         const int    node,
+                         const int    block,
+                         const int    value,
+                         const double start)
+{
+   int thread = 0;
+#ifdef _OPENMP
+   thread = omp_get_thread_num();
+#endif
+
+   if (thread >= static_cast<int>(m_rings.size())) {
+      return;
+   }
+
+   Ring&             ring = m_rings[thread];
+   const long long   cap  = static_cast<long long>(ring.events.size());
+   DecompTraceEvent& ev   = ring.events[ring.numRecorded % cap];
+   ev.type  = type;
+   ev.node  = node;
+   ev.block = block;
+   ev.value = value;
+   ev.start = start;
+   ev.end   = now();
+   ring.numRecorded++;
+}
+
+//===========================================================================//
+void DecompTrace::getEvents(vector< pair<int, DecompTraceEvent> >& events) const
+{
+   events.clear();
+
+   for (size_t t = 0; t < m_rings.size(); t++) {
+      const Ring&     ring = m_rings[t];
+      const long long cap  = static_cast<long long>(ring.events.size());
+      const long long n    = min(ring.numRecorded, cap);
+
+      for (long long k = ring.numRecorded - n; k < ring.numRecorded; k++) {
+         events.push_back(make_pair(static_cast<int>(t),
+                                    ring.events[k % cap]));
+      }
+   }
+
+   stable_sort(events.begin(), events.end(), eventStartLess);
+}
+
+//===========================================================================//
+bool DecompTrace::write(const string& fileName,
+                        const bool    chrome) const
+{
+   ofstream os(fileName.c_str());
+
+   if (!os) {
+      return false;
+   }
+
+   vector< pair<int, DecompTraceEvent> > events;
+   getEvents(events);
+   os.precision(12);
+
+   if (chrome) {
+      //---
+      //--- complete events ("ph":"X"), times in microseconds
+      //---
+      os << "{\"traceEvents\":[\n";
+
+      for (size_t i = 0; i < events.size(); i++) {
+         const DecompTraceEvent& ev = events[i].second;
+         os << (i ? ",\n" : "")
+            << "{\"name\":\"" << DecompTraceTypeStr[ev.type];
+
+         if (ev.block >= 0) {
+            os << " " << ev.block;
+         }
+
+         os << "\",\"cat\":\"" << DecompTraceTypeStr[ev.type] << "\""
+            << ",\"ph\":\"X\",\"pid\":0,\"tid\":" << events[i].first
+            << ",\"ts\":"  << 1.0e6 * ev.start
+            << ",\"dur\":" << 1.0e6 * (ev.end - ev.start)
+            << ",\"args\":{\"node\":" << ev.node
+            << ",\"block\":" << ev.block
+            << ",\"value\":" << ev.value << "}}";
+      }
+
+      os << "\n],\"displayTimeUnit\":\"ms\"}\n";
+   } else {
+      for (size_t i = 0; i < events.size(); i++) {
+         const DecompTraceEvent& ev = events[i].second;
+         os << "{\"type\":\"" << DecompTraceTypeStr[ev.type] << "\""
+            << ",\"thread\":" << events[i].first
+            << ",\"node\":"   << ev.node
+            << ",\"block\":"  << ev.block
+            << ",\"value\":"  << ev.value
+            << ",\"start\":"  << ev.start
+            << ",\"end\":"    << ev.end << "}\n";
+      }
+   }
+
+   return os.good();
+}
@@ -0,0 +1,171 @@
+//===========================================================================//
+// This file is part of the DIP Solver Framework.                            //
+//                                                                           //
+// DIP is distributed under the Eclipse Public License as part of the        //
+// COIN-OR repository (http://www.coin-or.org).                              //
+//                                                                           //
+// Authors: Matthew Galati, SAS Institute Inc. (matthew.galati@sas.com)      //
+//          Ted Ralphs, Lehigh University (ted@lehigh.edu)                   //
+//          Jiadong Wang, Lehigh University (jiw408@lehigh.edu)              //
+//                                                                           //
+// Copyright (C) 2002-2019, Lehigh University, Matthew Galati, Ted Ralphs    //
+// All Rights Reserved.                                                      //
+//===========================================================================//
+
+//===========================================================================//
+#ifndef DecompTrace_h_
+#define DecompTrace_h_
+
+//===========================================================================//
+#include "Decomp.h"
+
+//===========================================================================//
+/** Types of traced events. */
+enum DecompTraceType {
+   DecompTrace_Node,
+   DecompTrace_MasterSolve,
+   DecompTrace_Pricing,
+   DecompTrace_CutGen,
+   DecompTrace_ColumnAdd,
+   DecompTrace_ColumnCompress,
+   DecompTrace_NumTypes
+};
+const std::string DecompTraceTypeStr[DecompTrace_NumTypes] = {
+   "node",
+   "masterSolve",
+   "pricing",
+   "cutGen",
+   "columnAdd",
+   "columnCompress"
+};
+
+//===========================================================================//
+/**
+ * A timed event: type, node, block (-1 if none), a count (columns
+ * found, cuts, ...) and the start/end wall-clock times in seconds since
+ * the trace was started.
+ */
+struct DecompTraceEvent {
+   int    type;
+   int    node;
+   int    block;
+   int    value;
+   double start;
+   double end;
+};
+
+//===========================================================================//
+/**
+ * Event trace of the decomposition loop (see TraceFile).
+ *
+ * Each thread records into its own ring buffer, so recording takes no
+ * lock; when a buffer is full, the oldest events of that thread are
+ * overwritten. The trace is written at the end as JSON lines (one event
+ * per line) or in the Chrome trace format (chrome://tracing, Perfetto),
+ * where each thread is a track.
+ */
+//===========================================================================//
+class DecompTrace {
+
+private:
+   /** The ring buffer of a thread (padded against false sharing). */
+   struct Ring {
+      std::vector<DecompTraceEvent> events;
+      long long                     numRecorded;
+      char                          pad[64];
+   };
+
+   bool              m_enabled;
+   double            m_origin;
+   std::vector<Ring> m_rings;
+
+public:
+   /**
+    * Start tracing with a buffer of capacity events for each of
+    * numThreads threads.
+    */
+   void init(const int numThreads,
+             const int capacity);
+
+   inline bool isEnabled() const {
+      return m_enabled;
+   }
+
+   /** Wall-clock time since init (seconds). */
+   double now() const;
+
+   /**
+    * Record an event that started at start (from now()) and ends now.
+    * Events of threads beyond the ones given to init are dropped.
+    */
+   void record(const int    type,
+               const int    node,
+               const int    block,
+               const int    value,
+               const double start);
+
+   /** The recorded events of all threads, by start time. */
+   void getEvents(std::vector< std::pair<int, DecompTraceEvent> >& events) const;
+
+   /**
+    * Write the trace: as JSON lines, or in the Chrome trace format.
+    * Returns false if the file could not be written.
+    */
+   bool write(const std::string& fileName,
+              const bool         chrome) const;
+
+public:
+   DecompTrace() :
+      m_enabled(false),
+      m_origin (0.0),
+      m_rings  () {
+   }
+   ~DecompTrace() {}
+};
+
+//===========================================================================//
+/**
+ * Records an event for its scope: the start time is taken on
+ * construction and the event is recorded on destruction (so on every
+ * return path). Costs one branch when tracing is off.
+ */
+//===========================================================================//
+class DecompTraceScope {
+
+private:
+   DecompTrace& m_trace;
+   int          m_type;
+   int          m_node;
+   int          m_block;
+   int          m_value;
+   double       m_start;
+
+   DecompTraceScope(const DecompTraceScope&);
+   DecompTraceScope& operator=(const DecompTraceScope&);
+
+public:
+   inline void setValue(const int value) {
+      m_value = value;
+   }
+
+public:
+   DecompTraceScope(DecompTrace& trace,
+                    const int    type,
+                    const int    node,
+                    const int    block = -1) :
+      m_trace(trace),
+      m_type (type),
+      m_node (node),
+      m_block(block),
+      m_value(0),
+      m_start(trace.isEnabled() ? trace.now() : 0.0) {
+   }
+
+   ~DecompTraceScope() {
+      if (m_trace.isEnabled()) {
+         m_trace.record(m_type, m_node, m_block, m_value, m_start);
+      }
+   }
+};
+
+#endif
@@ -0,0 +1,1310 @@
+//===========================================================================//
+// This file is part of the DIP Solver Framework.                            //
+//                                                                           //
+// DIP is distributed under the Eclipse Public License as part of the        //
+// COIN-OR repository (http://www.coin-or.org).                              //
+//                                                                           //
+// Authors: Matthew Galati, SAS Institute Inc. (matthew.galati@sas.com)      //
+//          Ted Ralphs, Lehigh University (ted@lehigh.edu)                   //
+//          Jiadong Wang, Lehigh University (jiw408@lehigh.edu)              //
+//                                                                           //
+// Copyright (C) 2002-2019, Lehigh University, Matthew Galati, Ted Ralphs    //
+// All Rights Reserved.                                                      //
+//===========================================================================//
+
+//===========================================================================//
+// Unit tests of DIP's components (make unittest, also run by make test).
+//
+// Each test builds small models in code and checks a component against a
+// reference, usually the block solved as a MIP by the IP solver
+// (DecompIPSolver), which is what DecompAlgo::solveRelaxed does for a
+// block without an oracle:
+//
+//   pricingOracles  the knapsack, multiple-choice knapsack and assignment
+//                   oracles against the MIP on random reduced costs and
+//                   node bounds, and the pricing of the blocks through
+//                   solveRelaxed, including a block whose oracle gives up
+//   networkOracle   the network oracle (min-cost flow) against the MIP
+//                   on the commodity blocks of a multi-commodity flow
+//   rcspp           resource-constrained shortest path labeling against
+//                   the MIP, the reduced costs including the dual of the
+//                   convexity row
+//   branchRows      chooseBranchSum and chooseBranchRyanFoster on a small
+//                   set partitioning model with fractional solutions, and
+//                   the rows of an open node through a checkpoint
+//   masterBarrier   the master bound when the Clp barrier stops early:
+//                   master value less the duality gap, below the optimum
+//   nodePruning     the node and the global tolerances of isNodeBoundPruned
+//
+// The rounds of the random tests are set in the [UNITTEST] section, e.g.,
+//   decomp_unittest --UNITTEST:Rounds 100 --UNITTEST:Seed 7
+// The exit status is 0 if all the checks pass.
+//===========================================================================//
+
+//===========================================================================//
+#include "UtilParameters.h"
+//===========================================================================//
+#include "DecompApp.h"
+#include "DecompAlgoPC.h"
+#include "DecompCheckpoint.h"
+#include "DecompPricingOracle.h"
+#include "DecompRCSPP.h"
+
+using namespace std;
+
+//===========================================================================//
+/** Settings of the tests. */
+struct UnitTestParam {
+   int Rounds;
+   int Seed;
+};
+
+//===========================================================================//
+static int numChecks = 0;
+static int numFailed = 0;
+
+//===========================================================================//
+static void check(const bool    ok,
+                  const string& what)
+{
+   numChecks++;
+
+   if (!ok) {
+      numFailed++;
+      cout << "FAILED: " << what << endl;
+   }
+}
+
+//===========================================================================//
+static bool isEqual(const double a,
+                    const double b)
+{
+   return fabs(a - b) <= 1.0e-6 * (1.0 + fabs(b));
+}
+
+//===========================================================================//
+/**
+ * Application whose model is built by the test: the core, the blocks,
+ * each over the columns it makes active, and the objective.
+ */
+//===========================================================================//
+class UnitTest_DecompApp : public DecompApp {
+
+private:
+   vector<double> m_colUB;
+
+public:
+   /** Columns 0..numCols-1, integer with bounds [0, ub]. */
+   void setColumns(const int    numCols,
+                   const double ub = 1.0) {
+      m_colUB.assign(numCols, ub);
+   }
+
+   void setColUB(const int    j,
+                 const double ub) {
+      m_colUB[j] = ub;
+   }
+
+   inline const vector<double>& getColUB() const {
+      return m_colUB;
+   }
+
+   /** New model over all the columns, the active ones are [first, last). */
+   DecompConstraintSet* newModel(const int first,
+                                 const int last) {
+      const int            nCols = static_cast<int>(m_colUB.size());
+      DecompConstraintSet* model = new DecompConstraintSet();
+      model->M = new CoinPackedMatrix(false, 0.0, 0.0);
+      model->M->setDimensions(0, nCols);
+      model->colLB.assign(nCols, 0.0);
+      model->colUB = m_colUB;
+
+      for (int j = 0; j < nCols; j++) {
+         model->integerVars.push_back(j);
+      }
+
+      for (int j = first; j < last; j++) {
+         model->activeColumns.push_back(j);
+      }
+
+      return model;
+   }
+
+   void appendRow(DecompConstraintSet*  model,
+                  const vector<int>&    ind,
+                  const vector<double>& els,
+                  const double          lb,
+                  const double          ub) {
+      CoinPackedVector row(static_cast<int>(ind.size()), &ind[0], &els[0]);
+      model->appendRow(row, lb, ub);
+   }
+
+   /**
+    * Set the core and the blocks (the app takes ownership). Without a
+    * core, it is a single row that is never binding.
+    */
+   void setModel(const vector<double>&                objective,
+                 const vector<DecompConstraintSet*>& blocks,
+                 DecompConstraintSet*                modelCore = NULL) {
+      const int nCols = static_cast<int>(m_colUB.size());
+
+      if (!modelCore) {
+         vector<int> ind(nCols);
+         double      sumUB = 0.0;
+         modelCore = newModel(0, 0);
+
+         for (int j = 0; j < nCols; j++) {
+            ind[j]  = j;
+            sumUB  += m_colUB[j];
+         }
+
+         appendRow(modelCore, ind, vector<double>(nCols, 1.0),
+                   -m_infinity, sumUB + 1.0);
+      }
+
+      setModelObjective(&objective[0], nCols);
+      m_modelC = modelCore;
+      setModelCore(modelCore, "core");
+      NumBlocks = static_cast<int>(blocks.size());
+
+      for (int b = 0; b < NumBlocks; b++) {
+         m_modelR.insert(make_pair(b, blocks[b]));
+         setModelRelax(blocks[b], "relax" + UtilIntToStr(b), b);
+      }
+   }
+
+public:
+   UnitTest_DecompApp(UtilParameters& utilParam) :
+      DecompApp(utilParam),
+      m_colUB  () {
+   }
+};
+
+//===========================================================================//
+/** Price-and-cut algorithm with access to the components under test. */
+//===========================================================================//
+class UnitTest_DecompAlgo : public DecompAlgoPC {
+
+public:
+   inline int getNumCols() {
+      return m_modelCore.getModel()->getNumCols();
+   }
+
+   /** The oracle of block b, NULL if it has none. */
+   const DecompPricingOracle* getOracle(const int b) const {
+      map<int, DecompPricingOracle*>::const_iterator it
+         = m_pricingOracles.find(b);
+      return it == m_pricingOracles.end() ? NULL : it->second;
+   }
+
+   /** Objective of block b at the solution x (block model indexing). */
+   double blockObj(const int     b,
+                   const double* redCostX,
+                   const double* x) {
+      const vector<int>& active
+         = getModelRelax(b).getModel()->getActiveColumns();
+      double             obj = 0.0;
+
+      for (size_t k = 0; k < active.size(); k++) {
+         obj += redCostX[active[k]] * x[active[k]];
+      }
+
+      return obj;
+   }
+
+   /** Is x integral, within the node bounds and the rows of block b? */
+   bool isBlockFeasible(const int     b,
+                        const double* x,
+                        const double* lb,
+                        const double* ub) {
+      const DecompConstraintSet* model  = getModelRelax(b).getModel();
+      const vector<int>&         active = model->getActiveColumns();
+      const int                  nRows  = model->getNumRows();
+      vector<double>             ax(nRows);
+      size_t                     k;
+      int                        r;
+
+      for (k = 0; k < active.size(); k++) {
+         const double xj = x[active[k]];
+
+         if (xj < lb[active[k]] - DecompEpsilon ||
+               xj > ub[active[k]] + DecompEpsilon ||
+               fabs(xj - floor(xj + 0.5)) > DecompEpsilon) {
+            return false;
+         }
+      }
+
+      model->getMatrix()->times(x, &ax[0]);
+
+      for (r = 0; r < nRows; r++) {
+         if (ax[r] < model->getRowLB()[r] - DecompEpsilon ||
+               ax[r] > model->getRowUB()[r] + DecompEpsilon) {
+            return false;
+         }
+      }
+
+      return true;
+   }
+
+   /**
+    * Solve block b as a MIP with the node bounds [lb, ub], as solveRelaxed
+    * does. Returns false if it is infeasible.
+    */
+   bool solveBlockMIP(const int     b,
+                      const double* redCostX,
+                      const double* lb,
+                      const double* ub,
+                      double&       obj) {
+      DecompSubModel&    subModel = getModelRelax(b);
+      DecompSolverResult result(m_infinity);
+      subModel.setOsiObjCoeff(redCostX);
+      subModel.setActiveColBounds(lb, ub);
+      subModel.solveAsMIP(&result, m_param, true, false, true,
+                          m_infinity, m_infinity);
+
+      if (result.m_nSolutions == 0) {
+         return false;
+      }
+
+      obj = blockObj(b, redCostX, result.getSolution(0));
+      return true;
+   }
+
+   /**
+    * Price block b with solveRelaxed at the node bounds [lb, ub]. Returns
+    * the number of columns and their least reduced cost.
+    */
+   int priceBlock(const int     b,
+                  const double* redCostX,
+                  const double* lb,
+                  const double* ub,
+                  double&       redCost) {
+      const int          nCols = getNumCols();
+      DecompSolverResult result(m_infinity);
+      DecompVarList      vars;
+      memcpy(m_colLBNode, lb, nCols * sizeof(double));
+      memcpy(m_colUBNode, ub, nCols * sizeof(double));
+      solveRelaxed(redCostX, getOrigObjective(), 0.0, nCols, false,
+                   getModelRelax(b), &result, vars, m_infinity);
+      const int nVars = static_cast<int>(vars.size());
+      redCost = m_infinity;
+
+      for (DecompVarList::iterator it = vars.begin(); it != vars.end(); it++) {
+         redCost = std::min(redCost, (*it)->getReducedCost());
+      }
+
+      UtilDeleteListPtr(vars);
+      return nVars;
+   }
+
+   /**
+    * Solve the master as in the pricing phase, with the barrier stopped
+    * after maxIter iterations (0 = to optimality) or with dual simplex,
+    * then update the bound with no negative reduced cost.
+    * Returns false if the master is not solved.
+    */
+   bool solveMaster(const bool useBarrier,
+                    const int  maxIter,
+                    double&    obj,
+                    double&    gap) {
+      m_param.SolveMasterUpdateAlgo  = useBarrier ? DecompBarrier :
+                                       DecompDualSimplex;
+      m_param.MasterBarrierCrossover = false;
+      m_param.MasterBarrierMaxIter   = maxIter;
+      const DecompStatus status = solutionUpdate(PHASE_PRICE2, false);
+      obj = getMasterObjValue();
+      gap = m_masterObjGap;
+      updateObjBound(0.0);
+      return status == STAT_FEASIBLE;
+   }
+
+   /** The bound of the last master solution if its duality gap were gap. */
+   double boundWithGap(const double gap) {
+      m_masterObjGap = gap;
+      updateObjBound(0.0);
+      return lastBound();
+   }
+
+   /** The last bound computed (by updateObjBound). */
+   double lastBound() const {
+      return m_nodeStats.objHistoryBound.back().thisBound;
+   }
+
+   void setXhat(const vector<double>& x) {
+      memcpy(m_xhat, &x[0], x.size() * sizeof(double));
+   }
+
+   /**
+    * chooseBranchRyanFoster for the master solution made of the columns
+    * vars (which are deleted) with the weights lambda.
+    */
+   bool chooseRyanFoster(DecompVarList&           vars,
+                         const vector<double>&    lambda,
+                         vector<DecompBranchRow>& downRows,
+                         vector<DecompBranchRow>& upRows) {
+      DecompVarList  saveVars;
+      vector<double> savePrim;
+      int            i = 0;
+      saveVars.swap(m_vars);
+      savePrim.swap(m_primSolution);
+
+      for (DecompVarList::iterator it = vars.begin(); it != vars.end(); it++) {
+         (*it)->setColMasterIndex(i++);
+      }
+
+      m_vars.swap(vars);
+      m_primSolution = lambda;
+      const bool gotBranch = chooseBranchRyanFoster(downRows, upRows);
+      m_vars.swap(vars);
+      m_vars.swap(saveVars);
+      m_primSolution.swap(savePrim);
+      UtilDeleteListPtr(vars);
+      return gotBranch;
+   }
+
+public:
+   UnitTest_DecompAlgo(UnitTest_DecompApp* app,
+                       UtilParameters&     utilParam) :
+      DecompAlgoPC(app, utilParam) {
+      //---
+      //--- the MIP is the reference, it has to be solved to optimality
+      //---
+      m_param.SubProbGapLimitExact = 0.0;
+      m_param.SubProbUseCutoff     = 0;
+      createPricingOracles();
+   }
+};
+
+//===========================================================================//
+/**
+ * Random node bounds: each column is fixed to 0, or gets a lower bound of
+ * 1, with probability pFix/2.
+ */
+static void randomNodeBounds(const vector<double>& colUB,
+                             const double          pFix,
+                             vector<double>&       lb,
+                             vector<double>&       ub)
+{
+   const int nCols = static_cast<int>(colUB.size());
+   lb.assign(nCols, 0.0);
+   ub = colUB;
+
+   for (int j = 0; j < nCols; j++) {
+      const double u = UtilURand(0.0, 1.0);
+
+      if (u < 0.5 * pFix) {
+         lb[j] = 1.0;
+      } else if (u < pFix) {
+         ub[j] = 0.0;
+      }
+   }
+}
+
+//===========================================================================//
+/**
+ * Price block b at the node bounds [lb, ub] with its oracle and as a MIP
+ * and compare them, then price it through solveRelaxed. The oracle may
+ * only give up on an infeasible block, unless mayGiveUp. Returns true if
+ * the oracle solved the block.
+ */
+static bool checkOracle(UnitTest_DecompAlgo&  algo,
+                        const int             b,
+                        const vector<double>& redCostX,
+                        const vector<double>& lb,
+                        const vector<double>& ub,
+                        const bool            mayGiveUp,
+                        const string&         what)
+{
+   const DecompPricingOracle* oracle  = algo.getOracle(b);
+   double                     mipObj  = 0.0;
+   const bool                 mipFeas = algo.solveBlockMIP(b, &redCostX[0],
+                                                           &lb[0], &ub[0],
+                                                           mipObj);
+   DecompSolverResult         result(algo.getInfinity());
+   const bool                 solved  = oracle->solve(&redCostX[0],
+                                                      &lb[0], &ub[0],
+                                                      &result);
+
+   if (solved) {
+      const double* x = result.getSolution(0);
+      check(mipFeas, what + "solved an infeasible block");
+      check(algo.isBlockFeasible(b, x, &lb[0], &ub[0]),
+            what + "infeasible solution");
+      check(isEqual(result.m_objUB, algo.blockObj(b, &redCostX[0], x)),
+            what + "wrong objective");
+      check(!mipFeas || isEqual(result.m_objUB, mipObj),
+            what + "oracle " + UtilDblToStr(result.m_objUB)
+            + " MIP " + UtilDblToStr(mipObj));
+   } else if (!mayGiveUp) {
+      check(!mipFeas, what + "gave up on a feasible block");
+   }
+
+   //---
+   //--- solveRelaxed: the oracle, or the MIP if it gives up
+   //---
+   double    redCost = 0.0;
+   const int nVars   = algo.priceBlock(b, &redCostX[0], &lb[0], &ub[0],
+                                       redCost);
+   check(nVars == (mipFeas ? 1 : 0) && (!mipFeas || isEqual(redCost, mipObj)),
+         what + "solveRelaxed " + UtilDblToStr(redCost)
+         + " MIP " + UtilDblToStr(mipObj));
+   return solved;
+}
+
+//===========================================================================//
+/**
+ * Pricing oracles against the MIP. The blocks are
+ *   0  a knapsack, and a column in no row,
+ *   1  a multiple-choice knapsack (= 1 and <= 1 groups, loose columns),
+ *   2  an assignment (= 1 rows on one side, <= 1 on the other),
+ *   3  a multiple-choice knapsack whose capacity is too large for the
+ *      dynamic program: the oracle gives up and the MIP is solved.
+ * Each round draws the reduced costs and fixes some columns at the node.
+ */
+//===========================================================================//
+static void testPricingOracles(UtilParameters&      utilParam,
+                               const UnitTestParam& p)
+{
+   const int KP  = 0,  KPN  = 12;
+   const int MCK = 12, MCKN = 14;
+   const int AP  = 26, APN  = 16;
+   const int BIG = 42, BIGN = 9;
+   const int nCols = BIG + BIGN;
+   UnitTest_DecompApp           app(utilParam);
+   vector<DecompConstraintSet*> blocks;
+   vector<int>                  ind;
+   vector<double>               els;
+   double                       sum;
+   int                          i, j, g;
+   app.setColumns(nCols);
+   //---
+   //--- knapsack (the last column is in no row)
+   //---
+   DecompConstraintSet* kp = app.newModel(KP, KP + KPN);
+   sum = 0.0;
+
+   for (j = KP; j < KP + KPN - 1; j++) {
+      ind.push_back(j);
+      els.push_back(UtilURand(1, 20));
+      sum += els.back();
+   }
+
+   app.appendRow(kp, ind, els, -app.m_infinity, floor(0.5 * sum));
+   blocks.push_back(kp);
+   //---
+   //--- multiple-choice knapsack: groups of 3 (two = 1, two <= 1), the
+   //---   last 2 columns are only in the capacity row
+   //---
+   DecompConstraintSet* mck = app.newModel(MCK, MCK + MCKN);
+   ind.clear();
+   els.clear();
+   sum = 0.0;
+
+   for (g = 0; g < 4; g++) {
+      vector<int> group;
+
+      for (j = MCK + 3 * g; j < MCK + 3 * g + 3; j++) {
+         group.push_back(j);
+      }
+
+      app.appendRow(mck, group, vector<double>(3, 1.0), g < 2 ? 1.0 : 0.0, 1.0);
+   }
+
+   for (j = MCK; j < MCK + MCKN; j++) {
+      ind.push_back(j);
+      els.push_back(UtilURand(1, 9));
+      sum += els.back();
+   }
+
+   app.appendRow(mck, ind, els, -app.m_infinity, floor(0.3 * sum));
+   blocks.push_back(mck);
+   //---
+   //--- assignment 4 x 4: column 4 * i + k assigns i to k
+   //---
+   DecompConstraintSet* ap = app.newModel(AP, AP + APN);
+
+   for (i = 0; i < 4; i++) {
+      vector<int> row, col;
+
+      for (int k = 0; k < 4; k++) {
+         row.push_back(AP + 4 * i + k);
+         col.push_back(AP + 4 * k + i);
+      }
+
+      app.appendRow(ap, row, vector<double>(4, 1.0), 1.0, 1.0);
+      app.appendRow(ap, col, vector<double>(4, 1.0), 0.0, 1.0);
+   }
+
+   blocks.push_back(ap);
+   //---
+   //--- multiple-choice knapsack, 3 groups = 1, capacity 10^7
+   //---
+   DecompConstraintSet* big = app.newModel(BIG, BIG + BIGN);
+   ind.clear();
+   els.clear();
+
+   for (g = 0; g < 3; g++) {
+      vector<int> group;
+
+      for (j = BIG + 3 * g; j < BIG + 3 * g + 3; j++) {
+         group.push_back(j);
+         ind.push_back(j);
+         els.push_back(UtilURand(1, 9) * 1.0e6);
+      }
+
+      app.appendRow(big, group, vector<double>(3, 1.0), 1.0, 1.0);
+   }
+
+   app.appendRow(big, ind, els, -app.m_infinity, 1.0e7);
+   blocks.push_back(big);
+   app.setModel(vector<double>(nCols, -1.0), blocks);
+   UnitTest_DecompAlgo algo(&app, utilParam);
+   const char* names[4] = {"knapsack", "multiple-choice knapsack",
+                           "assignment", "multiple-choice knapsack"
+                          };
+   int b;
+
+   for (b = 0; b < 4; b++) {
+      const DecompPricingOracle* oracle = algo.getOracle(b);
+      check(oracle && string(oracle->getName()) == names[b],
+            "pricingOracles: block " + UtilIntToStr(b) + " is a " + names[b]);
+
+      if (!oracle) {
+         return;
+      }
+   }
+
+   //---
+   //--- random rounds, the blocks are small: only the last one hits a
+   //---   limit
+   //---
+   vector<double> redCostX(nCols), lb, ub;
+   int            nSolved = 0;
+   int            nGaveUp = 0;
+
+   for (int round = 0; round < p.Rounds; round++) {
+      for (j = 0; j < nCols; j++) {
+         redCostX[j] = UtilURand(-10.0, 10.0);
+      }
+
+      randomNodeBounds(app.getColUB(), 0.1, lb, ub);
+
+      for (b = 0; b < 4; b++) {
+         if (!algo.getOracle(b)) {
+            continue;
+         }
+
+         const bool solved = checkOracle(algo, b, redCostX, lb, ub, b == 3,
+                                         "pricingOracles: round "
+                                         + UtilIntToStr(round) + " block "
+                                         + UtilIntToStr(b) + ": ");
+         nSolved += solved;
+         nGaveUp += !solved && b == 3;
+      }
+   }
+
+   check(nSolved > 0, "pricingOracles: no block solved by an oracle");
+   check(nGaveUp == p.Rounds, "pricingOracles: the large capacity was solved");
+   //---
+   //--- the oracles give up on conflicting node bounds
+   //---
+   randomNodeBounds(app.getColUB(), 0.0, lb, ub);
+   lb[KP] = 1.0;
+   ub[KP] = 0.0;
+   DecompSolverResult result(algo.getInfinity());
+   check(!algo.getOracle(0)->solve(&redCostX[0], &lb[0], &ub[0], &result),
+         "pricingOracles: conflicting bounds");
+   //---
+   //--- knapsack: the columns fixed to 1 exceed the capacity
+   //---
+   randomNodeBounds(app.getColUB(), 0.0, lb, ub);
+
+   for (j = KP; j < KP + KPN; j++) {
+      lb[j] = 1.0;
+   }
+
+   check(!algo.getOracle(0)->solve(&redCostX[0], &lb[0], &ub[0], &result),
+         "pricingOracles: knapsack over capacity");
+   //---
+   //--- multiple-choice: two columns of a group fixed to 1, a = 1
+   //---   group fixed to 0
+   //---
+   randomNodeBounds(app.getColUB(), 0.0, lb, ub);
+   lb[MCK] = lb[MCK + 1] = 1.0;
+   check(!algo.getOracle(1)->solve(&redCostX[0], &lb[0], &ub[0], &result),
+         "pricingOracles: two columns of a group");
+   randomNodeBounds(app.getColUB(), 0.0, lb, ub);
+   ub[MCK] = ub[MCK + 1] = ub[MCK + 2] = 0.0;
+   check(!algo.getOracle(1)->solve(&redCostX[0], &lb[0], &ub[0], &result),
+         "pricingOracles: = 1 group fixed to 0");
+   //---
+   //--- assignment: a = 1 row fixed to 0
+   //---
+   randomNodeBounds(app.getColUB(), 0.0, lb, ub);
+
+   for (j = AP; j < AP + 4; j++) {
+      ub[j] = 0.0;
+   }
+
+   check(!algo.getOracle(2)->solve(&redCostX[0], &lb[0], &ub[0], &result),
+         "pricingOracles: assignment row fixed to 0");
+}
+
+//===========================================================================//
+/**
+ * Network oracle against the MIP, on two commodity blocks of a
+ * multi-commodity flow (a row per node, inflow - outflow):
+ *   0  2 units from node 0 to node 7 of a random digraph, general integer
+ *      arcs of capacity 1 to 3 (and a path 0-1-..-7 of capacity 3),
+ *   1  at most a unit from node 0 to node 5 of a complete DAG, binary
+ *      arcs: the source and sink rows are ranges, node 3 may absorb flow
+ *      (>= 0) and an arc enters node 2 from outside (it has no tail).
+ */
+//===========================================================================//
+static void testNetworkOracle(UtilParameters&      utilParam,
+                              const UnitTestParam& p)
+{
+   const int MCF = 0,  MCFN = 20, MCFNodes = 8;
+   const int SP  = 20, SPN  = 16, SPNodes  = 6;
+   const int nCols = SP + SPN;
+   UnitTest_DecompApp           app(utilParam);
+   vector<DecompConstraintSet*> blocks;
+   vector< vector<int> >        rowInd;
+   vector< vector<double> >     rowEls;
+   int                          i, j, k, v;
+   app.setColumns(nCols);
+   //---
+   //--- the digraph: arc (tail, head) is column j
+   //---
+   rowInd.assign(MCFNodes, vector<int>());
+   rowEls.assign(MCFNodes, vector<double>());
+
+   for (j = MCF; j < MCF + MCFN; j++) {
+      int tail = j - MCF;
+      int head = tail + 1;
+
+      if (j - MCF >= MCFNodes - 1) {
+         tail = UtilURand(0, MCFNodes - 1);
+         head = (tail + UtilURand(1, MCFNodes - 1)) % MCFNodes;
+      }
+
+      app.setColUB(j, j - MCF < MCFNodes - 1 ? 3.0 : UtilURand(1, 3));
+      rowInd[tail].push_back(j);
+      rowEls[tail].push_back(-1.0);
+      rowInd[head].push_back(j);
+      rowEls[head].push_back(1.0);
+   }
+
+   DecompConstraintSet* mcf = app.newModel(MCF, MCF + MCFN);
+
+   for (v = 0; v < MCFNodes; v++) {
+      const double rhs = v == 0 ? -2.0 : (v == MCFNodes - 1 ? 2.0 : 0.0);
+      app.appendRow(mcf, rowInd[v], rowEls[v], rhs, rhs);
+   }
+
+   blocks.push_back(mcf);
+   //---
+   //--- the DAG: arcs (i, k), i < k, then the arc into node 2
+   //---
+   rowInd.assign(SPNodes, vector<int>());
+   rowEls.assign(SPNodes, vector<double>());
+   j = SP;
+
+   for (i = 0; i < SPNodes; i++) {
+      for (k = i + 1; k < SPNodes; k++, j++) {
+         rowInd[i].push_back(j);
+         rowEls[i].push_back(-1.0);
+         rowInd[k].push_back(j);
+         rowEls[k].push_back(1.0);
+      }
+   }
+
+   rowInd[2].push_back(j);
+   rowEls[2].push_back(1.0);
+   DecompConstraintSet* sp = app.newModel(SP, SP + SPN);
+
+   for (v = 0; v < SPNodes; v++) {
+      double lb = 0.0, ub = 0.0;
+
+      if (v == 0) {
+         lb = -1.0;
+      } else if (v == SPNodes - 1) {
+         ub = 1.0;
+      } else if (v == 3) {
+         ub = app.m_infinity;
+      }
+
+      app.appendRow(sp, rowInd[v], rowEls[v], lb, ub);
+   }
+
+   blocks.push_back(sp);
+   app.setModel(vector<double>(nCols, 1.0), blocks);
+   UnitTest_DecompAlgo algo(&app, utilParam);
+   int b;
+
+   for (b = 0; b < 2; b++) {
+      const DecompPricingOracle* oracle = algo.getOracle(b);
+      check(oracle && string(oracle->getName()) == "network flow",
+            "networkOracle: block " + UtilIntToStr(b) + " is a network");
+
+      if (!oracle) {
+         return;
+      }
+   }
+
+   //---
+   //--- random rounds; the min-cost flow never gives up on a feasible
+   //---   block, the negative arcs are of finite capacity
+   //---
+   vector<double> redCostX(nCols), lb, ub;
+   int            nSolved = 0;
+
+   for (int round = 0; round < p.Rounds; round++) {
+      for (j = 0; j < nCols; j++) {
+         redCostX[j] = UtilURand(-5.0, 10.0);
+      }
+
+      randomNodeBounds(app.getColUB(), 0.1, lb, ub);
+
+      for (b = 0; b < 2; b++) {
+         nSolved += checkOracle(algo, b, redCostX, lb, ub, false,
+                                "networkOracle: round "
+                                + UtilIntToStr(round) + " block "
+                                + UtilIntToStr(b) + ": ");
+      }
+   }
+
+   check(nSolved > 0, "networkOracle: no block solved");
+}
+
+//===========================================================================//
+/**
+ * Is path a source-sink path of rcspp within the capacity of each
+ * resource, of cost below convexDual?
+ */
+static bool isPathValid(const DecompRCSPP&        rcspp,
+                        const DecompRCSPP::Path&  path,
+                        const vector<double>&     consume,
+                        const int                 nRes,
+                        const double              cap,
+                        const int                 sink,
+                        const double              convexDual)
+{
+   const size_t   nArcs = path.arcs.size();
+   vector<double> used(nRes, 0.0);
+   double         cost  = 0.0;
+
+   if (nArcs == 0 || path.nodes.size() != nArcs + 1 ||
+         path.nodes.front() != 0 || path.nodes.back() != sink) {
+      return false;
+   }
+
+   for (size_t k = 0; k < nArcs; k++) {
+      const int a = path.arcs[k];
+
+      if (rcspp.getTail(a) != path.nodes[k] ||
+            rcspp.getHead(a) != path.nodes[k + 1]) {
+         return false;
+      }
+
+      cost += rcspp.getArcCost(a);
+
+      for (int r = 0; r < nRes; r++) {
+         used[r] += consume[a * nRes + r];
+      }
+   }
+
+   for (int r = 0; r < nRes; r++) {
+      if (used[r] > cap + DecompEpsilon) {
+         return false;
+      }
+   }
+
+   return isEqual(path.cost, cost) && cost < convexDual;
+}
+
+//===========================================================================//
+/**
+ * Resource-constrained shortest path pricing against the MIP. The block
+ * is a random DAG from node 0 to the last node (the arc between them
+ * always exists) with two resources of capacity 12. On a DAG every path
+ * is elementary, so the MIP is a unit flow with a capacity row per
+ * resource. The dual of the convexity row is set just below, at, or just
+ * above the MIP value: labeling has to find the best path, with the
+ * reduced cost of the MIP, only in the last case.
+ */
+//===========================================================================//
+static void testRCSPP(UtilParameters&      utilParam,
+                      const UnitTestParam& p)
+{
+   const int      nNodes = 8;
+   const int      nRes   = 2;
+   const double   cap    = 12.0;
+   vector<int>    tails, heads;
+   vector<double> consume;
+   int            i, k, a, r, v;
+
+   for (i = 0; i < nNodes; i++) {
+      for (k = i + 1; k < nNodes; k++) {
+         if ((i == 0 && k == nNodes - 1) || UtilURand(0.0, 1.0) < 0.5) {
+            tails.push_back(i);
+            heads.push_back(k);
+
+            for (r = 0; r < nRes; r++) {
+               consume.push_back(UtilURand(1, 5));
+            }
+         }
+      }
+   }
+
+   const int                    nArcs = static_cast<int>(tails.size());
+   UnitTest_DecompApp           app(utilParam);
+   vector< vector<int> >        rowInd(nNodes);
+   vector< vector<double> >     rowEls(nNodes);
+   vector<int>                  ind;
+   vector<double>               els;
+   vector<DecompConstraintSet*> blocks;
+   app.setColumns(nArcs);
+   DecompConstraintSet* model = app.newModel(0, nArcs);
+
+   for (a = 0; a < nArcs; a++) {
+      rowInd[tails[a]].push_back(a);
+      rowEls[tails[a]].push_back(-1.0);
+      rowInd[heads[a]].push_back(a);
+      rowEls[heads[a]].push_back(1.0);
+      ind.push_back(a);
+   }
+
+   for (v = 0; v < nNodes; v++) {
+      const double rhs = v == 0 ? -1.0 : (v == nNodes - 1 ? 1.0 : 0.0);
+      app.appendRow(model, rowInd[v], rowEls[v], rhs, rhs);
+   }
+
+   for (r = 0; r < nRes; r++) {
+      els.clear();
+
+      for (a = 0; a < nArcs; a++) {
+         els.push_back(consume[a * nRes + r]);
+      }
+
+      app.appendRow(model, ind, els, -app.m_infinity, cap);
+   }
+
+   blocks.push_back(model);
+   app.setModel(vector<double>(nArcs, 1.0), blocks);
+   UnitTest_DecompAlgo algo(&app, utilParam);
+   DecompRCSPP         rcspp(nNodes, nRes, 0, nNodes - 1);
+
+   for (a = 0; a < nArcs; a++) {
+      rcspp.addArc(tails[a], heads[a], &consume[a * nRes]);
+   }
+
+   for (v = 0; v < nNodes; v++) {
+      for (r = 0; r < nRes; r++) {
+         rcspp.setResourceWindow(v, r, 0.0, cap);
+      }
+   }
+
+   vector<int>    arcColumn(ind);
+   vector<double> redCostX(nArcs), lb(nArcs, 0.0), ub(nArcs, 1.0);
+   const double   delta[3] = { -0.5, 0.0, 0.5};
+
+   for (int round = 0; round < p.Rounds; round++) {
+      const string what = "rcspp: round " + UtilIntToStr(round) + ": ";
+
+      for (a = 0; a < nArcs; a++) {
+         redCostX[a] = UtilURand(-3.0, 10.0);
+      }
+
+      rcspp.setArcCost(&redCostX[0]);
+      double mipObj = 0.0;
+
+      if (!algo.solveBlockMIP(0, &redCostX[0], &lb[0], &ub[0], mipObj)) {
+         check(false, what + "the MIP is infeasible");
+         continue;
+      }
+
+      const double convexDual = mipObj + delta[round % 3];
+
+      for (int bidir = 0; bidir < 2; bidir++) {
+         const string                 whatDir = what + (bidir ?
+                                                        "bidirectional: " :
+                                                        "forward: ");
+         vector<DecompRCSPP::Path>    paths;
+         DecompVarList                vars;
+         DecompVarList::iterator      it;
+         size_t                       t;
+         rcspp.setBidirectional(bidir != 0);
+         check(rcspp.solve(false, 1000, convexDual, paths),
+               whatDir + "not exact");
+         check(paths.empty() == (mipObj >= convexDual - DecompEpsilon),
+               whatDir + UtilIntToStr(static_cast<int>(paths.size()))
+               + " paths, MIP " + UtilDblToStr(mipObj)
+               + " dual " + UtilDblToStr(convexDual));
+         const double best = paths.empty() ? mipObj : paths[0].cost;
+         check(isEqual(best, mipObj),
+               whatDir + "best path " + UtilDblToStr(best)
+               + " MIP " + UtilDblToStr(mipObj));
+
+         for (t = 0; t < paths.size(); t++) {
+            check(isPathValid(rcspp, paths[t], consume, nRes, cap,
+                              nNodes - 1, convexDual),
+                  whatDir + "invalid path");
+         }
+
+         //---
+         //--- the reduced cost of a column includes the convexity dual
+         //---
+         rcspp.appendVars(paths, arcColumn, algo.getOrigObjective(),
+                          convexDual, 0, vars);
+         check(vars.size() == paths.size(), whatDir + "columns");
+
+         for (it = vars.begin(), t = 0; it != vars.end(); it++, t++) {
+            check(isEqual((*it)->getReducedCost(), paths[t].cost - convexDual)
+                  && (*it)->getReducedCost() < 0.0,
+                  whatDir + "reduced cost of a column");
+         }
+
+         check(vars.empty() ||
+               isEqual(vars.front()->getReducedCost(), mipObj - convexDual),
+               whatDir + "best reduced cost");
+         UtilDeleteListPtr(vars);
+         //---
+         //--- heuristic pricing: not exact, but the paths are valid
+         //---
+         rcspp.solve(true, 10, convexDual, paths);
+
+         for (t = 0; t < paths.size(); t++) {
+            check(isPathValid(rcspp, paths[t], consume, nRes, cap,
+                              nNodes - 1, convexDual),
+                  whatDir + "invalid heuristic path");
+         }
+      }
+   }
+}
+
+//===========================================================================//
+/** Are the branching rows a and b the same? */
+static bool isSameRow(const DecompBranchRow& a,
+                      const DecompBranchRow& b)
+{
+   return a.type == b.type && a.blockId == b.blockId && a.name == b.name &&
+          a.ind == b.ind && a.els == b.els && a.lb == b.lb && a.ub == b.ub;
+}
+
+//===========================================================================//
+/** Is row a x with x in [lb, ub], over the columns ind with 1s? */
+static bool isRow(const DecompBranchRow& row,
+                  const int              type,
+                  const string&          name,
+                  const int*             ind,
+                  const double*          els,
+                  const int              len,
+                  const double           lb,
+                  const double           ub)
+{
+   return row.type == type && row.name == name &&
+          row.ind == vector<int>(ind, ind + len) &&
+          row.els == vector<double>(els, els + len) &&
+          row.lb == lb && row.ub == ub;
+}
+
+//===========================================================================//
+/**
+ * Branching rows. Two blocks of 3 binary columns with the core rows
+ *   0  x0 + x1 + x2 + x3 + x4 + x5 <= 3
+ *   1  x0 + x3                     <= 1
+ *   2  x0 + x1 = 1,  3  x2 + x3 = 1,  4  x4 + x5 = 1
+ * chooseBranchSum picks the most fractional sum of row 0 over a block
+ * or of row 1 over both; chooseBranchRyanFoster picks the pair of set
+ * partitioning rows (2-4) most fractionally covered together. The rows
+ * chosen must then survive a checkpoint of an open node.
+ */
+//===========================================================================//
+static void testBranchRows(UtilParameters& utilParam)
+{
+   const int                    nCols = 6;
+   UnitTest_DecompApp           app(utilParam);
+   vector<DecompConstraintSet*> blocks;
+   const int                    all[6]  = {0, 1, 2, 3, 4, 5};
+   const int                    r1[2]   = {0, 3};
+   const double                 ones[6] = {1.0, 1.0, 1.0, 1.0, 1.0, 1.0};
+   const double                 inf     = app.m_infinity;
+   app.setColumns(nCols);
+   blocks.push_back(app.newModel(0, 3));
+   blocks.push_back(app.newModel(3, 6));
+   DecompConstraintSet* modelCore = app.newModel(0, 0);
+   app.appendRow(modelCore, vector<int>(all, all + 6),
+                 vector<double>(6, 1.0), -inf, 3.0);
+   app.appendRow(modelCore, vector<int>(r1, r1 + 2),
+                 vector<double>(2, 1.0), -inf, 1.0);
+
+   for (int r = 0; r < 3; r++) {
+      app.appendRow(modelCore, vector<int>(all + 2 * r, all + 2 * r + 2),
+                    vector<double>(2, 1.0), 1.0, 1.0);
+   }
+
+   app.setModel(vector<double>(nCols, 1.0), blocks, modelCore);
+   UnitTest_DecompAlgo     algo(&app, utilParam);
+   vector<DecompBranchRow> down, up;
+   //---
+   //--- row 0 sums to 1.4 over block 0 and to 1.6 over block 1 (a tie,
+   //---   the first wins), row 1 to 1.1, the other sums are integral
+   //---
+   const double x1[6] = {0.5, 0.5, 0.4, 0.6, 1.0, 0.0};
+   algo.setXhat(vector<double>(x1, x1 + 6));
+   check(algo.chooseBranchSum(down, up) && down.size() == 1 &&
+         up.size() == 1, "branchSum: no block sum chosen");
+
+   if (down.size() == 1 && up.size() == 1) {
+      check(isRow(down[0], DecompBranchRow_Master, "sum(0,0)", all, ones, 3,
+                  -inf, 1.0) && down[0].blockId == 0,
+            "branchSum: down row of the block sum");
+      check(isRow(up[0], DecompBranchRow_Master, "sum(0,0)", all, ones, 3,
+                  2.0, inf) && up[0].blockId == 0,
+            "branchSum: up row of the block sum");
+   }
+
+   //---
+   //--- row 1 over both blocks is 0.5 (the block sums are integral)
+   //---
+   const double x2[6] = {0.5, 0.5, 0.0, 0.0, 0.5, 0.5};
+   down.clear();
+   up.clear();
+   algo.setXhat(vector<double>(x2, x2 + 6));
+   check(algo.chooseBranchSum(down, up) && down.size() == 1 &&
+         up.size() == 1, "branchSum: no sum over all blocks chosen");
+
+   if (down.size() == 1 && up.size() == 1) {
+      check(isRow(down[0], DecompBranchRow_Master, "sum(1,all)", r1, ones, 2,
+                  -inf, 0.0) && down[0].blockId == -1,
+            "branchSum: down row of the sum over all blocks");
+      check(isRow(up[0], DecompBranchRow_Master, "sum(1,all)", r1, ones, 2,
+                  1.0, inf) && up[0].blockId == -1,
+            "branchSum: up row of the sum over all blocks");
+   }
+
+   //---
+   //--- integral x: no sum to branch on
+   //---
+   const double x3[6] = {1.0, 0.0, 0.0, 1.0, 1.0, 0.0};
+   vector<DecompBranchRow> none;
+   algo.setXhat(vector<double>(x3, x3 + 6));
+   check(!algo.chooseBranchSum(none, none) && none.empty(),
+         "branchSum: branched on an integral x");
+   //---
+   //--- Ryan-Foster: columns {x0, x2} and {x1, x3, x4} at 0.5 cover rows
+   //---   (2, 3) together 1.0, (2, 4) and (3, 4) 0.5: branch on (2, 4)
+   //---
+   const int     s1[2]     = {0, 2};
+   const int     s2[3]     = {1, 3, 4};
+   const int     apart[4]  = {0, 1, 4, 5};
+   const double  elsJoin[4] = {1.0, 1.0, -1.0, -1.0};
+   DecompVarList vars;
+   vars.push_back(new DecompVar(vector<int>(s1, s1 + 2), 1.0, 0.0, 0.0,
+                                DecompVar_Point));
+   vars.push_back(new DecompVar(vector<int>(s2, s2 + 3), 1.0, 0.0, 0.0,
+                                DecompVar_Point));
+   vector<DecompBranchRow> rfDown, rfUp;
+   check(algo.chooseRyanFoster(vars, vector<double>(2, 0.5), rfDown, rfUp) &&
+         rfDown.size() == 1 && rfUp.size() == 1,
+         "branchRyanFoster: no pair chosen");
+
+   if (rfDown.size() == 1 && rfUp.size() == 1) {
+      check(isRow(rfDown[0], DecompBranchRow_Column, "rfApart(2,4)",
+                  apart, ones, 4, -inf, 1.0),
+            "branchRyanFoster: apart row");
+      check(isRow(rfUp[0], DecompBranchRow_Column, "rfTogether(2,4)",
+                  apart, elsJoin, 4, 0.0, 0.0),
+            "branchRyanFoster: together row");
+   }
+
+   //---
+   //--- an integral master solution: no pair to branch on
+   //---
+   vars.push_back(new DecompVar(vector<int>(s1, s1 + 2), 1.0, 0.0, 0.0,
+                                DecompVar_Point));
+   vars.push_back(new DecompVar(vector<int>(s2, s2 + 3), 1.0, 0.0, 0.0,
+                                DecompVar_Point));
+   const double lambda[2] = {1.0, 0.0};
+   check(!algo.chooseRyanFoster(vars, vector<double>(lambda, lambda + 2),
+                                none, none) && none.empty(),
+         "branchRyanFoster: branched on an integral master solution");
+   //---
+   //--- an open node with the rows chosen survives a checkpoint
+   //---
+   const string     fileName = "decomp_unittest.ckpt";
+   DecompCheckpoint cp, cpRead;
+   string           errMsg;
+   DecompCheckpoint::Node node;
+   node.quality     = 1.5;
+   node.branchedDir = 1;
+   node.colLB.assign(nCols, 0.0);
+   node.colUB.assign(nCols, 1.0);
+   node.branchRows  = up;
+   node.branchRows.insert(node.branchRows.end(), rfDown.begin(), rfDown.end());
+   cp.stamp = "unittest";
+   cp.nodes.push_back(node);
+   cp.write(fileName);
+   const bool isRead = cpRead.read(fileName, errMsg);
+   remove(fileName.c_str());
+   check(isRead, "checkpoint: " + errMsg);
+   check(cpRead.nodes.size() == 1 &&
+         cpRead.nodes[0].branchRows.size() == node.branchRows.size(),
+         "checkpoint: the branching rows of the node are lost");
+
+   if (cpRead.nodes.size() == 1 &&
+         cpRead.nodes[0].branchRows.size() == node.branchRows.size()) {
+      const DecompCheckpoint::Node& nodeRead = cpRead.nodes[0];
+
+      for (size_t k = 0; k < node.branchRows.size(); k++) {
+         check(isSameRow(nodeRead.branchRows[k], node.branchRows[k]),
+               "checkpoint: branching row " + node.branchRows[k].name);
+      }
+
+      check(nodeRead.colLB == node.colLB && nodeRead.colUB == node.colUB &&
+            nodeRead.quality == node.quality &&
+            nodeRead.branchedDir == node.branchedDir,
+            "checkpoint: the bounds of the node");
+   }
+}
+
+//===========================================================================//
+/**
+ * Barrier master stopped early. Three blocks of 5 binary columns, each
+ * with at most 2 columns set, share the rows sum_b x(b,k) <= 1. The
+ * master is solved with the Clp barrier stopped after 1, 2, ...
+ * iterations: each bound must be the master value less the duality gap
+ * of the point and must not exceed the master optimum (from simplex).
+ * Some limit must stop the barrier at a feasible point, so the early-stop
+ * path is taken.
+ */
+//===========================================================================//
+static void testMasterBarrier(UtilParameters& utilParam)
+{
+   const int                    nBlocks = 3, nK = 5, nCols = nBlocks * nK;
+   UnitTest_DecompApp           app(utilParam);
+   vector<DecompConstraintSet*> blocks;
+   vector<double>               objective(nCols);
+   int                          b, k;
+   app.setColumns(nCols);
+   DecompConstraintSet* modelCore = app.newModel(0, 0);
+
+   for (k = 0; k < nK; k++) {
+      vector<int> ind;
+
+      for (b = 0; b < nBlocks; b++) {
+         ind.push_back(b * nK + k);
+      }
+
+      app.appendRow(modelCore, ind, vector<double>(nBlocks, 1.0),
+                    -app.m_infinity, 1.0);
+   }
+
+   for (b = 0; b < nBlocks; b++) {
+      vector<int> ind;
+      blocks.push_back(app.newModel(b * nK, (b + 1) * nK));
+
+      for (k = 0; k < nK; k++) {
+         ind.push_back(b * nK + k);
+         objective[b * nK + k] = -static_cast<double>(1 + rand() % 10);
+      }
+
+      app.appendRow(blocks.back(), ind, vector<double>(nK, 1.0),
+                    -app.m_infinity, 2.0);
+   }
+
+   app.setModel(objective, blocks, modelCore);
+   UnitTest_DecompAlgo algo(&app, utilParam);
+   double              zLP, obj, gap;
+   check(algo.solveMaster(false, 0, zLP, gap) && gap == 0.0,
+         "masterBarrier: simplex master not solved");
+   const double tol = 1.0e-6 * (1.0 + fabs(zLP));
+   check(isEqual(algo.boundWithGap(0.0), zLP),
+         "masterBarrier: bound of the simplex master");
+   check(isEqual(algo.boundWithGap(2.5), zLP - 2.5),
+         "masterBarrier: the duality gap is not subtracted from the bound");
+   int nEarly = 0;
+
+   for (int maxIter = 1; maxIter <= 20; maxIter++) {
+      const string what = "masterBarrier: maxIter " + UtilIntToStr(maxIter);
+
+      if (!algo.solveMaster(true, maxIter, obj, gap)) {
+         check(false, what + ": master not solved");
+         continue;
+      }
+
+      nEarly += gap > 0.0;
+      check(fabs(algo.lastBound() - (obj - gap)) <= tol,
+            what + ": bound " + UtilDblToStr(algo.lastBound()) +
+            " is not the master value " + UtilDblToStr(obj) +
+            " less the gap " + UtilDblToStr(gap));
+      check(algo.lastBound() <= zLP + tol,
+            what + ": bound " + UtilDblToStr(algo.lastBound()) +
+            " above the master optimum " + UtilDblToStr(zLP));
+   }
+
+   check(nEarly > 0,
+         "masterBarrier: the barrier never stopped early at a feasible point");
+}
+
+//===========================================================================//
+/**
+ * Pruning on the bound with the default tolerances: a node is pruned only
+ * if its bound reaches the incumbent (NodePruneRelGap = 0), the search
+ * stops when the best bound is within the optimality gap (NodeFathomRelGap
+ * = 1e-4). The costs are fractional, so the bound is not rounded.
+ */
+//===========================================================================//
+static void testNodePruning(UtilParameters& utilParam)
+{
+   UnitTest_DecompApp           app(utilParam);
+   vector<DecompConstraintSet*> blocks;
+   const int                    ind[2]       = {0, 1};
+   const double                 objective[2] = {0.5, 1.0};
+   app.setColumns(2);
+   blocks.push_back(app.newModel(0, 2));
+   app.appendRow(blocks.back(), vector<int>(ind, ind + 2),
+                 vector<double>(2, 1.0), 1.0, 1.0);
+   app.setModel(vector<double>(objective, objective + 2), blocks);
+   UnitTest_DecompAlgo algo(&app, utilParam);
+   const double        inf = algo.getInfinity();
+   check(!algo.isNodeBoundPruned(99.995, 100.0),
+         "nodePruning: node within the optimality gap of UB pruned");
+   check(algo.isNodeBoundPruned(99.995, 100.0, true),
+         "nodePruning: search not stopped within the optimality gap");
+   check(!algo.isNodeBoundPruned(99.9, 100.0, true),
+         "nodePruning: search stopped outside the optimality gap");
+   check(algo.isNodeBoundPruned(100.0, 100.0) &&
+         algo.isNodeBoundPruned(100.5, 100.0),
+         "nodePruning: node with a bound >= UB not pruned");
+   check(!algo.isNodeBoundPruned(100.0, inf) &&
+         !algo.isNodeBoundPruned(-inf, 100.0, true),
+         "nodePruning: pruned without an incumbent or a bound");
+}
+
+//===========================================================================//
+int main(int argc, char** argv)
+{
+   try {
+      UtilParameters utilParam(argc, argv);
+      UnitTestParam  p;
+      p.Rounds = utilParam.GetSetting("Rounds", 20, "UNITTEST");
+      p.Seed   = utilParam.GetSetting("Seed",   1,  "UNITTEST");
+      srand(p.Seed);
+      testPricingOracles(utilParam, p);
+      testNetworkOracle(utilParam, p);
+      testRCSPP(utilParam, p);
+      testBranchRows(utilParam);
+      testMasterBarrier(utilParam);
+      testNodePruning(utilParam);
+   } catch (CoinError& ex) {
+      cerr << "COIN Exception [ " << ex.message() << " ]"
+           << " at " << ex.fileName()  << ":L" << ex.lineNumber()
+           << " in " << ex.className() << "::" << ex.methodName() << endl;
+      return 1;
+   }
+
+   cout << numChecks << " checks, " << numFailed << " failed" << endl;
+   return numFailed ? 1 : 0;
+}
@@ -0,0 +1,299 @@
+//===========================================================================//
+// This file is part of the DIP Solver Framework.                            //
+//                                                                           //
+// DIP is distributed under the Eclipse Public License as part of the        //
+// COIN-OR repository (http://www.coin-or.org).                              //
+//                                                                           //
+// Authors: Matthew Galati, SAS Institute Inc. (matthew.galati@sas.com)      //
+//          Ted Ralphs, Lehigh University (ted@lehigh.edu)                   //
+//          Jiadong Wang, Lehigh University (jiw408@lehigh.edu)              //
+//                                                                           //
+// Copyright (C) 2002-2019, Lehigh University, Matthew Galati, Ted Ralphs    //
+// All Rights Reserved.                                                      //
+//===========================================================================//
+
+#ifndef UTIL_BINARYIO_INCLUDED
+#define UTIL_BINARYIO_INCLUDED
+
+//===========================================================================//
+// Helpers for DIP's binary files (model cache, checkpoints, column files).
+//
+// A file is a fixed header followed by a payload:
+//
+//    char     magic[8]
+//    uint32   version
+//    uint32   byteOrder   (0x01020304 as written)
+//    uint64   payload size in bytes
+//    uint64   FNV-1a checksum of the payload
+//
+// Data is stored in native byte order; a file written on a machine with
+// the other byte order is rejected. Arrays are 8-byte aligned inside the
+// payload so that a mapped payload could be used in place.
+//===========================================================================//
+
+#include <stdint.h>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <fstream>
+#include "CoinError.hpp"
+
+// ------------------------------------------------------------------------- //
+inline uint64_t UtilFnv1a(const char*  buf,
+                          const size_t len)
+{
+   uint64_t hash = 14695981039346656037ULL;
+
+   for (size_t i = 0; i < len; i++) {
+      hash ^= static_cast<unsigned char>(buf[i]);
+      hash *= 1099511628211ULL;
+   }
+
+   return hash;
+}
+
+// ------------------------------------------------------------------------- //
+class UtilBinaryWriter {
+private:
+   std::vector<char> m_buf;
+
+public:
+   inline const std::vector<char>& getBuffer() const {
+      return m_buf;
+   }
+
+   inline void align() {
+      while (m_buf.size() % 8) {
+         m_buf.push_back(0);
+      }
+   }
+
+   inline void putBytes(const void* p,
+                        const size_t n) {
+      if (n) {
+         const char* c = static_cast<const char*>(p);
+         m_buf.insert(m_buf.end(), c, c + n);
+      }
+   }
+
+   template <class T>
+   inline void put(const T& x) {
+      putBytes(&x, sizeof(T));
+   }
+
+   template <class T>
+   inline void putArray(const T*       x,
+                        const uint64_t n) {
+      put(n);
+      align();
+      putBytes(x, n * sizeof(T));
+   }
+
+   template <class T>
+   inline void putVector(const std::vector<T>& x) {
+      putArray(x.empty() ? 0 : &x[0], static_cast<uint64_t>(x.size()));
+   }
+
+   inline void putString(const std::string& s) {
+      putArray(s.data(), static_cast<uint64_t>(s.size()));
+   }
+
+   inline void putStrings(const std::vector<std::string>& s) {
+      put(static_cast<uint64_t>(s.size()));
+
+      for (size_t i = 0; i < s.size(); i++) {
+         putString(s[i]);
+      }
+   }
+};
+
+// ------------------------------------------------------------------------- //
+class UtilBinaryReader {
+private:
+   const char* m_beg;
+   const char* m_p;
+   const char* m_end;
+
+   inline void need(const size_t n) {
+      if (static_cast<size_t>(m_end - m_p) < n) {
+         throw CoinError("Truncated binary data", "need", "UtilBinaryReader");
+      }
+   }
+
+public:
+   inline bool atEnd() const {
+      return m_p == m_end;
+   }
+
+   inline void align() {
+      while ((m_p - m_beg) % 8) {
+         need(1);
+         m_p++;
+      }
+   }
+
+   inline void getBytes(void*        p,
+                        const size_t n) {
+      need(n);
+
+      if (n) {
+         memcpy(p, m_p, n);
+      }
+
+      m_p += n;
+   }
+
+   template <class T>
+   inline T get() {
+      T x;
+      getBytes(&x, sizeof(T));
+      return x;
+   }
+
+   template <class T>
+   inline void getVector(std::vector<T>& x) {
+      uint64_t n = get<uint64_t>();
+      align();
+
+      if (n > static_cast<uint64_t>(m_end - m_p) / sizeof(T)) {
+         throw CoinError("Truncated binary data", "getVector",
+                         "UtilBinaryReader");
+      }
+
+      x.resize(static_cast<size_t>(n));
+      getBytes(n ? &x[0] : 0, static_cast<size_t>(n) * sizeof(T));
+   }
+
+   inline std::string getString() {
+      std::vector<char> c;
+      getVector(c);
+      return c.empty() ? std::string() : std::string(&c[0], c.size());
+   }
+
+   inline void getStrings(std::vector<std::string>& s) {
+      uint64_t n = get<uint64_t>();
+      s.clear();
+      s.reserve(static_cast<size_t>(n));
+
+      for (uint64_t i = 0; i < n; i++) {
+         s.push_back(getString());
+      }
+   }
+
+public:
+   UtilBinaryReader(const std::vector<char>& buf) :
+      m_beg(buf.empty() ? 0 : &buf[0]),
+      m_p  (m_beg),
+      m_end(m_beg + buf.size()) {
+   }
+};
+
+// ------------------------------------------------------------------------- //
+/**
+ * Write header and payload. The file is written under a temporary name
+ * and renamed, so an interrupted write never leaves a partial file.
+ * Returns false on an I/O error.
+ */
+inline bool UtilWriteBinaryFile(const std::string&       fileName,
+                                const char*              magic,
+                                const uint32_t           version,
+                                const std::vector<char>& payload)
+{
+   std::string   tmpName = fileName + ".tmp";
+   std::ofstream os(tmpName.c_str(), std::ios::out | std::ios::binary);
+
+   if (!os) {
+      return false;
+   }
+
+   char     mag[8];
+   uint32_t byteOrder = 0x01020304;
+   uint64_t size      = static_cast<uint64_t>(payload.size());
+   uint64_t checksum  = UtilFnv1a(size ? &payload[0] : 0, payload.size());
+   memset(mag, 0, 8);
+   strncpy(mag, magic, 8);
+   os.write(mag, 8);
+   os.write(reinterpret_cast<const char*>(&version),   sizeof(version));
+   os.write(reinterpret_cast<const char*>(&byteOrder), sizeof(byteOrder));
+   os.write(reinterpret_cast<const char*>(&size),      sizeof(size));
+   os.write(reinterpret_cast<const char*>(&checksum),  sizeof(checksum));
+
+   if (size) {
+      os.write(&payload[0], payload.size());
+   }
+
+   os.close();
+
+   if (!os) {
+      std::remove(tmpName.c_str());
+      return false;
+   }
+
+   return std::rename(tmpName.c_str(), fileName.c_str()) == 0;
+}
+
+// ------------------------------------------------------------------------- //
+/**
+ * Read and validate header and payload. Returns false, with a reason in
+ * errMsg, if the file is missing or does not validate.
+ */
+inline bool UtilReadBinaryFile(const std::string& fileName,
+                               const char*        magic,
+                               const uint32_t     version,
+                               std::vector<char>& payload,
+                               std::string&       errMsg)
+{
+   std::ifstream is(fileName.c_str(), std::ios::in | std::ios::binary);
+
+   if (!is) {
+      errMsg = "cannot open " + fileName;
+      return false;
+   }
+
+   char     mag[8], expect[8];
+   uint32_t fileVersion = 0, byteOrder = 0;
+   uint64_t size = 0, checksum = 0;
+   memset(expect, 0, 8);
+   strncpy(expect, magic, 8);
+   is.read(mag, 8);
+   is.read(reinterpret_cast<char*>(&fileVersion), sizeof(fileVersion));
+   is.read(reinterpret_cast<char*>(&byteOrder),   sizeof(byteOrder));
+   is.read(reinterpret_cast<char*>(&size),        sizeof(size));
+   is.read(reinterpret_cast<char*>(&checksum),    sizeof(checksum));
+
+   if (!is || memcmp(mag, expect, 8) != 0) {
+      errMsg = "bad header";
+      return false;
+   }
+
+   if (byteOrder != 0x01020304) {
+      errMsg = "written with a different byte order";
+      return false;
+   }
+
+   if (fileVersion != version) {
+      errMsg = "unsupported version";
+      return false;
+   }
+
+   payload.resize(static_cast<size_t>(size));
+
+   if (size) {
+      is.read(&payload[0], payload.size());
+   }
+
+   if (!is) {
+      errMsg = "truncated file";
+      return false;
+   }
+
+   if (UtilFnv1a(size ? &payload[0] : 0, payload.size()) != checksum) {
+      errMsg = "checksum mismatch";
+      return false;
+   }
+
+   return true;
+}
+
+#endif
@@ -31,6 +31,44 @@ using namespace std;
 //---  MSVS-2005/SP1 fixes the issue.
 //---
 
+static bool utilCompactHash = false;
+
+// --------------------------------------------------------------------- //
+void UtilSetCompactHash(const bool compact)
+{
+   utilCompactHash = compact;
+}
+
+// --------------------------------------------------------------------- //
+bool UtilGetCompactHash()
+{
+   return utilCompactHash;
+}
+
+// --------------------------------------------------------------------- //
+static string UtilCompactHash(const string& text)
+{
+   //---
+   //--- 64-bit FNV-1a, the top 60 bits as 15 hex digits
+   //---
+   static const char hexDigit[] = "0123456789abcdef";
+   unsigned long long h = 14695981039346656037ULL;
+
+   for (size_t i = 0; i < text.size(); i++) {
+      h ^= static_cast<unsigned char>(text[i]);
+      h *= 1099511628211ULL;
+   }
+
+   string hash(15, '0');
+
+   for (int k = 14; k >= 0; k--) {
+      h >>= 4;
+      hash[k] = hexDigit[h & 0xf];
+   }
+
+   return hash;
+}
+
 // --------------------------------------------------------------------- //
 string UtilCreateStringHash(const int      len,
                             const double* els,
@@ -45,25 +83,32 @@ string UtilCreateStringHash(const int      len,
       }
    }
 
-   return ss.str();
+   return utilCompactHash ? UtilCompactHash(ss.str()) : ss.str();
 }
 
 // --------------------------------------------------------------------- //
-string UtilCreateStringHash(const int      len,
-                            const int*     ind,
-                            const double* els,
-                            const int      precision)
+static void UtilStringHashText(stringstream&  ss,
+                               const int      len,
+                               const int*     ind,
+                               const double* els)
 {
-   stringstream ss;
-   ss << setprecision(precision);
-
    for (int i = 0; i < len; i++) {
       if (!UtilIsZero(els[i])) {
          ss << ind[i] << "_" << els[i] << "_";
       }
    }
+}
 
-   return ss.str();
+// --------------------------------------------------------------------- //
+string UtilCreateStringHash(const int      len,
+                            const int*     ind,
+                            const double* els,
+                            const int      precision)
+{
+   stringstream ss;
+   ss << setprecision(precision);
+   UtilStringHashText(ss, len, ind, els);
+   return utilCompactHash ? UtilCompactHash(ss.str()) : ss.str();
 }
 
 // --------------------------------------------------------------------- //
@@ -81,7 +126,7 @@ string UtilCreateStringHash(const int      len,
       }
    }
 
-   return ss.str();
+   return utilCompactHash ? UtilCompactHash(ss.str()) : ss.str();
 }
 
 // --------------------------------------------------------------------- //
@@ -105,8 +150,8 @@ string UtilCreateStringHash(const int      len,
    }
 
    ss << "_" << sense << "_";
-   ss << UtilCreateStringHash(len, ind, els, precision);
-   return ss.str();
+   UtilStringHashText(ss, len, ind, els);
+   return utilCompactHash ? UtilCompactHash(ss.str()) : ss.str();
 }
 
 
@@ -18,6 +18,18 @@
 
 #include <string>
 
+/**
+ * Compact hashes: instead of the full text of the vector (which can be
+ * as long as the vector itself), the hashes are a 60-bit hash value of
+ * that text written as 15 hex digits, which fits in the short string
+ * buffer of std::string (no heap allocation). Equal vectors still have
+ * equal hashes; different vectors collide with negligible probability.
+ * This is a global switch, set it before any hash is made (see the
+ * LowMemory parameter).
+ */
+void UtilSetCompactHash(const bool compact);
+bool UtilGetCompactHash();
+
 std::string UtilCreateStringHash(const int      len,
                                  const double* els,
                                  const int      precision = 6);
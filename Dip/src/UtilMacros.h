@@ -605,6 +605,38 @@ inline void UtilPrintMemUsage(std::ostream*   os       = &std::cout,
 #endif
 }
 
+// ------------------------------------------------------------------------- //
+/**
+ * Approximate bytes used by a string: the object plus its heap buffer
+ * (short strings are stored in the object itself).
+ */
+inline double UtilStringBytes(const std::string& s)
+{
+   const size_t shortCap = std::string().capacity();
+   return static_cast<double>(sizeof(std::string) +
+                              (s.capacity() > shortCap ? s.capacity() + 1 : 0));
+}
+
+// ------------------------------------------------------------------------- //
+inline double UtilStringBytes(const std::vector<std::string>& v)
+{
+   double bytes = static_cast<double>((v.capacity() - v.size()) *
+                                      sizeof(std::string));
+
+   for (size_t i = 0; i < v.size(); i++) {
+      bytes += UtilStringBytes(v[i]);
+   }
+
+   return bytes;
+}
+
+// ------------------------------------------------------------------------- //
+template <class T>
+inline double UtilVectorBytes(const std::vector<T>& v)
+{
+   return static_cast<double>(v.capacity() * sizeof(T));
+}
+
 // ------------------------------------------------------------------------- //
 template <class T>
 void UtilDeleteVectorPtr(std::vector<T*>& vectorPtr,
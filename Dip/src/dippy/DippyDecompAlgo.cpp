@@ -23,6 +23,7 @@ bool DippyAlgoMixin::chooseBranchSet(DecompAlgo* algo,
 					       upBranchLB, upBranchUB);
    }
 
+   DippyGILState gil;
    DippyDecompApp* app = (DippyDecompApp*)algo->getDecompApp();
    // copy the current solution into a Python list
    const double* xhat = algo->getXhat();
@@ -98,12 +99,13 @@ bool DippyAlgoMixin::chooseBranchSet(DecompAlgo* algo,
 void DippyAlgoMixin::postProcessBranch(DecompAlgo* algo, 
 				       DecompStatus decompStatus)
 {
-   PyObject* pOutput = PyList_New(0);
-
    if (!m_utilParam->GetSetting("pyPostProcessBranch", true)) {
       return;
    }
 
+   DippyGILState gil;
+   PyObject* pOutput = PyList_New(0);
+
    AlpsDecompTreeNode* node = (AlpsDecompTreeNode*)algo->getCurrentNode();
    double quality = node->getQuality();
 
@@ -141,6 +143,8 @@ void DippyAlgoMixin::postProcessNode(DecompAlgo* algo, DecompStatus decompStatus
       return;
    }
 
+   DippyGILState gil;
+
    PyObject* pOutput = pyTupleList_FromNode(algo, decompStatus);
    char arg1[] = "postProcessNode";
    char arg2[] = "O";
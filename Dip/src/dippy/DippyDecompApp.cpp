@@ -330,20 +330,49 @@ DecompSolverStatus DippyDecompApp::solveRelaxed(const int whichBlock,
       return DecompSolStatNoSolution;
    }
 
-   PyObject* pRelaxKey = PyList_GetItem(m_relaxedKeys, whichBlock);
-   PyObject* pRedCostList = pyTupleList_FromDoubleArray(redCostX, m_colList);
-   PyObject* pConvexDual = PyFloat_FromDouble(convexDual);
-   // call solveRelaxed on DipProblem
-
-   char solveRelaxed[] = "solveRelaxed";
-   char OOd[] = "OOd";
-   PyObject* pStatandVarList = PyObject_CallMethod(m_pProb, solveRelaxed, OOd, 
-					             pRelaxKey,
-					             pRedCostList,
-					             pConvexDual);
+   DippyGILState gil;
 
-   Py_DECREF(pRedCostList);
-   Py_DECREF(pConvexDual);
+   PyObject* pRelaxKey = PyList_GetItem(m_relaxedKeys, whichBlock);
+   PyObject* pStatandVarList;
+
+   if (m_pyArrayExchange) {
+      // hand over the reduced costs without copying them, the view is
+      // released as soon as the callback returns
+      PyObject* pRedCostView = pyMemoryView_FromDoubleArray(redCostX, m_numCols);
+      char solveRelaxedArrays[] = "solveRelaxedArrays";
+      char OOd[] = "OOd";
+      pStatandVarList = PyObject_CallMethod(m_pProb, solveRelaxedArrays, OOd,
+                                            pRelaxKey,
+                                            pRedCostView,
+                                            convexDual);
+      // keep an exception raised by the callback pending across the
+      // release, a failed call is reported below rather than as a view
+      // still in use (the traceback may hold it)
+      PyObject* pType;
+      PyObject* pValue;
+      PyObject* pTrace;
+      PyErr_Fetch(&pType, &pValue, &pTrace);
+      bool released = pyMemoryView_Release(pRedCostView);
+      PyErr_Restore(pType, pValue, pTrace);
+      Py_DECREF(pRedCostView);
+
+      if (!released && pStatandVarList != NULL) {
+         Py_DECREF(pStatandVarList);
+         throw UtilException("Reduced cost array still in use after "
+                             "prob.solveRelaxedArrays() (copy it to keep it)",
+                             "solveRelaxed", "DippyDecompApp");
+      }
+   } else {
+      PyObject* pRedCostList = pyTupleList_FromDoubleArray(redCostX, m_colList);
+      // call solveRelaxed on DipProblem
+      char solveRelaxed[] = "solveRelaxed";
+      char OOd[] = "OOd";
+      pStatandVarList = PyObject_CallMethod(m_pProb, solveRelaxed, OOd,
+                                            pRelaxKey,
+                                            pRedCostList,
+                                            convexDual);
+      Py_DECREF(pRedCostList);
+   }
 
    if ( (pStatandVarList == NULL) || (pStatandVarList == Py_None) ){
       throw UtilException("Error calling method prob.solveRelaxed()", "solveRelaxed",
@@ -371,31 +400,84 @@ DecompSolverStatus DippyDecompApp::solveRelaxed(const int whichBlock,
 
    // solveRelaxed returns 3-tuples (cost, reduced cost, dictionary of (variable, value) pairs)
    // We can use these to construct a C++ DecompVar objects
+   //
+   // solveRelaxedArrays returns 4-tuples (cost, reduced cost, indices, values)
+   // or 2-tuples (indices, values), for which we compute the costs; indices
+   // and values are arrays (NumPy, array.array, ...) or sequences
    double cost, rc;
-   PyObject* pTuple, *pDict, *pKeys, *pCol;
-   string name;
-   double value;
+   PyObject* pTuple, *pDict, *pCol, *pValue;
+   Py_ssize_t pos;
+   map<PyObject*, int>::const_iterator it;
 
    for (int j = 0; j < nVars; j++) {
       pTuple = PySequence_GetItem(pVarList, j);
-      cost   = PyFloat_AsDouble(PyTuple_GetItem(pTuple, 0));
-      rc     = PyFloat_AsDouble(PyTuple_GetItem(pTuple, 1));
-
-      pDict = PyTuple_GetItem(pTuple, 2);
-      pKeys = PyDict_Keys(pDict);
+      int len = PyObject_Length(pTuple);
       vector<int>    varInds;
       vector<double> varVals;
 
-      for (int n = 0; n < PyObject_Length(pDict); n++) {
-         pCol  = PyList_GetItem(pKeys, n);
-         value = PyFloat_AsDouble(PyDict_GetItem(pDict, pCol));
-         varInds.push_back(m_colIndices[pCol]);
-         varVals.push_back(value);
+      if (len == 3) {
+         cost   = PyFloat_AsDouble(PyTuple_GetItem(pTuple, 0));
+         rc     = PyFloat_AsDouble(PyTuple_GetItem(pTuple, 1));
+         pDict  = PyTuple_GetItem(pTuple, 2);
+         pos    = 0;
+
+         while (PyDict_Next(pDict, &pos, &pCol, &pValue)) {
+            it = m_colIndices.find(pCol);
+
+            if (it == m_colIndices.end()) {
+               throw UtilException("Unknown variable in column", "solveRelaxed",
+                                   "DippyDecompApp");
+            }
+
+            varInds.push_back(it->second);
+            varVals.push_back(PyFloat_AsDouble(pValue));
+         }
+      } else if (m_pyArrayExchange && (len == 2 || len == 4)) {
+         PyObject* pInds = PySequence_GetItem(pTuple, len - 2);
+         PyObject* pVals = PySequence_GetItem(pTuple, len - 1);
+         pyArray_AsIntVector(pInds, varInds);
+         pyArray_AsDoubleVector(pVals, varVals);
+         Py_DECREF(pInds);
+         Py_DECREF(pVals);
+
+         if (varInds.size() != varVals.size()) {
+            throw UtilException("Index and value arrays of a column differ in length",
+                                "solveRelaxed", "DippyDecompApp");
+         }
+
+         cost = 0.0;
+         rc   = 0.0;
+
+         for (unsigned k = 0; k < varInds.size(); k++) {
+            if (varInds[k] < 0 || varInds[k] >= m_numCols) {
+               throw UtilException("Bad index in column", "solveRelaxed",
+                                   "DippyDecompApp");
+            }
+
+            cost += m_objective[varInds[k]] * varVals[k];
+            rc   += redCostX[varInds[k]] * varVals[k];
+         }
+
+         if (len == 4) {
+            PyObject* pCost = PySequence_GetItem(pTuple, 0);
+            PyObject* pRc   = PySequence_GetItem(pTuple, 1);
+            cost = PyFloat_AsDouble(pCost);
+            rc   = PyFloat_AsDouble(pRc);
+            Py_DECREF(pCost);
+            Py_DECREF(pRc);
+         }
+      } else {
+         throw UtilException("Bad column returned by the relaxed solver",
+                             "solveRelaxed", "DippyDecompApp");
       }
 
-      Py_DECREF(pKeys);
       Py_DECREF(pTuple);
 
+      if (PyErr_Occurred()) {
+         throw UtilException("Bad column returned by the relaxed solver",
+                             "solveRelaxed", "DippyDecompApp");
+      }
+
       DecompVar* var =  new DecompVar(varInds, varVals, rc, cost);
       var->setBlockId(whichBlock);
       varList.push_back(var);
@@ -416,12 +498,14 @@ DecompSolverStatus DippyDecompApp::solveRelaxed(const int whichBlock,
 bool DippyDecompApp::APPisUserFeasible(const double* x, const int n_cols, const double tolZero)
 {
    assert(n_cols == m_modelCore.getModel()->getColNames().size());
-   PyObject* pSolutionList = pyTupleList_FromDoubleArray(x, m_colList);
-   PyObject* pTolZero = PyFloat_FromDouble(tolZero);
 
    if (!m_pyIsUserFeasible) {
       return true;
    }
+
+   DippyGILState gil;
+   PyObject* pSolutionList = pyTupleList_FromDoubleArray(x, m_colList);
+   PyObject* pTolZero = PyFloat_FromDouble(tolZero);
    char isUserFeasible[] = "isUserFeasible";
    char Od[] = "Od";
    PyObject* pResult = PyObject_CallMethod(m_pProb, isUserFeasible, Od, pSolutionList, pTolZero);
@@ -455,6 +539,8 @@ int DippyDecompApp::generateCuts(const double* x, DecompCutList& cutList)
       return 0;
    }
 
+   DippyGILState gil;
+
    // PyObject *pSolutionList = pyTupleList_FromDoubleArray(x, m_colList);
    // MO (28/2/2012) - Don't need this anymore as solution is contained within node
    PyObject* pPackagedNode = pyTupleList_FromNode(getDecompAlgo(), STAT_FEASIBLE);
@@ -525,6 +611,8 @@ int DippyDecompApp::APPheuristics(const double* xhat, const double* origCost, ve
       return 0;
    }
 
+   DippyGILState gil;
+
    PyObject* pSolution = pyTupleList_FromDoubleArray(xhat, m_colList);
    PyObject* pObjective = pyTupleList_FromDoubleArray(origCost, m_colList);
    char solveHeuristics[] = "solveHeuristics";
@@ -582,6 +670,8 @@ int DippyDecompApp::generateInitVars(DecompVarList& initVars)
       return 0;
    }
 
+   DippyGILState gil;
+
    char generateInitVars[] = "generateInitVars";
    PyObject* pVarList = PyObject_CallMethod(m_pProb, generateInitVars, NULL);
 
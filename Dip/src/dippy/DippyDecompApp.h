@@ -40,6 +40,9 @@ private:
    bool m_pyHeuristics;
    bool m_pyInitVars;
 
+   /** Exchange reduced costs and columns with Python as arrays. */
+   bool m_pyArrayExchange;
+
 public:
    /** @name Helper functions (public). */
 
@@ -87,6 +90,7 @@ public:
       m_pyGenerateCuts   = utilParam.GetSetting("pyGenerateCuts", true);
       m_pyHeuristics     = utilParam.GetSetting("pyHeuristics", true);
       m_pyInitVars       = utilParam.GetSetting("pyInitVars", true);
+      m_pyArrayExchange  = utilParam.GetSetting("pyArrayExchange", false);
    }
 
    virtual ~DippyDecompApp() {
@@ -179,18 +179,21 @@ PyObject* pyTupleList_FromNode(DecompAlgo* algo, DecompStatus decompStatus)
  * and coefficients as values
  *
  */
-void pyColDict_AsPairedVector(PyObject* pColDict, vector<pair<int, double> >& vec, map<PyObject*, int> indices)
+void pyColDict_AsPairedVector(PyObject* pColDict, vector<pair<int, double> >& vec,
+                              const map<PyObject*, int>& indices)
 {
    int len = PyObject_Length(pColDict);
    vec.clear();
    PyObject* pKeys = PyDict_Keys(pColDict), *pCol;
    double value;
    int index;
+   map<PyObject*, int>::const_iterator it;
 
    for (int i = 0; i < len; i++) {
       pCol = PyList_GetItem(pKeys, i);
       value = PyFloat_AsDouble(PyDict_GetItem(pColDict, pCol));
-      index = indices[pCol];
+      it    = indices.find(pCol);
+      index = (it == indices.end()) ? -1 : it->second;
 
       if ( (index < 0) || (index >= indices.size()) ) {
 	 char str[] = "__str__";
@@ -221,7 +224,8 @@ void pyColDict_AsPairedVector(PyObject* pColDict, vector<pair<int, double> >& ve
  *
  * Returns length of index and value arrays
  */
-int pyColDict_AsPackedArrays(PyObject* pColDict, map<PyObject*, int> indices, int** inds, double** vals)
+int pyColDict_AsPackedArrays(PyObject* pColDict, const map<PyObject*, int>& indices,
+                             int** inds, double** vals)
 {
    int len = PyObject_Length(pColDict);
    *inds = new int[len];
@@ -230,11 +234,13 @@ int pyColDict_AsPackedArrays(PyObject* pColDict, map<PyObject*, int> indices, in
    PyObject* pCol;
    double value;
    int index;
+   map<PyObject*, int>::const_iterator it;
 
    for (int i = 0; i < len; i++) {
       pCol = PyList_GetItem(pKeys, i);
       value = PyFloat_AsDouble(PyDict_GetItem(pColDict, pCol));
-      index = indices[pCol];
+      it    = indices.find(pCol);
+      index = (it == indices.end()) ? -1 : it->second;
 
       if ( (index < 0) || (index >= indices.size()) ) {
 	char getName[] = "getName";
@@ -259,7 +265,8 @@ int pyColDict_AsPackedArrays(PyObject* pColDict, map<PyObject*, int> indices, in
    return len;
 }
 
-int pyColDict_AsPackedArrays(PyObject* pColDict, map<PyObject*, int> indices, int** inds, double** vals, DecompVarType& varType)
+int pyColDict_AsPackedArrays(PyObject* pColDict, const map<PyObject*, int>& indices,
+                             int** inds, double** vals, DecompVarType& varType)
 {
    int len = PyObject_Length(pColDict);
    *inds = new int[len];
@@ -268,11 +275,13 @@ int pyColDict_AsPackedArrays(PyObject* pColDict, map<PyObject*, int> indices, in
    PyObject* pCol;
    double value;
    int index;
+   map<PyObject*, int>::const_iterator it;
 
    for (int i = 0; i < len; i++) {
       pCol = PyList_GetItem(pKeys, i);
       value = PyFloat_AsDouble(PyDict_GetItem(pColDict, pCol));
-      index = indices[pCol];
+      it    = indices.find(pCol);
+      index = (it == indices.end()) ? -1 : it->second;
 
       if ( (index < 0) || (index >= indices.size()) ) {
 	char getName[] = "getName";
@@ -312,13 +321,14 @@ int pyColDict_AsPackedArrays(PyObject* pColDict, map<PyObject*, int> indices, in
  */
 
 CoinPackedMatrix* pyConstraints_AsPackedMatrix(PyObject* pRowList,
-      map<PyObject*, int> rowIndices, map<PyObject*, int> colIndices)
+      const map<PyObject*, int>& rowIndices, const map<PyObject*, int>& colIndices)
 {
    int len = PyObject_Length(pRowList);
    int rowInd, colInd, num;
    string rowName, colName;
    double val, lb, ub;
    PyObject* pRow, *pKeys, *pCol;
+   map<PyObject*, int>::const_iterator it;
    // First get the total number of non-zeros from all the tuples
    int numNZs = 0;
 
@@ -339,13 +349,27 @@ CoinPackedMatrix* pyConstraints_AsPackedMatrix(PyObject* pRowList,
 
    for (int i = 0; i < len; i++) {
       pRow = PyList_GetItem(pRowList, i);
-      rowInd = rowIndices[pRow];
+      it = rowIndices.find(pRow);
+
+      if (it == rowIndices.end()) {
+         throw UtilException("Unknown row", "pyConstraints_AsPackedMatrix",
+                             "DippyPythonUtils");
+      }
+
+      rowInd = it->second;
       pKeys = PyDict_Keys(pRow);
       num = PyObject_Length(pKeys);
 
       for (int n = 0; n < num; n++) {
          pCol = PyList_GetItem(pKeys, n);
-         colInd = colIndices[pCol];
+         it = colIndices.find(pCol);
+
+         if (it == colIndices.end()) {
+            throw UtilException("Unknown column", "pyConstraints_AsPackedMatrix",
+                                "DippyPythonUtils");
+         }
+
+         colInd = it->second;
          val = PyFloat_AsDouble(PyDict_GetItem(pRow, pCol));
          rowInds[start + n] = rowInd;
          colInds[start + n] = colInd;
@@ -360,6 +384,177 @@ CoinPackedMatrix* pyConstraints_AsPackedMatrix(PyObject* pRowList,
    return new CoinPackedMatrix(false, rowInds, colInds, values, numNZs);
 }
 
+/**
+ * Wrap a double array in a read-only Python memoryview (format 'd')
+ *
+ * The array is not copied, so the view must be released with
+ * pyMemoryView_Release before the array goes away
+ */
+PyObject* pyMemoryView_FromDoubleArray(const double* values, int len)
+{
+   // A view of the raw bytes, cast to doubles so it can be indexed and
+   // given to numpy.frombuffer as is
+   PyObject* pBytes = PyMemoryView_FromMemory(const_cast<char*>(
+                                                 reinterpret_cast<const char*>(values)),
+                                              len * sizeof(double), PyBUF_READ);
+
+   if (pBytes == NULL) {
+      throw UtilException("Error creating memoryview", "pyMemoryView_FromDoubleArray",
+                          "DippyPythonUtils");
+   }
+
+   char cast[] = "cast";
+   char s[] = "s";
+   char d[] = "d";
+   PyObject* pView = PyObject_CallMethod(pBytes, cast, s, d);
+   Py_DECREF(pBytes);
+
+   if (pView == NULL) {
+      throw UtilException("Error calling method memoryview.cast()",
+                          "pyMemoryView_FromDoubleArray", "DippyPythonUtils");
+   }
+
+   return pView;
+}
+
+/**
+ * Release a memoryview, so any further access to it from Python fails
+ *
+ * Returns false if the view is still exported (e.g., a NumPy array
+ * on top of it was kept by the user)
+ */
+bool pyMemoryView_Release(PyObject* pView)
+{
+   char release[] = "release";
+   PyObject* pResult = PyObject_CallMethod(pView, release, NULL);
+
+   if (pResult == NULL) {
+      PyErr_Clear();
+      return false;
+   }
+
+   Py_DECREF(pResult);
+   return true;
+}
+
+/**
+ * Copy len items of type S from buf to vec
+ */
+template <class S, class T>
+static void pyBuffer_Copy(const void* buf, Py_ssize_t len, vector<T>& vec)
+{
+   const S* src = static_cast<const S*>(buf);
+   vec.resize(len);
+
+   for (Py_ssize_t i = 0; i < len; i++) {
+      vec[i] = static_cast<T>(src[i]);
+   }
+}
+
+/**
+ * Copy an array to vec, through the buffer protocol if the array
+ * supports it (no element is converted to a Python object), otherwise
+ * as a sequence
+ *
+ * Returns false if the buffer format does not fit (floating point
+ * values for integers, byte order that is not native, ...)
+ */
+template <class T>
+static bool pyArray_AsVector(PyObject* pArray, vector<T>& vec, bool integral)
+{
+   vec.clear();
+
+   if (PyObject_CheckBuffer(pArray)) {
+      Py_buffer view;
+
+      if (PyObject_GetBuffer(pArray, &view, PyBUF_FORMAT | PyBUF_C_CONTIGUOUS) != 0) {
+         PyErr_Clear();
+         return false;
+      }
+
+      const char* format = view.format ? view.format : "B";
+
+      if (*format == '@' || *format == '=') {
+         format++;
+      }
+
+      Py_ssize_t len = view.itemsize > 0 ? view.len / view.itemsize : 0;
+      bool ok = format[0] != '\0' && format[1] == '\0';
+
+      switch (ok ? format[0] : ' ') {
+      case 'b': pyBuffer_Copy<signed char>(view.buf, len, vec); break;
+      case 'B': pyBuffer_Copy<unsigned char>(view.buf, len, vec); break;
+      case 'h': pyBuffer_Copy<short>(view.buf, len, vec); break;
+      case 'H': pyBuffer_Copy<unsigned short>(view.buf, len, vec); break;
+      case 'i': pyBuffer_Copy<int>(view.buf, len, vec); break;
+      case 'I': pyBuffer_Copy<unsigned int>(view.buf, len, vec); break;
+      case 'l': pyBuffer_Copy<long>(view.buf, len, vec); break;
+      case 'L': pyBuffer_Copy<unsigned long>(view.buf, len, vec); break;
+      case 'q': pyBuffer_Copy<long long>(view.buf, len, vec); break;
+      case 'Q': pyBuffer_Copy<unsigned long long>(view.buf, len, vec); break;
+      case 'f': ok = !integral; if (ok) pyBuffer_Copy<float>(view.buf, len, vec); break;
+      case 'd': ok = !integral; if (ok) pyBuffer_Copy<double>(view.buf, len, vec); break;
+      default:  ok = false;
+      }
+
+      PyBuffer_Release(&view);
+      return ok;
+   }
+
+   PyObject* pSeq = PySequence_Fast(pArray, "not a sequence");
+
+   if (pSeq == NULL) {
+      PyErr_Clear();
+      return false;
+   }
+
+   Py_ssize_t len = PySequence_Fast_GET_SIZE(pSeq);
+   vec.resize(len);
+
+   for (Py_ssize_t i = 0; i < len; i++) {
+      PyObject* pItem = PySequence_Fast_GET_ITEM(pSeq, i);
+      vec[i] = integral ? static_cast<T>(PyLong_AsLong(pItem))
+               : static_cast<T>(PyFloat_AsDouble(pItem));
+   }
+
+   Py_DECREF(pSeq);
+
+   if (PyErr_Occurred()) {
+      PyErr_Clear();
+      return false;
+   }
+
+   return true;
+}
+
+/**
+ * Convert an array of integers to a vector
+ *
+ * The array is an object with the buffer protocol (a NumPy array, an
+ * array.array, ...) or, otherwise, any sequence of numbers
+ */
+void pyArray_AsIntVector(PyObject* pArray, vector<int>& vec)
+{
+   if (!pyArray_AsVector(pArray, vec, true)) {
+      throw UtilException("Expected an array or a sequence of integers",
+                          "pyArray_AsIntVector", "DippyPythonUtils");
+   }
+}
+
+/**
+ * Convert an array of numbers to a vector
+ *
+ * The array is an object with the buffer protocol (a NumPy array, an
+ * array.array, ...) or, otherwise, any sequence of numbers
+ */
+void pyArray_AsDoubleVector(PyObject* pArray, vector<double>& vec)
+{
+   if (!pyArray_AsVector(pArray, vec, false)) {
+      throw UtilException("Expected an array or a sequence of numbers",
+                          "pyArray_AsDoubleVector", "DippyPythonUtils");
+   }
+}
+
 /**
  * Creates a (key,value) tuple and appends to a Python list of tuples *
  */
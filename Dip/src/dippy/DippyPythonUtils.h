@@ -10,6 +10,43 @@
 #include <vector>
 using namespace std;
 
+/**
+ * Holds the GIL for its scope
+ *
+ * DIP runs without the GIL (see DippyAllowThreads), so every callback
+ * into Python takes it first, whichever thread (e.g., an OpenMP thread
+ * pricing a block) it is called from
+ */
+class DippyGILState {
+   PyGILState_STATE m_state;
+
+   DippyGILState(const DippyGILState&);
+   DippyGILState& operator=(const DippyGILState&);
+
+public:
+   DippyGILState() : m_state(PyGILState_Ensure()) {}
+   ~DippyGILState() {
+      PyGILState_Release(m_state);
+   }
+};
+
+/**
+ * Releases the GIL for its scope, so DIP's own work runs while other
+ * Python threads (and the callbacks of other DIP threads) go on
+ */
+class DippyAllowThreads {
+   PyThreadState* m_state;
+
+   DippyAllowThreads(const DippyAllowThreads&);
+   DippyAllowThreads& operator=(const DippyAllowThreads&);
+
+public:
+   DippyAllowThreads() : m_state(PyEval_SaveThread()) {}
+   ~DippyAllowThreads() {
+      PyEval_RestoreThread(m_state);
+   }
+};
+
 // Some convenience functions for converting between Python objects and
 // C/C++ data structures
 
@@ -39,7 +76,8 @@ PyObject* pyTupleList_FromNode(DecompAlgo* algo, DecompStatus decompStatus);
  * and coefficients as values
  *
  */
-void pyColDict_AsPairedVector(PyObject* pColDict, vector< pair<int, double> >& vector, map<PyObject*, int> indices);
+void pyColDict_AsPairedVector(PyObject* pColDict, vector< pair<int, double> >& vector,
+                              const map<PyObject*, int>& indices);
 
 /**
  * Convert a column dictionary to packed arrays
@@ -49,9 +87,11 @@ void pyColDict_AsPairedVector(PyObject* pColDict, vector< pair<int, double> >& v
  *
  * Returns length of index and value arrays
  */
-int pyColDict_AsPackedArrays(PyObject* pColDict, map<PyObject*, int> indices, int** inds, double** vals);
+int pyColDict_AsPackedArrays(PyObject* pColDict, const map<PyObject*, int>& indices,
+                             int** inds, double** vals);
 
-int pyColDict_AsPackedArrays(PyObject* pColDict, map<PyObject*, int> indices, int** inds, double** vals, DecompVarType & varType);
+int pyColDict_AsPackedArrays(PyObject* pColDict, const map<PyObject*, int>& indices,
+                             int** inds, double** vals, DecompVarType & varType);
 
 /**
  * Convert a list of Python constraints to a CoinPackedMatrix
@@ -61,7 +101,39 @@ int pyColDict_AsPackedArrays(PyObject* pColDict, map<PyObject*, int> indices, in
  */
 
 CoinPackedMatrix* pyConstraints_AsPackedMatrix(PyObject* pRowList,
-      map<PyObject*, int> rowIndices, map<PyObject*, int> colIndices);
+      const map<PyObject*, int>& rowIndices, const map<PyObject*, int>& colIndices);
+
+/**
+ * Wrap a double array in a read-only Python memoryview (format 'd')
+ *
+ * The array is not copied, so the view must be released with
+ * pyMemoryView_Release before the array goes away
+ */
+PyObject* pyMemoryView_FromDoubleArray(const double* values, int len);
+
+/**
+ * Release a memoryview, so any further access to it from Python fails
+ *
+ * Returns false if the view is still exported (e.g., a NumPy array
+ * on top of it was kept by the user)
+ */
+bool pyMemoryView_Release(PyObject* pView);
+
+/**
+ * Convert an array of integers to a vector
+ *
+ * The array is an object with the buffer protocol (a NumPy array, an
+ * array.array, ...) or, otherwise, any sequence of numbers
+ */
+void pyArray_AsIntVector(PyObject* pArray, vector<int>& vec);
+
+/**
+ * Convert an array of numbers to a vector
+ *
+ * The array is an object with the buffer protocol (a NumPy array, an
+ * array.array, ...) or, otherwise, any sequence of numbers
+ */
+void pyArray_AsDoubleVector(PyObject* pArray, vector<double>& vec);
 
 /**
  * Creates a (key,value) tuple and appends to a Python list of tuples *
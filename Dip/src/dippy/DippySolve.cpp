@@ -96,7 +96,11 @@ DLLEXPORT PyObject* Solve(PyObject* self, PyObject* args)
       }
 
       AlpsDecompModel alpsModel(utilParam, algo);
-      alpsModel.solve();
+      {
+         // the callbacks take the GIL back when they need it
+         DippyAllowThreads allowThreads;
+         alpsModel.solve();
+      }
       // TODO: Python exception needs to be set here or higher
       int status = alpsModel.getSolStatus();
       PyObject* pStatus;
@@ -4,6 +4,7 @@ from builtins import str
 from past.builtins import basestring
 from builtins import object
 import pulp
+import multiprocessing
 
 import sys
 
@@ -35,6 +36,21 @@ if gimpy_installed:
 else:
     grumpy_installed = False
 
+try:
+    import numpy
+except ImportError:
+    numpy_installed = False
+else:
+    numpy_installed = True
+
+try:
+    import concurrent.futures
+    from multiprocessing import shared_memory
+except ImportError:
+    pricing_pool_available = False
+else:
+    pricing_pool_available = True
+
 class DipError(Exception):
     """
     Dip Exception
@@ -95,6 +111,24 @@ def Solve(prob, params=None):
         params['pyPostProcessBranch'] = '0'
     if prob.relaxed_solver == None:
         params['pyRelaxedSolver'] = '0'
+    pricing_pool = (prob.relaxed_solver is not None and
+                    prob.pricing_processes > 1)
+    if pricing_pool and not pricing_pool_available:
+        print("Pricing processes need Python 3.8, pricing serially")
+        pricing_pool = False
+    if pricing_pool:
+        # the blocks are priced concurrently by DIP's subproblem threads,
+        # each one waiting on its process without holding the GIL
+        decomp = params.get('DECOMP', {})
+        if 'SubProbParallel' not in params and \
+           'SubProbParallel' not in decomp:
+            params['SubProbParallel'] = '1'
+        if 'NumConcurrentThreadsSubProb' not in params and \
+           'NumConcurrentThreadsSubProb' not in decomp:
+            params['NumConcurrentThreadsSubProb'] = str(prob.pricing_processes)
+    if prob.array_exchange or pricing_pool:
+        params['pyArrayExchange'] = '1'
+        prob._column_index = None
     if prob.is_solution_feasible == None:
         params['pyIsSolutionFeasible'] = '0'
     
@@ -151,6 +185,8 @@ def Solve(prob, params=None):
         
     # call the Solve method from _dippy
     try:
+        if pricing_pool:
+            prob._pricing_pool = PricingPool(prob, prob.pricing_processes)
         status, message, solList, dualList = _Solve(prob, processed)
         # solList  is a list of (col_name, value) pairs
         # dualList is a list of (row_name, value) pairs
@@ -167,6 +203,10 @@ def Solve(prob, params=None):
         print("Error returned from _dippy")
         print(ex)
         raise
+    finally:
+        if prob._pricing_pool is not None:
+            prob._pricing_pool.close()
+            prob._pricing_pool = None
 
     if solList is None:
         solution = None
@@ -198,6 +238,65 @@ def Solve(prob, params=None):
     # return status, message, solution and duals
     return status, message, solution, duals
 
+# State of a pricing process, set by _pricingInit
+_pricingState = None
+
+def _pricingInit(prob, buf, numCols):
+    global _pricingState
+    _pricingState = (prob, buf, numCols)
+
+def _pricingStarted():
+    return True
+
+def _pricingSolve(slot, key, target):
+    """
+    Runs relaxed_solver in a pricing process on the reduced costs in
+    the given slot of the shared memory
+    """
+    prob, buf, numCols = _pricingState
+    start = slot * numCols * 8
+    if numpy_installed:
+        redCostX = numpy.frombuffer(buf, dtype=numpy.float64,
+                                    count=numCols, offset=start)
+    else:
+        redCostX = buf[start:start + numCols * 8].cast('d')
+    status, dvs = prob.relaxed_solver(prob, key, redCostX, target)
+    return status, prob.columnsAsArrays(dvs)
+
+class PricingPool(object):
+    """
+    Pool of processes running relaxed_solver (see pricing_processes)
+
+    The processes are forked when the solve starts, so they see the
+    problem as it is then. The reduced costs go through shared memory,
+    one slot for each relaxation, so only the key, the target and the
+    columns found (as index/value arrays) are pickled.
+    """
+    def __init__(self, prob, processes):
+        self.numCols = len(prob.variables())
+        self.slots = dict((key, i) for i, key in
+                          enumerate(prob.relaxation.keys()))
+        self.shm = shared_memory.SharedMemory(
+            create=True, size=max(len(self.slots) * self.numCols * 8, 8))
+        self.executor = concurrent.futures.ProcessPoolExecutor(
+            processes, mp_context=multiprocessing.get_context('fork'),
+            initializer=_pricingInit,
+            initargs=(prob, self.shm.buf, self.numCols))
+        # start the processes now, before DIP starts its threads
+        self.executor.submit(_pricingStarted).result()
+
+    def solve(self, key, redCostX, target):
+        slot = self.slots[key]
+        start = slot * self.numCols * 8
+        with redCostX.cast('B') as raw:
+            self.shm.buf[start:start + len(raw)] = raw
+        return self.executor.submit(_pricingSolve, slot, key, target).result()
+
+    def close(self):
+        self.executor.shutdown()
+        self.shm.close()
+        self.shm.unlink()
+
 def createBranchLabel(lbs, ubs):
     maxLabelWidth = 20
       
@@ -327,6 +426,12 @@ class DipProblem(pulp.LpProblem, DipAPI):
         self.display_interval = kwargs.pop('display_interval', 1)
         self.layout = kwargs.pop('layout', 'dot')
         self.svg_prefix = kwargs.pop('svg_prefix', 'tree')
+        # pass reduced costs and columns to/from relaxed_solver as arrays
+        self.array_exchange = kwargs.pop('array_exchange', False)
+        # run relaxed_solver in this many processes (implies array_exchange)
+        self.pricing_processes = kwargs.pop('pricing_processes', 1)
+        self._column_index = None
+        self._pricing_pool = None
         
         if self.display_mode != 'off':
             if not gimpy_installed:
@@ -869,6 +974,73 @@ class DipProblem(pulp.LpProblem, DipAPI):
             errorStr = "Error in solveRelaxed\n%s" % ex
             raise DipError(errorStr)
 
+    def getColumnIndex(self):
+        """
+        Returns a dictionary with the position of each variable in the
+        arrays exchanged with relaxed_solver when array_exchange is on
+        (the order of variables())
+        """
+        if self._column_index is None:
+            self._column_index = dict((v, j) for j, v in
+                                      enumerate(self.variables()))
+        return self._column_index
+
+    def columnsAsArrays(self, dvs):
+        """
+        Returns the columns dvs with the dictionaries of (variable, value)
+        pairs replaced by index and value lists
+        """
+        colIndex = self.getColumnIndex()
+        cols = []
+        for var in dvs:
+            if isinstance(var, dict):
+                var = ([colIndex[v] for v in var], list(var.values()))
+            elif len(var) == 3 and isinstance(var[2], dict):
+                cost, red_cost, var = var
+                var = (cost, red_cost, [colIndex[v] for v in var],
+                       list(var.values()))
+            cols.append(var)
+        return cols
+
+    def solveRelaxedArrays(self, key, redCostX, target):
+        """
+        Returns solutions to the whichBlock relaxed subproblem, exchanging
+        the data as arrays (array_exchange = True)
+
+        Inputs:
+        key (Python Object) = key of relaxed subproblem to be solved
+        redCostX (memoryview of doubles) = reduced costs of all variables,
+        in the order of getColumnIndex(); the memory belongs to DIP and is
+        only valid during the call, so copy anything to be kept
+        target (float) = any total reduced cost less than the target is "good" (results in a negative cost column)
+
+        relaxed_solver gets redCostX as a NumPy array (without a copy) if
+        NumPy is installed, as the memoryview otherwise. With
+        pricing_processes > 1, it runs in one of the pricing processes
+
+        Output:
+        status (integer) = status of the relaxation solve (see solveRelaxed)
+        varList (list of (indices, values) or (cost, reduced cost, indices,
+        values) tuples) = solution for this relaxed subproblem, indices
+        and values are arrays (NumPy, array.array, ...) or sequences of the
+        positions and values of the non-zero variables; cost and reduced
+        cost are computed by DIP when not given. Dictionaries of (variable,
+        value) pairs are also accepted, as for solveRelaxed
+        """
+        try:
+            if self._pricing_pool is not None:
+                return self._pricing_pool.solve(key, redCostX, target)
+
+            if numpy_installed:
+                redCostX = numpy.frombuffer(redCostX, dtype=numpy.float64)
+
+            status, dvs = self.relaxed_solver(self, key, redCostX, target)
+            return status, self.columnsAsArrays(dvs)
+
+        except Exception as ex:
+            errorStr = "Error in solveRelaxedArrays\n%s" % ex
+            raise DipError(errorStr)
+
     def isUserFeasible(self, sol, tol):
         """
         Lets the user decide if an integer solution is really feasible
@@ -1,6 +1,7 @@
 from __future__ import absolute_import
 from builtins import range
 import unittest
+from array import array
 from pulp import *
 import coinor.dippy as dippy
 
@@ -35,8 +36,42 @@ class TestCuttingStockProblem(DippyTestCase):
         self.variable_feasibility_test(self.prob)
         self.constraint_feasibility_test(self.prob)
 
+    def test_dippy_relaxation_arrays(self):
+        """
+        tests that the custom relaxed solver can solve the problem
+        exchanging reduced costs and columns as arrays
+        """
+        self.prob, self.relaxation = create_cutting_stock_problem(
+            doRelaxed=True, doArrays=True)
+        self.prob.relaxed_solver = self.relaxation
+        self.prob.array_exchange = True
+        dippy.Solve(self.prob, {
+            'doPriceCut':1,
+            'CutCGL': 0,
+        })
+        self.assertAlmostEqual(self.prob.objective.value(), 2.0)
+        self.variable_feasibility_test(self.prob)
+        self.constraint_feasibility_test(self.prob)
+
+    def test_dippy_relaxation_processes(self):
+        """
+        tests that the custom relaxed solver can solve the problem
+        in a pool of pricing processes
+        """
+        self.prob, self.relaxation = create_cutting_stock_problem(
+            doRelaxed=True, doArrays=True)
+        self.prob.relaxed_solver = self.relaxation
+        self.prob.pricing_processes = 2
+        dippy.Solve(self.prob, {
+            'doPriceCut':1,
+            'CutCGL': 0,
+        })
+        self.assertAlmostEqual(self.prob.objective.value(), 2.0)
+        self.variable_feasibility_test(self.prob)
+        self.constraint_feasibility_test(self.prob)
 
-def create_cutting_stock_problem(doRelaxed=False):
+
+def create_cutting_stock_problem(doRelaxed=False, doArrays=False):
     """
     creates and returns the cutting_stock problem
     """
@@ -151,6 +186,28 @@ def create_cutting_stock_problem(doRelaxed=False):
 
         return []
 
+    def relaxed_solver_arrays(prob, patt, redCosts, convexDual):
+        # redCosts is indexed by the positions of the variables
+        col = prob.getColumnIndex()
+        item_idx = [i for i in ITEMS \
+                    if redCosts[col[cutVars[(patt, i)]]] < 0]
+        obj = [-redCosts[col[cutVars[(patt, i)]]] for i in item_idx]
+        weights = [length[i] for i in item_idx]
+        z, solution = kp(obj, weights, total_length[patt])
+
+        if sum(solution) == 0 or \
+           -z + redCosts[col[useVars[patt]]] - convexDual >= 0:
+            return dippy.DipSolStatFeasible, []
+
+        # DIP computes the cost and reduced cost of (indices, values)
+        indices = array('i', [col[cutVars[(patt, i)]]
+                              for k, i in enumerate(item_idx)
+                              if solution[k] > 0])
+        values = array('d', [s for s in solution if s > 0])
+        indices.append(col[useVars[patt]])
+        values.append(1.0)
+        return dippy.DipSolStatFeasible, [(indices, values)]
+
     def kp(obj, weights, capacity):
         assert len(obj) == len(weights)
         n = len(obj)
@@ -178,6 +235,8 @@ def create_cutting_stock_problem(doRelaxed=False):
 
         return zbest, solbest
 
+    if doArrays:
+        return prob, relaxed_solver_arrays
     return prob, relaxed_solver
 
 
@@ -0,0 +1,262 @@
+#!/usr/bin/env python3
+#===========================================================================#
+# This file is part of the DIP Solver Framework.                            #
+#                                                                           #
+# DIP is distributed under the Eclipse Public License as part of the        #
+# COIN-OR repository (http://www.coin-or.org).                              #
+#                                                                           #
+# Copyright (C) 2002-2019, Lehigh University, Matthew Galati, Ted Ralphs    #
+# All Rights Reserved.                                                      #
+#===========================================================================#
+
+"""
+Benchmark suite over the example applications.
+
+Runs every instance of a suite file (see benchmark.suite) for each of the
+given thread counts, collects the summary each run writes to StatsFile
+(time to the root bound, total time, pricing and cutting calls, columns
+and cuts generated, master iterations, nodes, bounds) and the peak memory
+of the process,
+and compares the results to a stored baseline:
+
+  benchmark.py --build-dir .. --save-baseline     record the baseline
+  benchmark.py --build-dir ..                     compare against it
+
+Times and memory may grow by a relative tolerance (plus a small absolute
+slack for times); counts may grow by their own tolerance; bounds must
+match. The exit status is 1 if any run failed or regressed.
+"""
+
+import argparse
+import json
+import os
+import statistics
+import subprocess
+import sys
+import threading
+import time
+
+TIME_METRICS  = ['timeRootBound', 'timeTotal', 'wallTime']
+COUNT_METRICS = ['nodes', 'priceCalls', 'cutCalls',
+                 'colsGenerated', 'cutsGenerated', 'masterIters']
+BOUND_METRICS = ['rootBound', 'bestLB', 'bestUB']
+MEMORY_METRIC = 'peakMemoryMB'
+
+
+def read_suite(fileName):
+    suite = []
+    with open(fileName) as f:
+        for line in f:
+            fields = line.split()
+            if not fields or fields[0].startswith('#'):
+                continue
+            if len(fields) < 3:
+                sys.exit('%s: bad line: %s' % (fileName, line.rstrip()))
+            suite.append({'name': fields[0], 'dir': fields[1],
+                          'exe': fields[2], 'args': fields[3:]})
+    return suite
+
+
+def run_once(entry, threads, args, statsFile, logFile):
+    """Run one instance, returns the metrics (None if the run failed)."""
+    runDir = os.path.join(args.build_dir, entry['dir'])
+    exe    = os.path.join(os.path.abspath(runDir), entry['exe'])
+    cmd    = [exe] + entry['args'] + ['--DECOMP:StatsFile', statsFile]
+    if threads > 1:
+        cmd += ['--DECOMP:SubProbParallel', '1',
+                '--DECOMP:NumConcurrentThreadsSubProb', str(threads)]
+    if args.time_limit > 0:
+        cmd += ['--DECOMP:TimeLimit', str(args.time_limit)]
+    if os.path.exists(statsFile):
+        os.remove(statsFile)
+
+    with open(logFile, 'w') as log:
+        start = time.time()
+        try:
+            proc = subprocess.Popen(cmd, cwd=runDir, stdout=log,
+                                    stderr=subprocess.STDOUT)
+        except OSError as e:
+            print('  cannot run %s: %s' % (exe, e))
+            return None
+        killer = None
+        if args.timeout > 0:
+            killer = threading.Timer(args.timeout, proc.kill)
+            killer.start()
+        peakMemoryMB = None
+        if hasattr(os, 'wait4'):
+            #---
+            #--- wait4 gives the resource usage of this child alone
+            #---
+            _, status, usage = os.wait4(proc.pid, 0)
+            proc.returncode = os.waitstatus_to_exitcode(status) \
+                if hasattr(os, 'waitstatus_to_exitcode') else status
+            #ru_maxrss is in kilobytes on Linux and in bytes on macOS
+            scale = 1024.0 * 1024.0 if sys.platform == 'darwin' else 1024.0
+            peakMemoryMB = usage.ru_maxrss / scale
+        else:
+            proc.wait()
+        wallTime = time.time() - start
+        if killer:
+            killer.cancel()
+
+    if proc.returncode != 0 or not os.path.exists(statsFile):
+        print('  run failed (exit %s), see %s' % (proc.returncode, logFile))
+        return None
+    with open(statsFile) as f:
+        metrics = json.load(f)
+    metrics['wallTime']    = wallTime
+    metrics[MEMORY_METRIC] = peakMemoryMB
+    return metrics
+
+
+def run_suite(suite, args):
+    results = {}
+    if not os.path.isdir(args.output_dir):
+        os.makedirs(args.output_dir)
+    for threads in args.threads:
+        for entry in suite:
+            key = '%s@%d' % (entry['name'], threads)
+            print('running %s' % key)
+            base = os.path.abspath(os.path.join(args.output_dir, key))
+            runs = []
+            for r in range(args.repeat):
+                m = run_once(entry, threads, args, base + '.stats',
+                             base + '.log')
+                if m is None:
+                    runs = []
+                    break
+                runs.append(m)
+            if not runs:
+                results[key] = None
+                continue
+            #---
+            #--- median of the times and memory, the rest is deterministic
+            #---
+            merged = dict(runs[0])
+            for metric in TIME_METRICS + [MEMORY_METRIC]:
+                values = [m[metric] for m in runs if m.get(metric) is not None]
+                merged[metric] = statistics.median(values) if values else None
+            merged['repeat'] = len(runs)
+            results[key] = merged
+    return results
+
+
+def compare_metric(metric, base, new, args):
+    """Returns OK, IMPROVED, REGRESSED or WRONG."""
+    if base is None or new is None:
+        return 'OK'
+    if metric in BOUND_METRICS:
+        tol = args.bound_tol * max(1.0, abs(base))
+        return 'OK' if abs(new - base) <= tol else 'WRONG'
+    if metric in TIME_METRICS:
+        rel, slack = args.time_tol, args.time_slack
+    elif metric == MEMORY_METRIC:
+        rel, slack = args.memory_tol, 0.0
+    else:
+        rel, slack = args.count_tol, 0.0
+    if new > base * (1.0 + rel) + slack:
+        return 'REGRESSED'
+    if new < base * (1.0 - rel) - slack:
+        return 'IMPROVED'
+    return 'OK'
+
+
+def value_str(value):
+    return '-' if value is None else '%.6g' % value
+
+
+def report(results, baseline, args):
+    """Print the comparison, returns the number of failures."""
+    nFail = 0
+    metrics = BOUND_METRICS + TIME_METRICS + COUNT_METRICS + [MEMORY_METRIC]
+    fmt = '%-22s %-14s %14s %14s %8s  %s'
+    print()
+    print(fmt % ('run', 'metric', 'baseline', 'new', 'ratio', 'status'))
+    for key in sorted(results):
+        new  = results[key]
+        base = baseline.get(key)
+        if new is None:
+            print(fmt % (key, '-', '-', '-', '-', 'FAILED'))
+            nFail += 1
+            continue
+        if base is None:
+            print(fmt % (key, '-', '-', '-', '-', 'NO BASELINE'))
+            continue
+        for metric in metrics:
+            b, n = base.get(metric), new.get(metric)
+            status = compare_metric(metric, b, n, args)
+            if status in ('REGRESSED', 'WRONG'):
+                nFail += 1
+            if status == 'OK' and not args.verbose:
+                continue
+            ratio = '%.3f' % (n / b) if b and n is not None else '-'
+            print(fmt % (key, metric, value_str(b), value_str(n), ratio,
+                         status))
+    print()
+    print('%d run(s), %d failure(s)' % (len(results), nFail))
+    return nFail
+
+
+def main():
+    here = os.path.dirname(os.path.abspath(__file__))
+    parser = argparse.ArgumentParser(description=__doc__,
+        formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--suite', default=os.path.join(here,
+                        'benchmark.suite'))
+    parser.add_argument('--build-dir', default='..',
+                        help='Dip build directory (with examples/)')
+    parser.add_argument('--baseline', default='benchmark.baseline.json')
+    parser.add_argument('--save-baseline', action='store_true',
+                        help='store the results as the new baseline')
+    parser.add_argument('--output-dir', default='benchmark.out',
+                        help='logs, stats and results of the runs')
+    parser.add_argument('--threads', default='1',
+                        help='comma separated thread counts')
+    parser.add_argument('--repeat', type=int, default=1,
+                        help='runs per instance (median time is kept)')
+    parser.add_argument('--only', default='',
+                        help='comma separated names of the runs to do')
+    parser.add_argument('--time-limit', type=float, default=0.0,
+                        help='DECOMP:TimeLimit for each run')
+    parser.add_argument('--timeout', type=float, default=0.0,
+                        help='kill a run after this many seconds')
+    parser.add_argument('--time-tol', type=float, default=0.10)
+    parser.add_argument('--time-slack', type=float, default=0.25,
+                        help='seconds of noise allowed on top of time-tol')
+    parser.add_argument('--count-tol', type=float, default=0.05)
+    parser.add_argument('--memory-tol', type=float, default=0.10)
+    parser.add_argument('--bound-tol', type=float, default=1.0e-6)
+    parser.add_argument('--verbose', action='store_true',
+                        help='print all metrics, not only the changes')
+    args = parser.parse_args()
+    args.threads = [int(t) for t in args.threads.split(',')]
+    args.repeat  = max(args.repeat, 1)
+
+    suite = read_suite(args.suite)
+    if args.only:
+        only  = set(args.only.split(','))
+        suite = [e for e in suite if e['name'] in only]
+
+    results = run_suite(suite, args)
+    with open(os.path.join(args.output_dir, 'results.json'), 'w') as f:
+        json.dump(results, f, indent=1, sort_keys=True)
+
+    if args.save_baseline:
+        if any(r is None for r in results.values()):
+            sys.exit('some runs failed, baseline not saved')
+        with open(args.baseline, 'w') as f:
+            json.dump(results, f, indent=1, sort_keys=True)
+        print('baseline saved to %s' % args.baseline)
+        return 0
+
+    baseline = {}
+    if os.path.exists(args.baseline):
+        with open(args.baseline) as f:
+            baseline = json.load(f)
+    else:
+        print('no baseline %s (run with --save-baseline)' % args.baseline)
+    return 1 if report(results, baseline, args) else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())